@@ -15,8 +15,10 @@
 
 #include <string>
 #include <vector>
+#include <deque>
 #include <map>
 #include <unordered_map>
+#include <unordered_set>
 #include <memory>
 #include <stdexcept>
 #include <iostream>
@@ -28,6 +30,31 @@
 #include <iomanip>
 #include <cctype>
 #include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <limits>
+#include <chrono>
+#include <ratio>
+#include <new>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <system_error>
+#include <cerrno>
+#include <fstream>
+#include <iterator>
+
+// 応答ファイル（@file）のメモリマップ
+#if defined(__unix__) || defined(__APPLE__)
+#define ARGPARSE_HAS_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define ARGPARSE_HAS_MMAP 0
+#endif
 
 // Version information
 #define ARGPARSE_VERSION_MAJOR 0
@@ -54,15 +81,59 @@ namespace argparse {
         }
     };
     
+    // Outcome of a non-throwing parse (see try_parse_args)
+    enum class ParseStatus {
+        SUCCESS,
+        HELP_REQUESTED,           // -h/--help was given
+        UNRECOGNIZED_ARGUMENTS,   // unknown option or surplus positional argument
+        MISSING_REQUIRED,         // required option or positional argument not given
+        MISSING_VALUE,            // option or positional argument lacks its value(s)
+        INVALID_VALUE,            // conversion or validation failed
+        INVALID_CHOICE,           // value is not one of the choices
+        ACTION_FAILED,            // a custom action reported an error
+        UNSUPPORTED_ACTION,       // unknown action or custom action without handler
+        RESPONSE_FILE_ERROR,      // @file could not be read, includes itself, or has an unterminated quote
+        BINDING_FAILED            // try_parse_into could not store a value into its bind() member
+    };
+    
+    // Byte count for type<ByteSize>(): "4096", "64MiB", "1.5GB"
+    // SI suffixes (k, M, G, T, P, E) are powers of 1000, IEC suffixes (Ki, Mi, ...) powers of 1024
+    struct ByteSize {
+        uint64_t bytes;
+        
+        ByteSize() : bytes(0) {}
+        explicit ByteSize(uint64_t count) : bytes(count) {}
+        
+        friend bool operator==(ByteSize lhs, ByteSize rhs) { return lhs.bytes == rhs.bytes; }
+        friend bool operator!=(ByteSize lhs, ByteSize rhs) { return lhs.bytes != rhs.bytes; }
+        friend bool operator<(ByteSize lhs, ByteSize rhs) { return lhs.bytes < rhs.bytes; }
+    };
+    
+    // Events per second for type<Rate>(): "250", "1.5k", "10M/s", "120/min"
+    struct Rate {
+        double per_second;
+        
+        Rate() : per_second(0) {}
+        explicit Rate(double value) : per_second(value) {}
+        
+        friend bool operator==(Rate lhs, Rate rhs) { return lhs.per_second == rhs.per_second; }
+        friend bool operator!=(Rate lhs, Rate rhs) { return lhs.per_second != rhs.per_second; }
+        friend bool operator<(Rate lhs, Rate rhs) { return lhs.per_second < rhs.per_second; }
+    };
+    
     // Forward declarations
     class ArgumentParser;
     class Argument;
     class ArgumentGroup;
     class Namespace;
+    class CompiledParser;
+    class ParseResult;
+    class ParseOutput;
     
     namespace detail {
         // Internal implementation details
         class Parser;
+        class ParsePlan;
         class Tokenizer;
         class HelpGenerator;
         class ArgumentError;
@@ -129,6 +200,86 @@ namespace argparse {
             static void _append_usage_args(std::ostringstream& oss, const ArgumentParser& parser);
         };
         
+        // StringView: 非所有の文字列ビュー（C++11用のstd::string_view代替）
+        // 参照先（argvや呼び出し元のバッファ）はビューより長く生存している必要がある
+        class StringView {
+        private:
+            const char* data_;
+            size_t size_;
+            
+        public:
+            enum : size_t { npos = static_cast<size_t>(-1) };
+            
+            StringView() : data_(""), size_(0) {}
+            StringView(const char* data, size_t size) : data_(data), size_(size) {}
+            StringView(const char* str) : data_(str), size_(std::strlen(str)) {}
+            StringView(const std::string& str) : data_(str.data()), size_(str.size()) {}
+            
+            const char* data() const { return data_; }
+            size_t size() const { return size_; }
+            size_t length() const { return size_; }
+            bool empty() const { return size_ == 0; }
+            
+            const char* begin() const { return data_; }
+            const char* end() const { return data_ + size_; }
+            
+            // 範囲外の場合は '\0' を返す（空文字列の先頭文字チェック用）
+            char operator[](size_t pos) const { return pos < size_ ? data_[pos] : '\0'; }
+            
+            StringView substr(size_t pos, size_t count = npos) const {
+                if (pos > size_) {
+                    pos = size_;
+                }
+                size_t rest = size_ - pos;
+                return StringView(data_ + pos, count < rest ? count : rest);
+            }
+            
+            size_t find(char c, size_t pos = 0) const {
+                for (size_t i = pos; i < size_; ++i) {
+                    if (data_[i] == c) {
+                        return i;
+                    }
+                }
+                return npos;
+            }
+            
+            bool starts_with(StringView prefix) const {
+                return size_ >= prefix.size_ && std::memcmp(data_, prefix.data_, prefix.size_) == 0;
+            }
+            
+            int compare(StringView other) const {
+                size_t n = size_ < other.size_ ? size_ : other.size_;
+                int result = n == 0 ? 0 : std::memcmp(data_, other.data_, n);
+                if (result != 0) {
+                    return result;
+                }
+                return size_ < other.size_ ? -1 : (size_ > other.size_ ? 1 : 0);
+            }
+            
+            // 所有する文字列へのコピー
+            std::string str() const { return std::string(data_, size_); }
+            operator std::string() const { return str(); }
+        };
+        
+        inline bool operator==(StringView lhs, StringView rhs) {
+            return lhs.size() == rhs.size() && lhs.compare(rhs) == 0;
+        }
+        inline bool operator!=(StringView lhs, StringView rhs) { return !(lhs == rhs); }
+        inline bool operator<(StringView lhs, StringView rhs) { return lhs.compare(rhs) < 0; }
+        
+        inline std::string operator+(const std::string& lhs, StringView rhs) {
+            std::string result(lhs);
+            result.append(rhs.data(), rhs.size());
+            return result;
+        }
+        inline std::string operator+(const char* lhs, StringView rhs) { return std::string(lhs) + rhs; }
+        inline std::string operator+(StringView lhs, const std::string& rhs) { return lhs.str() + rhs; }
+        inline std::string operator+(StringView lhs, const char* rhs) { return lhs.str() + rhs; }
+        
+        inline std::ostream& operator<<(std::ostream& os, StringView view) {
+            return os.write(view.data(), static_cast<std::streamsize>(view.size()));
+        }
+        
         // Type erasure implementation for C++11 (std::any alternative)
         class BaseHolder {
         public:
@@ -137,8 +288,10 @@ namespace argparse {
             virtual const std::type_info& type() const = 0;
         };
         
+        // インラインバッファに収まらない値のヒープ上の格納先
+        // finalなのでAnyValueからの操作は仮想呼び出しにならない
         template<typename T>
-        class Holder : public BaseHolder {
+        class Holder final : public BaseHolder {
         private:
             T value_;
             
@@ -158,54 +311,237 @@ namespace argparse {
             const T& get() const { return value_; }
         };
         
+        // 小さい値（整数・浮動小数点・bool・std::string）はインラインバッファに直接格納し、
+        // それ以外はHolder<T>としてヒープに置く。型ごとの操作は静的な関数テーブルで行う
         class AnyValue {
         private:
-            BaseHolder* holder_;
+            enum : size_t { INLINE_SIZE = 32 };  // std::stringが収まるサイズ
+            
+            union Storage {
+                void* heap;
+                long long align_integer;
+                double align_floating;
+                unsigned char buffer[INLINE_SIZE];
+            };
+            
+            // 型ごとの操作テーブル（仮想関数テーブルの代わり）
+            struct Ops {
+                const std::type_info& (*type)();
+                void (*copy)(const Storage& source, Storage& target);
+                void (*move)(Storage& source, Storage& target);  // sourceは破棄済みになる
+                void (*assign)(const Storage& source, Storage& target);  // 同じ型の値への代入
+                void (*destroy)(Storage& storage);
+                bool trivial;  // バイトコピーで複製でき、破棄が不要
+                bool stored_inline;
+            };
+            
+            // インライン格納の条件：サイズとアラインメントが収まり、ムーブで例外を投げない
+            template<typename T>
+            struct InlineStorable : std::integral_constant<bool,
+                sizeof(T) <= INLINE_SIZE &&
+                alignof(T) <= alignof(Storage) &&
+                std::is_nothrow_move_constructible<T>::value> {};
+            
+            template<typename T>
+            struct InlineManager {
+                template<typename U>
+                static void create(Storage& storage, U&& value) {
+                    ::new (static_cast<void*>(storage.buffer)) T(std::forward<U>(value));
+                }
+                static T* pointer(const Storage& storage) {
+                    return const_cast<T*>(reinterpret_cast<const T*>(storage.buffer));
+                }
+                static void copy(const Storage& source, Storage& target) {
+                    create(target, *pointer(source));
+                }
+                static void move(Storage& source, Storage& target) {
+                    create(target, std::move(*pointer(source)));
+                    pointer(source)->~T();
+                }
+                static void destroy(Storage& storage) {
+                    pointer(storage)->~T();
+                }
+            };
+            
+            template<typename T>
+            struct HeapManager {
+                template<typename U>
+                static void create(Storage& storage, U&& value) {
+                    storage.heap = new Holder<T>(std::forward<U>(value));
+                }
+                static T* pointer(const Storage& storage) {
+                    return &static_cast<Holder<T>*>(storage.heap)->get();
+                }
+                static void copy(const Storage& source, Storage& target) {
+                    target.heap = new Holder<T>(*pointer(source));
+                }
+                static void move(Storage& source, Storage& target) {
+                    target.heap = source.heap;
+                    source.heap = nullptr;
+                }
+                static void destroy(Storage& storage) {
+                    delete static_cast<Holder<T>*>(storage.heap);
+                }
+            };
+            
+            template<typename T>
+            struct Manager : std::conditional<InlineStorable<T>::value,
+                                              InlineManager<T>, HeapManager<T>>::type {};
+            
+            // 代入可能な型は T の代入演算子を使い、std::string や std::vector の確保済み領域を再利用する
+            template<typename T>
+            struct CopyAssigner {
+                static void assign(const Storage& source, Storage& target) {
+                    *Manager<T>::pointer(target) = *Manager<T>::pointer(source);
+                }
+            };
+            
+            // 代入できない型は複製を作ってから置き換える
+            template<typename T>
+            struct ReplaceAssigner {
+                static void assign(const Storage& source, Storage& target) {
+                    Storage replacement;
+                    Manager<T>::copy(source, replacement);
+                    Manager<T>::destroy(target);
+                    Manager<T>::move(replacement, target);
+                }
+            };
+            
+            template<typename T>
+            struct Assigner : std::conditional<std::is_copy_assignable<T>::value,
+                                               CopyAssigner<T>, ReplaceAssigner<T>>::type {};
+            
+            template<typename T>
+            static const std::type_info& _type_of() { return typeid(T); }
+            
+            template<typename T>
+            struct OpsTable {
+                static const Ops value;
+            };
+            
+            Storage storage_;
+            const Ops* ops_;
+            
+            template<typename T>
+            struct Decayed {
+                typedef typename std::decay<T>::type type;
+            };
+            
+            template<typename U>
+            void _emplace(U&& value) {
+                typedef typename Decayed<U>::type T;
+                Manager<T>::create(storage_, std::forward<U>(value));
+                ops_ = &OpsTable<T>::value;
+            }
+            
+            void _copy_from(const AnyValue& other) {
+                if (other.ops_ && !other.ops_->trivial) {
+                    other.ops_->copy(other.storage_, storage_);
+                } else if (other.ops_) {
+                    storage_ = other.storage_;  // 空の値の領域は未初期化なので複写しない
+                }
+                ops_ = other.ops_;
+            }
+            
+            void _move_from(AnyValue& other) noexcept {
+                if (other.ops_ && !other.ops_->trivial) {
+                    other.ops_->move(other.storage_, storage_);
+                } else if (other.ops_) {
+                    storage_ = other.storage_;
+                }
+                ops_ = other.ops_;
+                other.ops_ = nullptr;
+            }
+            
+            // 型ごとの操作テーブルのアドレスを型タグとして比較する
+            template<typename T>
+            T* _typed_pointer() const noexcept {
+                if (ops_ == &OpsTable<T>::value) {
+                    return Manager<T>::pointer(storage_);
+                }
+                // 共有ライブラリ間でテーブルが重複した場合に備えtype_infoでも確認する
+                if (ops_ && ops_->type() == typeid(T)) {
+                    return Manager<T>::pointer(storage_);
+                }
+                return nullptr;
+            }
+            
+            template<typename T>
+            T* _checked_pointer() const {
+                T* value = _typed_pointer<T>();
+                if (!value) {
+                    _throw_bad_access(typeid(T));
+                }
+                return value;
+            }
+            
+            [[noreturn]] void _throw_bad_access(const std::type_info& requested) const {
+                if (!ops_) {
+                    throw std::runtime_error("AnyValue is empty");
+                }
+                throw std::runtime_error(
+                    "Type mismatch: stored type is " + 
+                    std::string(ops_->type().name()) + 
+                    ", requested type is " + 
+                    std::string(requested.name())
+                );
+            }
             
         public:
             // Default constructor
-            AnyValue() : holder_(nullptr) {}
+            AnyValue() noexcept : ops_(nullptr) {}
             
             // Constructor from value
             template<typename T>
             AnyValue(const T& value, 
                      typename std::enable_if<!std::is_same<AnyValue, typename std::decay<T>::type>::value>::type* = nullptr) 
-                : holder_(new Holder<typename std::decay<T>::type>(value)) {}
+                : ops_(nullptr) {
+                _emplace(value);
+            }
             
             template<typename T>
             AnyValue(T&& value,
                      typename std::enable_if<!std::is_same<AnyValue, typename std::decay<T>::type>::value>::type* = nullptr) 
-                : holder_(new Holder<typename std::decay<T>::type>(std::forward<T>(value))) {}
+                : ops_(nullptr) {
+                _emplace(std::forward<T>(value));
+            }
             
             // Copy constructor
-            AnyValue(const AnyValue& other) 
-                : holder_(other.holder_ ? other.holder_->clone() : nullptr) {}
+            AnyValue(const AnyValue& other) : ops_(nullptr) {
+                _copy_from(other);
+            }
             
             // Move constructor
-            AnyValue(AnyValue&& other) : holder_(other.holder_) {
-                other.holder_ = nullptr;
+            AnyValue(AnyValue&& other) noexcept : ops_(nullptr) {
+                _move_from(other);
             }
             
             // Destructor
             ~AnyValue() {
-                delete holder_;
+                reset();
             }
             
-            // Copy assignment
+            // Copy assignment (a value of the same type is assigned in place, reusing its storage)
             AnyValue& operator=(const AnyValue& other) {
-                if (this != &other) {
-                    delete holder_;
-                    holder_ = other.holder_ ? other.holder_->clone() : nullptr;
+                if (this != &other && ops_ && ops_ == other.ops_) {
+                    if (ops_->trivial) {
+                        storage_ = other.storage_;
+                    } else {
+                        ops_->assign(other.storage_, storage_);
+                    }
+                } else if (this != &other) {
+                    AnyValue copy(other);
+                    reset();
+                    _move_from(copy);
                 }
                 return *this;
             }
             
             // Move assignment
-            AnyValue& operator=(AnyValue&& other) {
+            AnyValue& operator=(AnyValue&& other) noexcept {
                 if (this != &other) {
-                    delete holder_;
-                    holder_ = other.holder_;
-                    other.holder_ = nullptr;
+                    reset();
+                    _move_from(other);
                 }
                 return *this;
             }
@@ -214,121 +550,106 @@ namespace argparse {
             template<typename T>
             typename std::enable_if<!std::is_same<AnyValue, typename std::decay<T>::type>::value, AnyValue&>::type
             operator=(const T& value) {
-                delete holder_;
-                holder_ = new Holder<typename std::decay<T>::type>(value);
+                AnyValue replacement(value);
+                reset();
+                _move_from(replacement);
                 return *this;
             }
             
             template<typename T>
             typename std::enable_if<!std::is_same<AnyValue, typename std::decay<T>::type>::value, AnyValue&>::type
             operator=(T&& value) {
-                delete holder_;
-                holder_ = new Holder<typename std::decay<T>::type>(std::forward<T>(value));
+                AnyValue replacement(std::forward<T>(value));
+                reset();
+                _move_from(replacement);
                 return *this;
             }
             
             // Specialized assignment for string literals - converts to std::string
             AnyValue& operator=(const char* value) {
-                delete holder_;
-                holder_ = new Holder<std::string>(std::string(value));
+                std::string converted(value);
+                AnyValue replacement(std::move(converted));
+                reset();
+                _move_from(replacement);
                 return *this;
             }
             
             // Type-safe getter
             template<typename T>
             T& get() {
-                if (!holder_) {
-                    throw std::runtime_error("AnyValue is empty");
-                }
-                
-                Holder<T>* typed_holder = dynamic_cast<Holder<T>*>(holder_);
-                if (!typed_holder) {
-                    throw std::runtime_error(
-                        "Type mismatch: stored type is " + 
-                        std::string(holder_->type().name()) + 
-                        ", requested type is " + 
-                        std::string(typeid(T).name())
-                    );
-                }
-                
-                return typed_holder->get();
+                return *_checked_pointer<T>();
             }
             
             template<typename T>
             const T& get() const {
-                if (!holder_) {
-                    throw std::runtime_error("AnyValue is empty");
-                }
-                
-                const Holder<T>* typed_holder = dynamic_cast<const Holder<T>*>(holder_);
-                if (!typed_holder) {
-                    throw std::runtime_error(
-                        "Type mismatch: stored type is " + 
-                        std::string(holder_->type().name()) + 
-                        ", requested type is " + 
-                        std::string(typeid(T).name())
-                    );
-                }
-                
-                return typed_holder->get();
+                return *_checked_pointer<T>();
+            }
+            
+            // Non-throwing getter: nullptr when empty or of another type
+            template<typename T>
+            T* try_get() noexcept {
+                return _typed_pointer<T>();
+            }
+            
+            template<typename T>
+            const T* try_get() const noexcept {
+                return _typed_pointer<T>();
             }
             
             // Check if empty
-            bool empty() const { return holder_ == nullptr; }
+            bool empty() const { return ops_ == nullptr; }
+            
+            // Whether the value lives in the inline buffer (no heap allocation)
+            bool is_inline() const {
+                return ops_ && ops_->stored_inline;
+            }
             
             // Get stored type
             const std::type_info& type() const {
-                if (!holder_) {
+                if (!ops_) {
                     return typeid(void);
                 }
-                return holder_->type();
+                return ops_->type();
             }
             
             // Reset to empty state
-            void reset() {
-                delete holder_;
-                holder_ = nullptr;
+            void reset() noexcept {
+                if (ops_ && !ops_->trivial) {
+                    ops_->destroy(storage_);
+                }
+                ops_ = nullptr;
             }
             
             // Swap with another AnyValue
-            void swap(AnyValue& other) {
-                std::swap(holder_, other.holder_);
+            void swap(AnyValue& other) noexcept {
+                AnyValue temp(std::move(other));
+                other = std::move(*this);
+                *this = std::move(temp);
             }
             
             // Comparison function for choices validation
             template<typename T>
             bool equals(const T& other_value) const {
-                if (!holder_) {
-                    return false;
-                }
-                
-                if (holder_->type() != typeid(T)) {
-                    return false;
-                }
-                
-                try {
-                    return get<T>() == other_value;
-                } catch (...) {
-                    return false;
-                }
+                const T* value = try_get<T>();
+                return value && *value == other_value;
             }
             
             // Compare with another AnyValue (same type comparison)
             bool equals(const AnyValue& other) const {
-                if (!holder_ && !other.holder_) {
+                if (!ops_ && !other.ops_) {
                     return true;  // Both empty
                 }
                 
-                if (!holder_ || !other.holder_) {
+                if (!ops_ || !other.ops_) {
                     return false;  // One empty, one not
                 }
                 
-                if (holder_->type() != other.holder_->type()) {
+                if (type() != other.type()) {
                     return false;  // Different types
                 }
                 
                 // For string type (most common case)
-                if (holder_->type() == typeid(std::string)) {
+                if (type() == typeid(std::string)) {
                     try {
                         return get<std::string>() == other.get<std::string>();
                     } catch (...) {
@@ -337,7 +658,7 @@ namespace argparse {
                 }
                 
                 // For int type
-                if (holder_->type() == typeid(int)) {
+                if (type() == typeid(int)) {
                     try {
                         return get<int>() == other.get<int>();
                     } catch (...) {
@@ -346,7 +667,7 @@ namespace argparse {
                 }
                 
                 // For double/float type
-                if (holder_->type() == typeid(double)) {
+                if (type() == typeid(double)) {
                     try {
                         return get<double>() == other.get<double>();
                     } catch (...) {
@@ -354,382 +675,3547 @@ namespace argparse {
                     }
                 }
                 
+                if (type() == typeid(float)) {
+                    try {
+                        return get<float>() == other.get<float>();
+                    } catch (...) {
+                        return false;
+                    }
+                }
+                
                 // For other types, we can't compare safely without knowing the type
                 // This is a limitation of type erasure
                 return false;
             }
         };
         
-        // TypeConverter: 文字列から各型への変換機能
-        class TypeConverter {
+        template<typename T>
+        const AnyValue::Ops AnyValue::OpsTable<T>::value = {
+            &AnyValue::_type_of<T>,
+            &AnyValue::Manager<T>::copy,
+            &AnyValue::Manager<T>::move,
+            &AnyValue::Assigner<T>::assign,
+            &AnyValue::Manager<T>::destroy,
+            AnyValue::InlineStorable<T>::value && std::is_trivially_copyable<T>::value,
+            AnyValue::InlineStorable<T>::value
+        };
+        
+        // Callable: 関数ポインタ1つと共有状態による型消去された呼び出し
+        // 状態を持たない関数オブジェクトは stateless<Fn>() で確保なしに保持でき、
+        // 呼び出しは関数ポインタ経由の1回の間接呼び出しになる
+        // 保持した状態は非 const のまま呼び出すため、mutable ラムダも std::function と同様に使える
+        template<typename Signature>
+        class Callable;
+        
+        template<typename R, typename... Args>
+        class Callable<R(Args...)> {
         public:
-            // 基本型変換器のテンプレート
-            template<typename T>
-            static std::function<AnyValue(const std::string&)> get_converter();
+            typedef R (*Invoker)(void* state, Args... args);
             
-            // int変換
-            static std::function<AnyValue(const std::string&)> int_converter() {
-                return [](const std::string& value) -> AnyValue {
-                    try {
-                        // 先頭と末尾の空白を除去
-                        std::string trimmed = trim(value);
-                        if (trimmed.empty()) {
-                            throw std::invalid_argument("empty string cannot be converted to int");
-                        }
-                        
-                        size_t pos;
-                        int result = std::stoi(trimmed, &pos);
-                        
-                        // 全体が変換されたかチェック
-                        if (pos != trimmed.length()) {
-                            throw std::invalid_argument("invalid int value: '" + value + "'");
-                        }
-                        
-                        return AnyValue(result);
-                    } catch (const std::invalid_argument&) {
-                        throw std::invalid_argument("invalid int value: '" + value + "'");
-                    } catch (const std::out_of_range&) {
-                        throw std::invalid_argument("int value out of range: '" + value + "'");
-                    }
-                };
-            }
+        private:
+            Invoker invoker_;
+            std::shared_ptr<void> state_;
             
-            // float/double変換
-            static std::function<AnyValue(const std::string&)> float_converter() {
-                return [](const std::string& value) -> AnyValue {
-                    try {
-                        std::string trimmed = trim(value);
-                        if (trimmed.empty()) {
-                            throw std::invalid_argument("empty string cannot be converted to float");
-                        }
-                        
-                        size_t pos;
-                        double result = std::stod(trimmed, &pos);
-                        
-                        if (pos != trimmed.length()) {
-                            throw std::invalid_argument("invalid float value: '" + value + "'");
-                        }
-                        
-                        return AnyValue(result);
-                    } catch (const std::invalid_argument&) {
-                        throw std::invalid_argument("invalid float value: '" + value + "'");
-                    } catch (const std::out_of_range&) {
-                        throw std::invalid_argument("float value out of range: '" + value + "'");
-                    }
-                };
-            }
+        public:
+            Callable() noexcept : invoker_(nullptr) {}
+            Callable(std::nullptr_t) noexcept : invoker_(nullptr) {}
             
-            // bool変換
-            static std::function<AnyValue(const std::string&)> bool_converter() {
-                return [](const std::string& value) -> AnyValue {
-                    std::string lower_value = to_lower(trim(value));
-                    
-                    if (lower_value.empty()) {
-                        throw std::invalid_argument("empty string cannot be converted to bool");
-                    }
-                    
-                    // true値
-                    if (lower_value == "true" || lower_value == "1" || 
-                        lower_value == "yes" || lower_value == "on") {
-                        return AnyValue(true);
-                    }
-                    
-                    // false値
-                    if (lower_value == "false" || lower_value == "0" || 
-                        lower_value == "no" || lower_value == "off") {
-                        return AnyValue(false);
-                    }
-                    
-                    throw std::invalid_argument("invalid bool value: '" + value + "' (expected: true/false, 1/0, yes/no, on/off)");
-                };
+            // 任意の関数オブジェクト（ラムダ、関数ポインタ等）を保持する
+            template<typename Fn, typename = typename std::enable_if<
+                !std::is_same<typename std::decay<Fn>::type, Callable>::value>::type>
+            Callable(Fn&& function)
+                : invoker_(&_invoke_state<typename std::decay<Fn>::type>)
+                , state_(std::make_shared<typename std::decay<Fn>::type>(std::forward<Fn>(function))) {}
+            
+            // 状態を持たない関数オブジェクト型から生成する（確保なし）
+            template<typename Fn>
+            static Callable stateless() noexcept {
+                Callable callable;
+                callable.invoker_ = &_invoke_stateless<Fn>;
+                return callable;
             }
             
-            // string変換（デフォルト）
-            static std::function<AnyValue(const std::string&)> string_converter() {
-                return [](const std::string& value) -> AnyValue {
-                    return AnyValue(value);
-                };
+            R operator()(Args... args) const {
+                return invoker_(state_.get(), std::forward<Args>(args)...);
             }
             
+            explicit operator bool() const noexcept { return invoker_ != nullptr; }
+            bool has_state() const noexcept { return static_cast<bool>(state_); }
+            Invoker invoker() const noexcept { return invoker_; }
             
-            // カスタム変換器の作成ヘルパー
-            template<typename T>
-            static std::function<AnyValue(const std::string&)> create_custom_converter(
-                std::function<T(const std::string&)> converter_func) {
-                return [converter_func](const std::string& value) -> AnyValue {
-                    try {
-                        T result = converter_func(value);
-                        return AnyValue(result);
-                    } catch (const std::exception& e) {
-                        throw std::invalid_argument("custom conversion failed for '" + value + "': " + e.what());
-                    }
-                };
-            }
+            friend bool operator==(const Callable& callable, std::nullptr_t) noexcept { return !callable; }
+            friend bool operator==(std::nullptr_t, const Callable& callable) noexcept { return !callable; }
+            friend bool operator!=(const Callable& callable, std::nullptr_t) noexcept { return static_cast<bool>(callable); }
+            friend bool operator!=(std::nullptr_t, const Callable& callable) noexcept { return static_cast<bool>(callable); }
             
         private:
-            // ユーティリティ関数
-            static std::string trim(const std::string& str) {
-                size_t start = str.find_first_not_of(" \t\n\r");
-                if (start == std::string::npos) return "";
-                
-                size_t end = str.find_last_not_of(" \t\n\r");
-                return str.substr(start, end - start + 1);
+            template<typename Fn>
+            static R _invoke_state(void* state, Args... args) {
+                return (*static_cast<Fn*>(state))(std::forward<Args>(args)...);
             }
             
-            static std::string to_lower(const std::string& str) {
-                std::string result = str;
-                std::transform(result.begin(), result.end(), result.begin(), 
-                    [](unsigned char c) { return std::tolower(c); });
-                return result;
+            template<typename Fn>
+            static R _invoke_stateless(void*, Args... args) {
+                return Fn()(std::forward<Args>(args)...);
             }
         };
         
-        // テンプレート特殊化によるget_converterの実装
-        template<>
-        std::function<AnyValue(const std::string&)> TypeConverter::get_converter<int>() {
-            return int_converter();
+        typedef Callable<AnyValue(const std::string&)> Converter;
+        typedef Callable<bool(const AnyValue&)> Validator;
+        typedef Callable<AnyValue(const AnyValue&, const std::string&)> ActionHandler;
+        typedef Callable<void(const AnyValue&)> ValueSink;
+        
+        // NumberError: 数値の解析結果（例外を使わない変換のためのエラーコード）
+        enum class NumberError {
+            NONE,          // 成功
+            EMPTY,         // 空文字列（空白のみを含む）
+            INVALID,       // 数値として解釈できない
+            OUT_OF_RANGE,  // 型の範囲外
+            INEXACT        // 単位を換算すると端数が出る（バイト数・時間）
+        };
+        
+        // 前後の空白を除いたビュー（コピーしない）
+        inline StringView trim_view(StringView text) {
+            size_t begin = 0;
+            size_t end = text.size();
+            while (begin < end && (text[begin] == ' ' || text[begin] == '\t' ||
+                                   text[begin] == '\n' || text[begin] == '\r')) {
+                ++begin;
+            }
+            while (end > begin && (text[end - 1] == ' ' || text[end - 1] == '\t' ||
+                                   text[end - 1] == '\n' || text[end - 1] == '\r')) {
+                --end;
+            }
+            return text.substr(begin, end - begin);
         }
         
-        template<>
-        std::function<AnyValue(const std::string&)> TypeConverter::get_converter<float>() {
-            return float_converter();
+        // 0-9, a-z, A-Z の数値（数字でなければ36）
+        inline unsigned digit_value(char c) {
+            if (c >= '0' && c <= '9') {
+                return static_cast<unsigned>(c - '0');
+            }
+            char lower = static_cast<char>(c | 0x20);
+            if (lower >= 'a' && lower <= 'z') {
+                return static_cast<unsigned>(lower - 'a') + 10;
+            }
+            return 36;
         }
         
-        template<>
-        std::function<AnyValue(const std::string&)> TypeConverter::get_converter<double>() {
-            return float_converter();
+        // 整数の解析（確保なし・ロケール非依存、例外を送出せずエラーコードを返す）
+        // 前後の空白、符号、0x/0o/0b 接頭辞（大文字小文字を問わない）、
+        // 数字の間の区切り文字 '_' または '\'' を受け付ける。失敗時 out は変更しない
+        template<typename T>
+        NumberError parse_integer(StringView text, T& out) {
+            static_assert(std::is_integral<T>::value && !std::is_same<T, bool>::value,
+                          "parse_integer requires an integral type");
+            typedef unsigned long long Magnitude;
+            
+            text = trim_view(text);
+            if (text.empty()) {
+                return NumberError::EMPTY;
+            }
+            
+            size_t pos = 0;
+            bool negative = false;
+            if (text[0] == '+' || text[0] == '-') {
+                negative = text[0] == '-';
+                ++pos;
+            }
+            
+            unsigned base = 10;
+            if (pos + 1 < text.size() && text[pos] == '0') {
+                char prefix = static_cast<char>(text[pos + 1] | 0x20);
+                if (prefix == 'x') base = 16;
+                else if (prefix == 'o') base = 8;
+                else if (prefix == 'b') base = 2;
+                if (base != 10) pos += 2;
+            }
+            
+            // 絶対値の上限（符号なし型の負数は0のみ許す）
+            const Magnitude max_value = static_cast<Magnitude>(std::numeric_limits<T>::max());
+            const Magnitude limit = !negative ? max_value
+                                  : std::is_signed<T>::value ? max_value + 1 : 0;
+            
+            Magnitude value = 0;
+            bool overflow = false;
+            bool after_digit = false;
+            for (; pos < text.size(); ++pos) {
+                char c = text[pos];
+                if (c == '_' || c == '\'') {
+                    // 区切り文字は数字の間にのみ置ける
+                    if (!after_digit) {
+                        return NumberError::INVALID;
+                    }
+                    after_digit = false;
+                    continue;
+                }
+                
+                unsigned digit = digit_value(c);
+                if (digit >= base) {
+                    return NumberError::INVALID;
+                }
+                // 桁あふれ後も末尾まで走査し、不正な文字を優先して報告する
+                if (digit > limit || value > (limit - digit) / base) {
+                    overflow = true;
+                } else {
+                    value = value * base + digit;
+                }
+                after_digit = true;
+            }
+            
+            if (!after_digit) {
+                return NumberError::INVALID;  // 数字がない、または区切り文字で終わる
+            }
+            if (overflow) {
+                return NumberError::OUT_OF_RANGE;
+            }
+            
+            if (negative && value != 0) {
+                out = static_cast<T>(-static_cast<long long>(value - 1) - 1);
+            } else {
+                out = static_cast<T>(value);
+            }
+            return NumberError::NONE;
         }
         
-        template<>
-        std::function<AnyValue(const std::string&)> TypeConverter::get_converter<bool>() {
-            return bool_converter();
+        // エラーメッセージで使う整数型の名前（受け付ける範囲が分かるよう幅を示す。32ビットは従来どおり "int"）
+        template<typename T>
+        inline const char* integer_type_name() {
+            switch (sizeof(T)) {
+                case 1: return std::is_signed<T>::value ? "int8" : "uint8";
+                case 2: return std::is_signed<T>::value ? "int16" : "uint16";
+                case 4: return std::is_signed<T>::value ? "int" : "unsigned int";
+                default: return std::is_signed<T>::value ? "int64" : "uint64";
+            }
         }
         
-        template<>
-        std::function<AnyValue(const std::string&)> TypeConverter::get_converter<std::string>() {
-            return string_converter();
+        // 数値変換エラーのメッセージ（エラー時にのみ組み立てる）
+        inline std::string number_error_message(NumberError error, const char* type_name, const std::string& value) {
+            if (error == NumberError::OUT_OF_RANGE) {
+                return std::string(type_name) + " value out of range: '" + value + "'";
+            }
+            return std::string("invalid ") + type_name + " value: '" + value + "'";
         }
         
-        // Token structure for parsed arguments
-        struct Token {
-            enum Type {
-                POSITIONAL,    // Non-option argument
-                SHORT_OPTION,  // -o
-                LONG_OPTION,   // --option
-                OPTION_VALUE,  // Value for an option
-                END_OPTIONS    // -- (end of options marker)
+        // ---- 浮動小数点数の解析（ロケール非依存・正確な丸め） ----
+        // 有効数字19桁以内かつ指数が小さい場合は Clinger の高速経路、
+        // それ以外は Eisel–Lemire 法（128ビットの5の冪表を使用）で丸めまで正確に求める。
+        // 20桁以上で丸め方向が確定しない場合のみ多倍長の10進数で計算する
+        
+        // 5^q（q = -342..308）の上位128ビット（Eisel–Lemire 法で使用）
+        inline const uint64_t* power_of_five_128() {
+            static const uint64_t table[] = {
+                0xeef453d6923bd65aULL, 0x113faa2906a13b3fULL, 0x9558b4661b6565f8ULL, 0x4ac7ca59a424c507ULL,
+                0xbaaee17fa23ebf76ULL, 0x5d79bcf00d2df649ULL, 0xe95a99df8ace6f53ULL, 0xf4d82c2c107973dcULL,
+                0x91d8a02bb6c10594ULL, 0x79071b9b8a4be869ULL, 0xb64ec836a47146f9ULL, 0x9748e2826cdee284ULL,
+                0xe3e27a444d8d98b7ULL, 0xfd1b1b2308169b25ULL, 0x8e6d8c6ab0787f72ULL, 0xfe30f0f5e50e20f7ULL,
+                0xb208ef855c969f4fULL, 0xbdbd2d335e51a935ULL, 0xde8b2b66b3bc4723ULL, 0xad2c788035e61382ULL,
+                0x8b16fb203055ac76ULL, 0x4c3bcb5021afcc31ULL, 0xaddcb9e83c6b1793ULL, 0xdf4abe242a1bbf3dULL,
+                0xd953e8624b85dd78ULL, 0xd71d6dad34a2af0dULL, 0x87d4713d6f33aa6bULL, 0x8672648c40e5ad68ULL,
+                0xa9c98d8ccb009506ULL, 0x680efdaf511f18c2ULL, 0xd43bf0effdc0ba48ULL, 0x0212bd1b2566def2ULL,
+                0x84a57695fe98746dULL, 0x014bb630f7604b57ULL, 0xa5ced43b7e3e9188ULL, 0x419ea3bd35385e2dULL,
+                0xcf42894a5dce35eaULL, 0x52064cac828675b9ULL, 0x818995ce7aa0e1b2ULL, 0x7343efebd1940993ULL,
+                0xa1ebfb4219491a1fULL, 0x1014ebe6c5f90bf8ULL, 0xca66fa129f9b60a6ULL, 0xd41a26e077774ef6ULL,
+                0xfd00b897478238d0ULL, 0x8920b098955522b4ULL, 0x9e20735e8cb16382ULL, 0x55b46e5f5d5535b0ULL,
+                0xc5a890362fddbc62ULL, 0xeb2189f734aa831dULL, 0xf712b443bbd52b7bULL, 0xa5e9ec7501d523e4ULL,
+                0x9a6bb0aa55653b2dULL, 0x47b233c92125366eULL, 0xc1069cd4eabe89f8ULL, 0x999ec0bb696e840aULL,
+                0xf148440a256e2c76ULL, 0xc00670ea43ca250dULL, 0x96cd2a865764dbcaULL, 0x380406926a5e5728ULL,
+                0xbc807527ed3e12bcULL, 0xc605083704f5ecf2ULL, 0xeba09271e88d976bULL, 0xf7864a44c633682eULL,
+                0x93445b8731587ea3ULL, 0x7ab3ee6afbe0211dULL, 0xb8157268fdae9e4cULL, 0x5960ea05bad82964ULL,
+                0xe61acf033d1a45dfULL, 0x6fb92487298e33bdULL, 0x8fd0c16206306babULL, 0xa5d3b6d479f8e056ULL,
+                0xb3c4f1ba87bc8696ULL, 0x8f48a4899877186cULL, 0xe0b62e2929aba83cULL, 0x331acdabfe94de87ULL,
+                0x8c71dcd9ba0b4925ULL, 0x9ff0c08b7f1d0b14ULL, 0xaf8e5410288e1b6fULL, 0x07ecf0ae5ee44dd9ULL,
+                0xdb71e91432b1a24aULL, 0xc9e82cd9f69d6150ULL, 0x892731ac9faf056eULL, 0xbe311c083a225cd2ULL,
+                0xab70fe17c79ac6caULL, 0x6dbd630a48aaf406ULL, 0xd64d3d9db981787dULL, 0x092cbbccdad5b108ULL,
+                0x85f0468293f0eb4eULL, 0x25bbf56008c58ea5ULL, 0xa76c582338ed2621ULL, 0xaf2af2b80af6f24eULL,
+                0xd1476e2c07286faaULL, 0x1af5af660db4aee1ULL, 0x82cca4db847945caULL, 0x50d98d9fc890ed4dULL,
+                0xa37fce126597973cULL, 0xe50ff107bab528a0ULL, 0xcc5fc196fefd7d0cULL, 0x1e53ed49a96272c8ULL,
+                0xff77b1fcbebcdc4fULL, 0x25e8e89c13bb0f7aULL, 0x9faacf3df73609b1ULL, 0x77b191618c54e9acULL,
+                0xc795830d75038c1dULL, 0xd59df5b9ef6a2417ULL, 0xf97ae3d0d2446f25ULL, 0x4b0573286b44ad1dULL,
+                0x9becce62836ac577ULL, 0x4ee367f9430aec32ULL, 0xc2e801fb244576d5ULL, 0x229c41f793cda73fULL,
+                0xf3a20279ed56d48aULL, 0x6b43527578c1110fULL, 0x9845418c345644d6ULL, 0x830a13896b78aaa9ULL,
+                0xbe5691ef416bd60cULL, 0x23cc986bc656d553ULL, 0xedec366b11c6cb8fULL, 0x2cbfbe86b7ec8aa8ULL,
+                0x94b3a202eb1c3f39ULL, 0x7bf7d71432f3d6a9ULL, 0xb9e08a83a5e34f07ULL, 0xdaf5ccd93fb0cc53ULL,
+                0xe858ad248f5c22c9ULL, 0xd1b3400f8f9cff68ULL, 0x91376c36d99995beULL, 0x23100809b9c21fa1ULL,
+                0xb58547448ffffb2dULL, 0xabd40a0c2832a78aULL, 0xe2e69915b3fff9f9ULL, 0x16c90c8f323f516cULL,
+                0x8dd01fad907ffc3bULL, 0xae3da7d97f6792e3ULL, 0xb1442798f49ffb4aULL, 0x99cd11cfdf41779cULL,
+                0xdd95317f31c7fa1dULL, 0x40405643d711d583ULL, 0x8a7d3eef7f1cfc52ULL, 0x482835ea666b2572ULL,
+                0xad1c8eab5ee43b66ULL, 0xda3243650005eecfULL, 0xd863b256369d4a40ULL, 0x90bed43e40076a82ULL,
+                0x873e4f75e2224e68ULL, 0x5a7744a6e804a291ULL, 0xa90de3535aaae202ULL, 0x711515d0a205cb36ULL,
+                0xd3515c2831559a83ULL, 0x0d5a5b44ca873e03ULL, 0x8412d9991ed58091ULL, 0xe858790afe9486c2ULL,
+                0xa5178fff668ae0b6ULL, 0x626e974dbe39a872ULL, 0xce5d73ff402d98e3ULL, 0xfb0a3d212dc8128fULL,
+                0x80fa687f881c7f8eULL, 0x7ce66634bc9d0b99ULL, 0xa139029f6a239f72ULL, 0x1c1fffc1ebc44e80ULL,
+                0xc987434744ac874eULL, 0xa327ffb266b56220ULL, 0xfbe9141915d7a922ULL, 0x4bf1ff9f0062baa8ULL,
+                0x9d71ac8fada6c9b5ULL, 0x6f773fc3603db4a9ULL, 0xc4ce17b399107c22ULL, 0xcb550fb4384d21d3ULL,
+                0xf6019da07f549b2bULL, 0x7e2a53a146606a48ULL, 0x99c102844f94e0fbULL, 0x2eda7444cbfc426dULL,
+                0xc0314325637a1939ULL, 0xfa911155fefb5308ULL, 0xf03d93eebc589f88ULL, 0x793555ab7eba27caULL,
+                0x96267c7535b763b5ULL, 0x4bc1558b2f3458deULL, 0xbbb01b9283253ca2ULL, 0x9eb1aaedfb016f16ULL,
+                0xea9c227723ee8bcbULL, 0x465e15a979c1cadcULL, 0x92a1958a7675175fULL, 0x0bfacd89ec191ec9ULL,
+                0xb749faed14125d36ULL, 0xcef980ec671f667bULL, 0xe51c79a85916f484ULL, 0x82b7e12780e7401aULL,
+                0x8f31cc0937ae58d2ULL, 0xd1b2ecb8b0908810ULL, 0xb2fe3f0b8599ef07ULL, 0x861fa7e6dcb4aa15ULL,
+                0xdfbdcece67006ac9ULL, 0x67a791e093e1d49aULL, 0x8bd6a141006042bdULL, 0xe0c8bb2c5c6d24e0ULL,
+                0xaecc49914078536dULL, 0x58fae9f773886e18ULL, 0xda7f5bf590966848ULL, 0xaf39a475506a899eULL,
+                0x888f99797a5e012dULL, 0x6d8406c952429603ULL, 0xaab37fd7d8f58178ULL, 0xc8e5087ba6d33b83ULL,
+                0xd5605fcdcf32e1d6ULL, 0xfb1e4a9a90880a64ULL, 0x855c3be0a17fcd26ULL, 0x5cf2eea09a55067fULL,
+                0xa6b34ad8c9dfc06fULL, 0xf42faa48c0ea481eULL, 0xd0601d8efc57b08bULL, 0xf13b94daf124da26ULL,
+                0x823c12795db6ce57ULL, 0x76c53d08d6b70858ULL, 0xa2cb1717b52481edULL, 0x54768c4b0c64ca6eULL,
+                0xcb7ddcdda26da268ULL, 0xa9942f5dcf7dfd09ULL, 0xfe5d54150b090b02ULL, 0xd3f93b35435d7c4cULL,
+                0x9efa548d26e5a6e1ULL, 0xc47bc5014a1a6dafULL, 0xc6b8e9b0709f109aULL, 0x359ab6419ca1091bULL,
+                0xf867241c8cc6d4c0ULL, 0xc30163d203c94b62ULL, 0x9b407691d7fc44f8ULL, 0x79e0de63425dcf1dULL,
+                0xc21094364dfb5636ULL, 0x985915fc12f542e4ULL, 0xf294b943e17a2bc4ULL, 0x3e6f5b7b17b2939dULL,
+                0x979cf3ca6cec5b5aULL, 0xa705992ceecf9c42ULL, 0xbd8430bd08277231ULL, 0x50c6ff782a838353ULL,
+                0xece53cec4a314ebdULL, 0xa4f8bf5635246428ULL, 0x940f4613ae5ed136ULL, 0x871b7795e136be99ULL,
+                0xb913179899f68584ULL, 0x28e2557b59846e3fULL, 0xe757dd7ec07426e5ULL, 0x331aeada2fe589cfULL,
+                0x9096ea6f3848984fULL, 0x3ff0d2c85def7621ULL, 0xb4bca50b065abe63ULL, 0x0fed077a756b53a9ULL,
+                0xe1ebce4dc7f16dfbULL, 0xd3e8495912c62894ULL, 0x8d3360f09cf6e4bdULL, 0x64712dd7abbbd95cULL,
+                0xb080392cc4349decULL, 0xbd8d794d96aacfb3ULL, 0xdca04777f541c567ULL, 0xecf0d7a0fc5583a0ULL,
+                0x89e42caaf9491b60ULL, 0xf41686c49db57244ULL, 0xac5d37d5b79b6239ULL, 0x311c2875c522ced5ULL,
+                0xd77485cb25823ac7ULL, 0x7d633293366b828bULL, 0x86a8d39ef77164bcULL, 0xae5dff9c02033197ULL,
+                0xa8530886b54dbdebULL, 0xd9f57f830283fdfcULL, 0xd267caa862a12d66ULL, 0xd072df63c324fd7bULL,
+                0x8380dea93da4bc60ULL, 0x4247cb9e59f71e6dULL, 0xa46116538d0deb78ULL, 0x52d9be85f074e608ULL,
+                0xcd795be870516656ULL, 0x67902e276c921f8bULL, 0x806bd9714632dff6ULL, 0x00ba1cd8a3db53b6ULL,
+                0xa086cfcd97bf97f3ULL, 0x80e8a40eccd228a4ULL, 0xc8a883c0fdaf7df0ULL, 0x6122cd128006b2cdULL,
+                0xfad2a4b13d1b5d6cULL, 0x796b805720085f81ULL, 0x9cc3a6eec6311a63ULL, 0xcbe3303674053bb0ULL,
+                0xc3f490aa77bd60fcULL, 0xbedbfc4411068a9cULL, 0xf4f1b4d515acb93bULL, 0xee92fb5515482d44ULL,
+                0x991711052d8bf3c5ULL, 0x751bdd152d4d1c4aULL, 0xbf5cd54678eef0b6ULL, 0xd262d45a78a0635dULL,
+                0xef340a98172aace4ULL, 0x86fb897116c87c34ULL, 0x9580869f0e7aac0eULL, 0xd45d35e6ae3d4da0ULL,
+                0xbae0a846d2195712ULL, 0x8974836059cca109ULL, 0xe998d258869facd7ULL, 0x2bd1a438703fc94bULL,
+                0x91ff83775423cc06ULL, 0x7b6306a34627ddcfULL, 0xb67f6455292cbf08ULL, 0x1a3bc84c17b1d542ULL,
+                0xe41f3d6a7377eecaULL, 0x20caba5f1d9e4a93ULL, 0x8e938662882af53eULL, 0x547eb47b7282ee9cULL,
+                0xb23867fb2a35b28dULL, 0xe99e619a4f23aa43ULL, 0xdec681f9f4c31f31ULL, 0x6405fa00e2ec94d4ULL,
+                0x8b3c113c38f9f37eULL, 0xde83bc408dd3dd04ULL, 0xae0b158b4738705eULL, 0x9624ab50b148d445ULL,
+                0xd98ddaee19068c76ULL, 0x3badd624dd9b0957ULL, 0x87f8a8d4cfa417c9ULL, 0xe54ca5d70a80e5d6ULL,
+                0xa9f6d30a038d1dbcULL, 0x5e9fcf4ccd211f4cULL, 0xd47487cc8470652bULL, 0x7647c3200069671fULL,
+                0x84c8d4dfd2c63f3bULL, 0x29ecd9f40041e073ULL, 0xa5fb0a17c777cf09ULL, 0xf468107100525890ULL,
+                0xcf79cc9db955c2ccULL, 0x7182148d4066eeb4ULL, 0x81ac1fe293d599bfULL, 0xc6f14cd848405530ULL,
+                0xa21727db38cb002fULL, 0xb8ada00e5a506a7cULL, 0xca9cf1d206fdc03bULL, 0xa6d90811f0e4851cULL,
+                0xfd442e4688bd304aULL, 0x908f4a166d1da663ULL, 0x9e4a9cec15763e2eULL, 0x9a598e4e043287feULL,
+                0xc5dd44271ad3cdbaULL, 0x40eff1e1853f29fdULL, 0xf7549530e188c128ULL, 0xd12bee59e68ef47cULL,
+                0x9a94dd3e8cf578b9ULL, 0x82bb74f8301958ceULL, 0xc13a148e3032d6e7ULL, 0xe36a52363c1faf01ULL,
+                0xf18899b1bc3f8ca1ULL, 0xdc44e6c3cb279ac1ULL, 0x96f5600f15a7b7e5ULL, 0x29ab103a5ef8c0b9ULL,
+                0xbcb2b812db11a5deULL, 0x7415d448f6b6f0e7ULL, 0xebdf661791d60f56ULL, 0x111b495b3464ad21ULL,
+                0x936b9fcebb25c995ULL, 0xcab10dd900beec34ULL, 0xb84687c269ef3bfbULL, 0x3d5d514f40eea742ULL,
+                0xe65829b3046b0afaULL, 0x0cb4a5a3112a5112ULL, 0x8ff71a0fe2c2e6dcULL, 0x47f0e785eaba72abULL,
+                0xb3f4e093db73a093ULL, 0x59ed216765690f56ULL, 0xe0f218b8d25088b8ULL, 0x306869c13ec3532cULL,
+                0x8c974f7383725573ULL, 0x1e414218c73a13fbULL, 0xafbd2350644eeacfULL, 0xe5d1929ef90898faULL,
+                0xdbac6c247d62a583ULL, 0xdf45f746b74abf39ULL, 0x894bc396ce5da772ULL, 0x6b8bba8c328eb783ULL,
+                0xab9eb47c81f5114fULL, 0x066ea92f3f326564ULL, 0xd686619ba27255a2ULL, 0xc80a537b0efefebdULL,
+                0x8613fd0145877585ULL, 0xbd06742ce95f5f36ULL, 0xa798fc4196e952e7ULL, 0x2c48113823b73704ULL,
+                0xd17f3b51fca3a7a0ULL, 0xf75a15862ca504c5ULL, 0x82ef85133de648c4ULL, 0x9a984d73dbe722fbULL,
+                0xa3ab66580d5fdaf5ULL, 0xc13e60d0d2e0ebbaULL, 0xcc963fee10b7d1b3ULL, 0x318df905079926a8ULL,
+                0xffbbcfe994e5c61fULL, 0xfdf17746497f7052ULL, 0x9fd561f1fd0f9bd3ULL, 0xfeb6ea8bedefa633ULL,
+                0xc7caba6e7c5382c8ULL, 0xfe64a52ee96b8fc0ULL, 0xf9bd690a1b68637bULL, 0x3dfdce7aa3c673b0ULL,
+                0x9c1661a651213e2dULL, 0x06bea10ca65c084eULL, 0xc31bfa0fe5698db8ULL, 0x486e494fcff30a62ULL,
+                0xf3e2f893dec3f126ULL, 0x5a89dba3c3efccfaULL, 0x986ddb5c6b3a76b7ULL, 0xf89629465a75e01cULL,
+                0xbe89523386091465ULL, 0xf6bbb397f1135823ULL, 0xee2ba6c0678b597fULL, 0x746aa07ded582e2cULL,
+                0x94db483840b717efULL, 0xa8c2a44eb4571cdcULL, 0xba121a4650e4ddebULL, 0x92f34d62616ce413ULL,
+                0xe896a0d7e51e1566ULL, 0x77b020baf9c81d17ULL, 0x915e2486ef32cd60ULL, 0x0ace1474dc1d122eULL,
+                0xb5b5ada8aaff80b8ULL, 0x0d819992132456baULL, 0xe3231912d5bf60e6ULL, 0x10e1fff697ed6c69ULL,
+                0x8df5efabc5979c8fULL, 0xca8d3ffa1ef463c1ULL, 0xb1736b96b6fd83b3ULL, 0xbd308ff8a6b17cb2ULL,
+                0xddd0467c64bce4a0ULL, 0xac7cb3f6d05ddbdeULL, 0x8aa22c0dbef60ee4ULL, 0x6bcdf07a423aa96bULL,
+                0xad4ab7112eb3929dULL, 0x86c16c98d2c953c6ULL, 0xd89d64d57a607744ULL, 0xe871c7bf077ba8b7ULL,
+                0x87625f056c7c4a8bULL, 0x11471cd764ad4972ULL, 0xa93af6c6c79b5d2dULL, 0xd598e40d3dd89bcfULL,
+                0xd389b47879823479ULL, 0x4aff1d108d4ec2c3ULL, 0x843610cb4bf160cbULL, 0xcedf722a585139baULL,
+                0xa54394fe1eedb8feULL, 0xc2974eb4ee658828ULL, 0xce947a3da6a9273eULL, 0x733d226229feea32ULL,
+                0x811ccc668829b887ULL, 0x0806357d5a3f525fULL, 0xa163ff802a3426a8ULL, 0xca07c2dcb0cf26f7ULL,
+                0xc9bcff6034c13052ULL, 0xfc89b393dd02f0b5ULL, 0xfc2c3f3841f17c67ULL, 0xbbac2078d443ace2ULL,
+                0x9d9ba7832936edc0ULL, 0xd54b944b84aa4c0dULL, 0xc5029163f384a931ULL, 0x0a9e795e65d4df11ULL,
+                0xf64335bcf065d37dULL, 0x4d4617b5ff4a16d5ULL, 0x99ea0196163fa42eULL, 0x504bced1bf8e4e45ULL,
+                0xc06481fb9bcf8d39ULL, 0xe45ec2862f71e1d6ULL, 0xf07da27a82c37088ULL, 0x5d767327bb4e5a4cULL,
+                0x964e858c91ba2655ULL, 0x3a6a07f8d510f86fULL, 0xbbe226efb628afeaULL, 0x890489f70a55368bULL,
+                0xeadab0aba3b2dbe5ULL, 0x2b45ac74ccea842eULL, 0x92c8ae6b464fc96fULL, 0x3b0b8bc90012929dULL,
+                0xb77ada0617e3bbcbULL, 0x09ce6ebb40173744ULL, 0xe55990879ddcaabdULL, 0xcc420a6a101d0515ULL,
+                0x8f57fa54c2a9eab6ULL, 0x9fa946824a12232dULL, 0xb32df8e9f3546564ULL, 0x47939822dc96abf9ULL,
+                0xdff9772470297ebdULL, 0x59787e2b93bc56f7ULL, 0x8bfbea76c619ef36ULL, 0x57eb4edb3c55b65aULL,
+                0xaefae51477a06b03ULL, 0xede622920b6b23f1ULL, 0xdab99e59958885c4ULL, 0xe95fab368e45ecedULL,
+                0x88b402f7fd75539bULL, 0x11dbcb0218ebb414ULL, 0xaae103b5fcd2a881ULL, 0xd652bdc29f26a119ULL,
+                0xd59944a37c0752a2ULL, 0x4be76d3346f0495fULL, 0x857fcae62d8493a5ULL, 0x6f70a4400c562ddbULL,
+                0xa6dfbd9fb8e5b88eULL, 0xcb4ccd500f6bb952ULL, 0xd097ad07a71f26b2ULL, 0x7e2000a41346a7a7ULL,
+                0x825ecc24c873782fULL, 0x8ed400668c0c28c8ULL, 0xa2f67f2dfa90563bULL, 0x728900802f0f32faULL,
+                0xcbb41ef979346bcaULL, 0x4f2b40a03ad2ffb9ULL, 0xfea126b7d78186bcULL, 0xe2f610c84987bfa8ULL,
+                0x9f24b832e6b0f436ULL, 0x0dd9ca7d2df4d7c9ULL, 0xc6ede63fa05d3143ULL, 0x91503d1c79720dbbULL,
+                0xf8a95fcf88747d94ULL, 0x75a44c6397ce912aULL, 0x9b69dbe1b548ce7cULL, 0xc986afbe3ee11abaULL,
+                0xc24452da229b021bULL, 0xfbe85badce996168ULL, 0xf2d56790ab41c2a2ULL, 0xfae27299423fb9c3ULL,
+                0x97c560ba6b0919a5ULL, 0xdccd879fc967d41aULL, 0xbdb6b8e905cb600fULL, 0x5400e987bbc1c920ULL,
+                0xed246723473e3813ULL, 0x290123e9aab23b68ULL, 0x9436c0760c86e30bULL, 0xf9a0b6720aaf6521ULL,
+                0xb94470938fa89bceULL, 0xf808e40e8d5b3e69ULL, 0xe7958cb87392c2c2ULL, 0xb60b1d1230b20e04ULL,
+                0x90bd77f3483bb9b9ULL, 0xb1c6f22b5e6f48c2ULL, 0xb4ecd5f01a4aa828ULL, 0x1e38aeb6360b1af3ULL,
+                0xe2280b6c20dd5232ULL, 0x25c6da63c38de1b0ULL, 0x8d590723948a535fULL, 0x579c487e5a38ad0eULL,
+                0xb0af48ec79ace837ULL, 0x2d835a9df0c6d851ULL, 0xdcdb1b2798182244ULL, 0xf8e431456cf88e65ULL,
+                0x8a08f0f8bf0f156bULL, 0x1b8e9ecb641b58ffULL, 0xac8b2d36eed2dac5ULL, 0xe272467e3d222f3fULL,
+                0xd7adf884aa879177ULL, 0x5b0ed81dcc6abb0fULL, 0x86ccbb52ea94baeaULL, 0x98e947129fc2b4e9ULL,
+                0xa87fea27a539e9a5ULL, 0x3f2398d747b36224ULL, 0xd29fe4b18e88640eULL, 0x8eec7f0d19a03aadULL,
+                0x83a3eeeef9153e89ULL, 0x1953cf68300424acULL, 0xa48ceaaab75a8e2bULL, 0x5fa8c3423c052dd7ULL,
+                0xcdb02555653131b6ULL, 0x3792f412cb06794dULL, 0x808e17555f3ebf11ULL, 0xe2bbd88bbee40bd0ULL,
+                0xa0b19d2ab70e6ed6ULL, 0x5b6aceaeae9d0ec4ULL, 0xc8de047564d20a8bULL, 0xf245825a5a445275ULL,
+                0xfb158592be068d2eULL, 0xeed6e2f0f0d56712ULL, 0x9ced737bb6c4183dULL, 0x55464dd69685606bULL,
+                0xc428d05aa4751e4cULL, 0xaa97e14c3c26b886ULL, 0xf53304714d9265dfULL, 0xd53dd99f4b3066a8ULL,
+                0x993fe2c6d07b7fabULL, 0xe546a8038efe4029ULL, 0xbf8fdb78849a5f96ULL, 0xde98520472bdd033ULL,
+                0xef73d256a5c0f77cULL, 0x963e66858f6d4440ULL, 0x95a8637627989aadULL, 0xdde7001379a44aa8ULL,
+                0xbb127c53b17ec159ULL, 0x5560c018580d5d52ULL, 0xe9d71b689dde71afULL, 0xaab8f01e6e10b4a6ULL,
+                0x9226712162ab070dULL, 0xcab3961304ca70e8ULL, 0xb6b00d69bb55c8d1ULL, 0x3d607b97c5fd0d22ULL,
+                0xe45c10c42a2b3b05ULL, 0x8cb89a7db77c506aULL, 0x8eb98a7a9a5b04e3ULL, 0x77f3608e92adb242ULL,
+                0xb267ed1940f1c61cULL, 0x55f038b237591ed3ULL, 0xdf01e85f912e37a3ULL, 0x6b6c46dec52f6688ULL,
+                0x8b61313bbabce2c6ULL, 0x2323ac4b3b3da015ULL, 0xae397d8aa96c1b77ULL, 0xabec975e0a0d081aULL,
+                0xd9c7dced53c72255ULL, 0x96e7bd358c904a21ULL, 0x881cea14545c7575ULL, 0x7e50d64177da2e54ULL,
+                0xaa242499697392d2ULL, 0xdde50bd1d5d0b9e9ULL, 0xd4ad2dbfc3d07787ULL, 0x955e4ec64b44e864ULL,
+                0x84ec3c97da624ab4ULL, 0xbd5af13bef0b113eULL, 0xa6274bbdd0fadd61ULL, 0xecb1ad8aeacdd58eULL,
+                0xcfb11ead453994baULL, 0x67de18eda5814af2ULL, 0x81ceb32c4b43fcf4ULL, 0x80eacf948770ced7ULL,
+                0xa2425ff75e14fc31ULL, 0xa1258379a94d028dULL, 0xcad2f7f5359a3b3eULL, 0x096ee45813a04330ULL,
+                0xfd87b5f28300ca0dULL, 0x8bca9d6e188853fcULL, 0x9e74d1b791e07e48ULL, 0x775ea264cf55347eULL,
+                0xc612062576589ddaULL, 0x95364afe032a819eULL, 0xf79687aed3eec551ULL, 0x3a83ddbd83f52205ULL,
+                0x9abe14cd44753b52ULL, 0xc4926a9672793543ULL, 0xc16d9a0095928a27ULL, 0x75b7053c0f178294ULL,
+                0xf1c90080baf72cb1ULL, 0x5324c68b12dd6339ULL, 0x971da05074da7beeULL, 0xd3f6fc16ebca5e04ULL,
+                0xbce5086492111aeaULL, 0x88f4bb1ca6bcf585ULL, 0xec1e4a7db69561a5ULL, 0x2b31e9e3d06c32e6ULL,
+                0x9392ee8e921d5d07ULL, 0x3aff322e62439fd0ULL, 0xb877aa3236a4b449ULL, 0x09befeb9fad487c3ULL,
+                0xe69594bec44de15bULL, 0x4c2ebe687989a9b4ULL, 0x901d7cf73ab0acd9ULL, 0x0f9d37014bf60a11ULL,
+                0xb424dc35095cd80fULL, 0x538484c19ef38c95ULL, 0xe12e13424bb40e13ULL, 0x2865a5f206b06fbaULL,
+                0x8cbccc096f5088cbULL, 0xf93f87b7442e45d4ULL, 0xafebff0bcb24aafeULL, 0xf78f69a51539d749ULL,
+                0xdbe6fecebdedd5beULL, 0xb573440e5a884d1cULL, 0x89705f4136b4a597ULL, 0x31680a88f8953031ULL,
+                0xabcc77118461cefcULL, 0xfdc20d2b36ba7c3eULL, 0xd6bf94d5e57a42bcULL, 0x3d32907604691b4dULL,
+                0x8637bd05af6c69b5ULL, 0xa63f9a49c2c1b110ULL, 0xa7c5ac471b478423ULL, 0x0fcf80dc33721d54ULL,
+                0xd1b71758e219652bULL, 0xd3c36113404ea4a9ULL, 0x83126e978d4fdf3bULL, 0x645a1cac083126eaULL,
+                0xa3d70a3d70a3d70aULL, 0x3d70a3d70a3d70a4ULL, 0xccccccccccccccccULL, 0xcccccccccccccccdULL,
+                0x8000000000000000ULL, 0x0000000000000000ULL, 0xa000000000000000ULL, 0x0000000000000000ULL,
+                0xc800000000000000ULL, 0x0000000000000000ULL, 0xfa00000000000000ULL, 0x0000000000000000ULL,
+                0x9c40000000000000ULL, 0x0000000000000000ULL, 0xc350000000000000ULL, 0x0000000000000000ULL,
+                0xf424000000000000ULL, 0x0000000000000000ULL, 0x9896800000000000ULL, 0x0000000000000000ULL,
+                0xbebc200000000000ULL, 0x0000000000000000ULL, 0xee6b280000000000ULL, 0x0000000000000000ULL,
+                0x9502f90000000000ULL, 0x0000000000000000ULL, 0xba43b74000000000ULL, 0x0000000000000000ULL,
+                0xe8d4a51000000000ULL, 0x0000000000000000ULL, 0x9184e72a00000000ULL, 0x0000000000000000ULL,
+                0xb5e620f480000000ULL, 0x0000000000000000ULL, 0xe35fa931a0000000ULL, 0x0000000000000000ULL,
+                0x8e1bc9bf04000000ULL, 0x0000000000000000ULL, 0xb1a2bc2ec5000000ULL, 0x0000000000000000ULL,
+                0xde0b6b3a76400000ULL, 0x0000000000000000ULL, 0x8ac7230489e80000ULL, 0x0000000000000000ULL,
+                0xad78ebc5ac620000ULL, 0x0000000000000000ULL, 0xd8d726b7177a8000ULL, 0x0000000000000000ULL,
+                0x878678326eac9000ULL, 0x0000000000000000ULL, 0xa968163f0a57b400ULL, 0x0000000000000000ULL,
+                0xd3c21bcecceda100ULL, 0x0000000000000000ULL, 0x84595161401484a0ULL, 0x0000000000000000ULL,
+                0xa56fa5b99019a5c8ULL, 0x0000000000000000ULL, 0xcecb8f27f4200f3aULL, 0x0000000000000000ULL,
+                0x813f3978f8940984ULL, 0x4000000000000000ULL, 0xa18f07d736b90be5ULL, 0x5000000000000000ULL,
+                0xc9f2c9cd04674edeULL, 0xa400000000000000ULL, 0xfc6f7c4045812296ULL, 0x4d00000000000000ULL,
+                0x9dc5ada82b70b59dULL, 0xf020000000000000ULL, 0xc5371912364ce305ULL, 0x6c28000000000000ULL,
+                0xf684df56c3e01bc6ULL, 0xc732000000000000ULL, 0x9a130b963a6c115cULL, 0x3c7f400000000000ULL,
+                0xc097ce7bc90715b3ULL, 0x4b9f100000000000ULL, 0xf0bdc21abb48db20ULL, 0x1e86d40000000000ULL,
+                0x96769950b50d88f4ULL, 0x1314448000000000ULL, 0xbc143fa4e250eb31ULL, 0x17d955a000000000ULL,
+                0xeb194f8e1ae525fdULL, 0x5dcfab0800000000ULL, 0x92efd1b8d0cf37beULL, 0x5aa1cae500000000ULL,
+                0xb7abc627050305adULL, 0xf14a3d9e40000000ULL, 0xe596b7b0c643c719ULL, 0x6d9ccd05d0000000ULL,
+                0x8f7e32ce7bea5c6fULL, 0xe4820023a2000000ULL, 0xb35dbf821ae4f38bULL, 0xdda2802c8a800000ULL,
+                0xe0352f62a19e306eULL, 0xd50b2037ad200000ULL, 0x8c213d9da502de45ULL, 0x4526f422cc340000ULL,
+                0xaf298d050e4395d6ULL, 0x9670b12b7f410000ULL, 0xdaf3f04651d47b4cULL, 0x3c0cdd765f114000ULL,
+                0x88d8762bf324cd0fULL, 0xa5880a69fb6ac800ULL, 0xab0e93b6efee0053ULL, 0x8eea0d047a457a00ULL,
+                0xd5d238a4abe98068ULL, 0x72a4904598d6d880ULL, 0x85a36366eb71f041ULL, 0x47a6da2b7f864750ULL,
+                0xa70c3c40a64e6c51ULL, 0x999090b65f67d924ULL, 0xd0cf4b50cfe20765ULL, 0xfff4b4e3f741cf6dULL,
+                0x82818f1281ed449fULL, 0xbff8f10e7a8921a4ULL, 0xa321f2d7226895c7ULL, 0xaff72d52192b6a0dULL,
+                0xcbea6f8ceb02bb39ULL, 0x9bf4f8a69f764490ULL, 0xfee50b7025c36a08ULL, 0x02f236d04753d5b4ULL,
+                0x9f4f2726179a2245ULL, 0x01d762422c946590ULL, 0xc722f0ef9d80aad6ULL, 0x424d3ad2b7b97ef5ULL,
+                0xf8ebad2b84e0d58bULL, 0xd2e0898765a7deb2ULL, 0x9b934c3b330c8577ULL, 0x63cc55f49f88eb2fULL,
+                0xc2781f49ffcfa6d5ULL, 0x3cbf6b71c76b25fbULL, 0xf316271c7fc3908aULL, 0x8bef464e3945ef7aULL,
+                0x97edd871cfda3a56ULL, 0x97758bf0e3cbb5acULL, 0xbde94e8e43d0c8ecULL, 0x3d52eeed1cbea317ULL,
+                0xed63a231d4c4fb27ULL, 0x4ca7aaa863ee4bddULL, 0x945e455f24fb1cf8ULL, 0x8fe8caa93e74ef6aULL,
+                0xb975d6b6ee39e436ULL, 0xb3e2fd538e122b44ULL, 0xe7d34c64a9c85d44ULL, 0x60dbbca87196b616ULL,
+                0x90e40fbeea1d3a4aULL, 0xbc8955e946fe31cdULL, 0xb51d13aea4a488ddULL, 0x6babab6398bdbe41ULL,
+                0xe264589a4dcdab14ULL, 0xc696963c7eed2dd1ULL, 0x8d7eb76070a08aecULL, 0xfc1e1de5cf543ca2ULL,
+                0xb0de65388cc8ada8ULL, 0x3b25a55f43294bcbULL, 0xdd15fe86affad912ULL, 0x49ef0eb713f39ebeULL,
+                0x8a2dbf142dfcc7abULL, 0x6e3569326c784337ULL, 0xacb92ed9397bf996ULL, 0x49c2c37f07965404ULL,
+                0xd7e77a8f87daf7fbULL, 0xdc33745ec97be906ULL, 0x86f0ac99b4e8dafdULL, 0x69a028bb3ded71a3ULL,
+                0xa8acd7c0222311bcULL, 0xc40832ea0d68ce0cULL, 0xd2d80db02aabd62bULL, 0xf50a3fa490c30190ULL,
+                0x83c7088e1aab65dbULL, 0x792667c6da79e0faULL, 0xa4b8cab1a1563f52ULL, 0x577001b891185938ULL,
+                0xcde6fd5e09abcf26ULL, 0xed4c0226b55e6f86ULL, 0x80b05e5ac60b6178ULL, 0x544f8158315b05b4ULL,
+                0xa0dc75f1778e39d6ULL, 0x696361ae3db1c721ULL, 0xc913936dd571c84cULL, 0x03bc3a19cd1e38e9ULL,
+                0xfb5878494ace3a5fULL, 0x04ab48a04065c723ULL, 0x9d174b2dcec0e47bULL, 0x62eb0d64283f9c76ULL,
+                0xc45d1df942711d9aULL, 0x3ba5d0bd324f8394ULL, 0xf5746577930d6500ULL, 0xca8f44ec7ee36479ULL,
+                0x9968bf6abbe85f20ULL, 0x7e998b13cf4e1ecbULL, 0xbfc2ef456ae276e8ULL, 0x9e3fedd8c321a67eULL,
+                0xefb3ab16c59b14a2ULL, 0xc5cfe94ef3ea101eULL, 0x95d04aee3b80ece5ULL, 0xbba1f1d158724a12ULL,
+                0xbb445da9ca61281fULL, 0x2a8a6e45ae8edc97ULL, 0xea1575143cf97226ULL, 0xf52d09d71a3293bdULL,
+                0x924d692ca61be758ULL, 0x593c2626705f9c56ULL, 0xb6e0c377cfa2e12eULL, 0x6f8b2fb00c77836cULL,
+                0xe498f455c38b997aULL, 0x0b6dfb9c0f956447ULL, 0x8edf98b59a373fecULL, 0x4724bd4189bd5eacULL,
+                0xb2977ee300c50fe7ULL, 0x58edec91ec2cb657ULL, 0xdf3d5e9bc0f653e1ULL, 0x2f2967b66737e3edULL,
+                0x8b865b215899f46cULL, 0xbd79e0d20082ee74ULL, 0xae67f1e9aec07187ULL, 0xecd8590680a3aa11ULL,
+                0xda01ee641a708de9ULL, 0xe80e6f4820cc9495ULL, 0x884134fe908658b2ULL, 0x3109058d147fdcddULL,
+                0xaa51823e34a7eedeULL, 0xbd4b46f0599fd415ULL, 0xd4e5e2cdc1d1ea96ULL, 0x6c9e18ac7007c91aULL,
+                0x850fadc09923329eULL, 0x03e2cf6bc604ddb0ULL, 0xa6539930bf6bff45ULL, 0x84db8346b786151cULL,
+                0xcfe87f7cef46ff16ULL, 0xe612641865679a63ULL, 0x81f14fae158c5f6eULL, 0x4fcb7e8f3f60c07eULL,
+                0xa26da3999aef7749ULL, 0xe3be5e330f38f09dULL, 0xcb090c8001ab551cULL, 0x5cadf5bfd3072cc5ULL,
+                0xfdcb4fa002162a63ULL, 0x73d9732fc7c8f7f6ULL, 0x9e9f11c4014dda7eULL, 0x2867e7fddcdd9afaULL,
+                0xc646d63501a1511dULL, 0xb281e1fd541501b8ULL, 0xf7d88bc24209a565ULL, 0x1f225a7ca91a4226ULL,
+                0x9ae757596946075fULL, 0x3375788de9b06958ULL, 0xc1a12d2fc3978937ULL, 0x0052d6b1641c83aeULL,
+                0xf209787bb47d6b84ULL, 0xc0678c5dbd23a49aULL, 0x9745eb4d50ce6332ULL, 0xf840b7ba963646e0ULL,
+                0xbd176620a501fbffULL, 0xb650e5a93bc3d898ULL, 0xec5d3fa8ce427affULL, 0xa3e51f138ab4cebeULL,
+                0x93ba47c980e98cdfULL, 0xc66f336c36b10137ULL, 0xb8a8d9bbe123f017ULL, 0xb80b0047445d4184ULL,
+                0xe6d3102ad96cec1dULL, 0xa60dc059157491e5ULL, 0x9043ea1ac7e41392ULL, 0x87c89837ad68db2fULL,
+                0xb454e4a179dd1877ULL, 0x29babe4598c311fbULL, 0xe16a1dc9d8545e94ULL, 0xf4296dd6fef3d67aULL,
+                0x8ce2529e2734bb1dULL, 0x1899e4a65f58660cULL, 0xb01ae745b101e9e4ULL, 0x5ec05dcff72e7f8fULL,
+                0xdc21a1171d42645dULL, 0x76707543f4fa1f73ULL, 0x899504ae72497ebaULL, 0x6a06494a791c53a8ULL,
+                0xabfa45da0edbde69ULL, 0x0487db9d17636892ULL, 0xd6f8d7509292d603ULL, 0x45a9d2845d3c42b6ULL,
+                0x865b86925b9bc5c2ULL, 0x0b8a2392ba45a9b2ULL, 0xa7f26836f282b732ULL, 0x8e6cac7768d7141eULL,
+                0xd1ef0244af2364ffULL, 0x3207d795430cd926ULL, 0x8335616aed761f1fULL, 0x7f44e6bd49e807b8ULL,
+                0xa402b9c5a8d3a6e7ULL, 0x5f16206c9c6209a6ULL, 0xcd036837130890a1ULL, 0x36dba887c37a8c0fULL,
+                0x802221226be55a64ULL, 0xc2494954da2c9789ULL, 0xa02aa96b06deb0fdULL, 0xf2db9baa10b7bd6cULL,
+                0xc83553c5c8965d3dULL, 0x6f92829494e5acc7ULL, 0xfa42a8b73abbf48cULL, 0xcb772339ba1f17f9ULL,
+                0x9c69a97284b578d7ULL, 0xff2a760414536efbULL, 0xc38413cf25e2d70dULL, 0xfef5138519684abaULL,
+                0xf46518c2ef5b8cd1ULL, 0x7eb258665fc25d69ULL, 0x98bf2f79d5993802ULL, 0xef2f773ffbd97a61ULL,
+                0xbeeefb584aff8603ULL, 0xaafb550ffacfd8faULL, 0xeeaaba2e5dbf6784ULL, 0x95ba2a53f983cf38ULL,
+                0x952ab45cfa97a0b2ULL, 0xdd945a747bf26183ULL, 0xba756174393d88dfULL, 0x94f971119aeef9e4ULL,
+                0xe912b9d1478ceb17ULL, 0x7a37cd5601aab85dULL, 0x91abb422ccb812eeULL, 0xac62e055c10ab33aULL,
+                0xb616a12b7fe617aaULL, 0x577b986b314d6009ULL, 0xe39c49765fdf9d94ULL, 0xed5a7e85fda0b80bULL,
+                0x8e41ade9fbebc27dULL, 0x14588f13be847307ULL, 0xb1d219647ae6b31cULL, 0x596eb2d8ae258fc8ULL,
+                0xde469fbd99a05fe3ULL, 0x6fca5f8ed9aef3bbULL, 0x8aec23d680043beeULL, 0x25de7bb9480d5854ULL,
+                0xada72ccc20054ae9ULL, 0xaf561aa79a10ae6aULL, 0xd910f7ff28069da4ULL, 0x1b2ba1518094da04ULL,
+                0x87aa9aff79042286ULL, 0x90fb44d2f05d0842ULL, 0xa99541bf57452b28ULL, 0x353a1607ac744a53ULL,
+                0xd3fa922f2d1675f2ULL, 0x42889b8997915ce8ULL, 0x847c9b5d7c2e09b7ULL, 0x69956135febada11ULL,
+                0xa59bc234db398c25ULL, 0x43fab9837e699095ULL, 0xcf02b2c21207ef2eULL, 0x94f967e45e03f4bbULL,
+                0x8161afb94b44f57dULL, 0x1d1be0eebac278f5ULL, 0xa1ba1ba79e1632dcULL, 0x6462d92a69731732ULL,
+                0xca28a291859bbf93ULL, 0x7d7b8f7503cfdcfeULL, 0xfcb2cb35e702af78ULL, 0x5cda735244c3d43eULL,
+                0x9defbf01b061adabULL, 0x3a0888136afa64a7ULL, 0xc56baec21c7a1916ULL, 0x088aaa1845b8fdd0ULL,
+                0xf6c69a72a3989f5bULL, 0x8aad549e57273d45ULL, 0x9a3c2087a63f6399ULL, 0x36ac54e2f678864bULL,
+                0xc0cb28a98fcf3c7fULL, 0x84576a1bb416a7ddULL, 0xf0fdf2d3f3c30b9fULL, 0x656d44a2a11c51d5ULL,
+                0x969eb7c47859e743ULL, 0x9f644ae5a4b1b325ULL, 0xbc4665b596706114ULL, 0x873d5d9f0dde1feeULL,
+                0xeb57ff22fc0c7959ULL, 0xa90cb506d155a7eaULL, 0x9316ff75dd87cbd8ULL, 0x09a7f12442d588f2ULL,
+                0xb7dcbf5354e9beceULL, 0x0c11ed6d538aeb2fULL, 0xe5d3ef282a242e81ULL, 0x8f1668c8a86da5faULL,
+                0x8fa475791a569d10ULL, 0xf96e017d694487bcULL, 0xb38d92d760ec4455ULL, 0x37c981dcc395a9acULL,
+                0xe070f78d3927556aULL, 0x85bbe253f47b1417ULL, 0x8c469ab843b89562ULL, 0x93956d7478ccec8eULL,
+                0xaf58416654a6babbULL, 0x387ac8d1970027b2ULL, 0xdb2e51bfe9d0696aULL, 0x06997b05fcc0319eULL,
+                0x88fcf317f22241e2ULL, 0x441fece3bdf81f03ULL, 0xab3c2fddeeaad25aULL, 0xd527e81cad7626c3ULL,
+                0xd60b3bd56a5586f1ULL, 0x8a71e223d8d3b074ULL, 0x85c7056562757456ULL, 0xf6872d5667844e49ULL,
+                0xa738c6bebb12d16cULL, 0xb428f8ac016561dbULL, 0xd106f86e69d785c7ULL, 0xe13336d701beba52ULL,
+                0x82a45b450226b39cULL, 0xecc0024661173473ULL, 0xa34d721642b06084ULL, 0x27f002d7f95d0190ULL,
+                0xcc20ce9bd35c78a5ULL, 0x31ec038df7b441f4ULL, 0xff290242c83396ceULL, 0x7e67047175a15271ULL,
+                0x9f79a169bd203e41ULL, 0x0f0062c6e984d386ULL, 0xc75809c42c684dd1ULL, 0x52c07b78a3e60868ULL,
+                0xf92e0c3537826145ULL, 0xa7709a56ccdf8a82ULL, 0x9bbcc7a142b17ccbULL, 0x88a66076400bb691ULL,
+                0xc2abf989935ddbfeULL, 0x6acff893d00ea435ULL, 0xf356f7ebf83552feULL, 0x0583f6b8c4124d43ULL,
+                0x98165af37b2153deULL, 0xc3727a337a8b704aULL, 0xbe1bf1b059e9a8d6ULL, 0x744f18c0592e4c5cULL,
+                0xeda2ee1c7064130cULL, 0x1162def06f79df73ULL, 0x9485d4d1c63e8be7ULL, 0x8addcb5645ac2ba8ULL,
+                0xb9a74a0637ce2ee1ULL, 0x6d953e2bd7173692ULL, 0xe8111c87c5c1ba99ULL, 0xc8fa8db6ccdd0437ULL,
+                0x910ab1d4db9914a0ULL, 0x1d9c9892400a22a2ULL, 0xb54d5e4a127f59c8ULL, 0x2503beb6d00cab4bULL,
+                0xe2a0b5dc971f303aULL, 0x2e44ae64840fd61dULL, 0x8da471a9de737e24ULL, 0x5ceaecfed289e5d2ULL,
+                0xb10d8e1456105dadULL, 0x7425a83e872c5f47ULL, 0xdd50f1996b947518ULL, 0xd12f124e28f77719ULL,
+                0x8a5296ffe33cc92fULL, 0x82bd6b70d99aaa6fULL, 0xace73cbfdc0bfb7bULL, 0x636cc64d1001550bULL,
+                0xd8210befd30efa5aULL, 0x3c47f7e05401aa4eULL, 0x8714a775e3e95c78ULL, 0x65acfaec34810a71ULL,
+                0xa8d9d1535ce3b396ULL, 0x7f1839a741a14d0dULL, 0xd31045a8341ca07cULL, 0x1ede48111209a050ULL,
+                0x83ea2b892091e44dULL, 0x934aed0aab460432ULL, 0xa4e4b66b68b65d60ULL, 0xf81da84d5617853fULL,
+                0xce1de40642e3f4b9ULL, 0x36251260ab9d668eULL, 0x80d2ae83e9ce78f3ULL, 0xc1d72b7c6b426019ULL,
+                0xa1075a24e4421730ULL, 0xb24cf65b8612f81fULL, 0xc94930ae1d529cfcULL, 0xdee033f26797b627ULL,
+                0xfb9b7cd9a4a7443cULL, 0x169840ef017da3b1ULL, 0x9d412e0806e88aa5ULL, 0x8e1f289560ee864eULL,
+                0xc491798a08a2ad4eULL, 0xf1a6f2bab92a27e2ULL, 0xf5b5d7ec8acb58a2ULL, 0xae10af696774b1dbULL,
+                0x9991a6f3d6bf1765ULL, 0xacca6da1e0a8ef29ULL, 0xbff610b0cc6edd3fULL, 0x17fd090a58d32af3ULL,
+                0xeff394dcff8a948eULL, 0xddfc4b4cef07f5b0ULL, 0x95f83d0a1fb69cd9ULL, 0x4abdaf101564f98eULL,
+                0xbb764c4ca7a4440fULL, 0x9d6d1ad41abe37f1ULL, 0xea53df5fd18d5513ULL, 0x84c86189216dc5edULL,
+                0x92746b9be2f8552cULL, 0x32fd3cf5b4e49bb4ULL, 0xb7118682dbb66a77ULL, 0x3fbc8c33221dc2a1ULL,
+                0xe4d5e82392a40515ULL, 0x0fabaf3feaa5334aULL, 0x8f05b1163ba6832dULL, 0x29cb4d87f2a7400eULL,
+                0xb2c71d5bca9023f8ULL, 0x743e20e9ef511012ULL, 0xdf78e4b2bd342cf6ULL, 0x914da9246b255416ULL,
+                0x8bab8eefb6409c1aULL, 0x1ad089b6c2f7548eULL, 0xae9672aba3d0c320ULL, 0xa184ac2473b529b1ULL,
+                0xda3c0f568cc4f3e8ULL, 0xc9e5d72d90a2741eULL, 0x8865899617fb1871ULL, 0x7e2fa67c7a658892ULL,
+                0xaa7eebfb9df9de8dULL, 0xddbb901b98feeab7ULL, 0xd51ea6fa85785631ULL, 0x552a74227f3ea565ULL,
+                0x8533285c936b35deULL, 0xd53a88958f87275fULL, 0xa67ff273b8460356ULL, 0x8a892abaf368f137ULL,
+                0xd01fef10a657842cULL, 0x2d2b7569b0432d85ULL, 0x8213f56a67f6b29bULL, 0x9c3b29620e29fc73ULL,
+                0xa298f2c501f45f42ULL, 0x8349f3ba91b47b8fULL, 0xcb3f2f7642717713ULL, 0x241c70a936219a73ULL,
+                0xfe0efb53d30dd4d7ULL, 0xed238cd383aa0110ULL, 0x9ec95d1463e8a506ULL, 0xf4363804324a40aaULL,
+                0xc67bb4597ce2ce48ULL, 0xb143c6053edcd0d5ULL, 0xf81aa16fdc1b81daULL, 0xdd94b7868e94050aULL,
+                0x9b10a4e5e9913128ULL, 0xca7cf2b4191c8326ULL, 0xc1d4ce1f63f57d72ULL, 0xfd1c2f611f63a3f0ULL,
+                0xf24a01a73cf2dccfULL, 0xbc633b39673c8cecULL, 0x976e41088617ca01ULL, 0xd5be0503e085d813ULL,
+                0xbd49d14aa79dbc82ULL, 0x4b2d8644d8a74e18ULL, 0xec9c459d51852ba2ULL, 0xddf8e7d60ed1219eULL,
+                0x93e1ab8252f33b45ULL, 0xcabb90e5c942b503ULL, 0xb8da1662e7b00a17ULL, 0x3d6a751f3b936243ULL,
+                0xe7109bfba19c0c9dULL, 0x0cc512670a783ad4ULL, 0x906a617d450187e2ULL, 0x27fb2b80668b24c5ULL,
+                0xb484f9dc9641e9daULL, 0xb1f9f660802dedf6ULL, 0xe1a63853bbd26451ULL, 0x5e7873f8a0396973ULL,
+                0x8d07e33455637eb2ULL, 0xdb0b487b6423e1e8ULL, 0xb049dc016abc5e5fULL, 0x91ce1a9a3d2cda62ULL,
+                0xdc5c5301c56b75f7ULL, 0x7641a140cc7810fbULL, 0x89b9b3e11b6329baULL, 0xa9e904c87fcb0a9dULL,
+                0xac2820d9623bf429ULL, 0x546345fa9fbdcd44ULL, 0xd732290fbacaf133ULL, 0xa97c177947ad4095ULL,
+                0x867f59a9d4bed6c0ULL, 0x49ed8eabcccc485dULL, 0xa81f301449ee8c70ULL, 0x5c68f256bfff5a74ULL,
+                0xd226fc195c6a2f8cULL, 0x73832eec6fff3111ULL, 0x83585d8fd9c25db7ULL, 0xc831fd53c5ff7eabULL,
+                0xa42e74f3d032f525ULL, 0xba3e7ca8b77f5e55ULL, 0xcd3a1230c43fb26fULL, 0x28ce1bd2e55f35ebULL,
+                0x80444b5e7aa7cf85ULL, 0x7980d163cf5b81b3ULL, 0xa0555e361951c366ULL, 0xd7e105bcc332621fULL,
+                0xc86ab5c39fa63440ULL, 0x8dd9472bf3fefaa7ULL, 0xfa856334878fc150ULL, 0xb14f98f6f0feb951ULL,
+                0x9c935e00d4b9d8d2ULL, 0x6ed1bf9a569f33d3ULL, 0xc3b8358109e84f07ULL, 0x0a862f80ec4700c8ULL,
+                0xf4a642e14c6262c8ULL, 0xcd27bb612758c0faULL, 0x98e7e9cccfbd7dbdULL, 0x8038d51cb897789cULL,
+                0xbf21e44003acdd2cULL, 0xe0470a63e6bd56c3ULL, 0xeeea5d5004981478ULL, 0x1858ccfce06cac74ULL,
+                0x95527a5202df0ccbULL, 0x0f37801e0c43ebc8ULL, 0xbaa718e68396cffdULL, 0xd30560258f54e6baULL,
+                0xe950df20247c83fdULL, 0x47c6b82ef32a2069ULL, 0x91d28b7416cdd27eULL, 0x4cdc331d57fa5441ULL,
+                0xb6472e511c81471dULL, 0xe0133fe4adf8e952ULL, 0xe3d8f9e563a198e5ULL, 0x58180fddd97723a6ULL,
+                0x8e679c2f5e44ff8fULL, 0x570f09eaa7ea7648ULL
             };
-            
-            Type type;
-            std::string value;
-            std::string raw_value;  // Original value before processing
-            
-            Token(Type t, const std::string& val, const std::string& raw_val = "")
-                : type(t), value(val), raw_value(raw_val.empty() ? val : raw_val) {}
+            return table;
+        }
+        
+        // 64x64→128ビットの乗算（128ビット整数がない環境では32ビットずつ計算）
+        struct Product128 {
+            uint64_t high;
+            uint64_t low;
         };
         
-        // Tokenizer: コマンドライン引数のトークン化
-        class Tokenizer {
-        private:
-            std::vector<Token> tokens_;
-            size_t current_index_;
-            bool end_of_options_;
+        inline Product128 multiply_full(uint64_t a, uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+            __extension__ typedef unsigned __int128 uint128;
+            uint128 product = static_cast<uint128>(a) * b;
+            Product128 result;
+            result.high = static_cast<uint64_t>(product >> 64);
+            result.low = static_cast<uint64_t>(product);
+            return result;
+#else
+            uint64_t a_low = a & 0xFFFFFFFFULL;
+            uint64_t a_high = a >> 32;
+            uint64_t b_low = b & 0xFFFFFFFFULL;
+            uint64_t b_high = b >> 32;
             
-        public:
-            // Constructor
-            Tokenizer() : current_index_(0), end_of_options_(false) {}
+            uint64_t low_low = a_low * b_low;
+            uint64_t high_low = a_high * b_low;
+            uint64_t low_high = a_low * b_high;
+            uint64_t cross = (low_low >> 32) + (high_low & 0xFFFFFFFFULL) + low_high;
+            
+            Product128 result;
+            result.high = a_high * b_high + (high_low >> 32) + (cross >> 32);
+            result.low = (cross << 32) | (low_low & 0xFFFFFFFFULL);
+            return result;
+#endif
+        }
+        
+        inline int count_leading_zeros(uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+            return value == 0 ? 64 : __builtin_clzll(value);
+#else
+            int count = 0;
+            for (uint64_t bit = uint64_t(1) << 63; bit != 0 && !(value & bit); bit >>= 1) {
+                ++count;
+            }
+            return count;
+#endif
+        }
+        
+        // 2進浮動小数点形式ごとの定数
+        template<typename T>
+        struct FloatFormat;
+        
+        template<>
+        struct FloatFormat<double> {
+            typedef uint64_t Bits;
+            enum {
+                mantissa_bits = 52,
+                exponent_bits = 11,
+                minimum_exponent = -1023,
+                infinite_power = 0x7FF,
+                smallest_power_of_ten = -342,
+                largest_power_of_ten = 308,
+                min_round_to_even = -4,
+                max_round_to_even = 23,
+                max_exact_power = 22      // 10^22 まではdoubleで正確に表せる
+            };
+            static double exact_power_of_ten(int exponent) {
+                static const double powers[] = {
+                    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+                };
+                return powers[exponent];
+            }
+        };
+        
+        template<>
+        struct FloatFormat<float> {
+            typedef uint32_t Bits;
+            enum {
+                mantissa_bits = 23,
+                exponent_bits = 8,
+                minimum_exponent = -127,
+                infinite_power = 0xFF,
+                smallest_power_of_ten = -65,
+                largest_power_of_ten = 38,
+                min_round_to_even = -17,
+                max_round_to_even = 10,
+                max_exact_power = 10
+            };
+            static float exact_power_of_ten(int exponent) {
+                static const float powers[] = {1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f};
+                return powers[exponent];
+            }
+        };
+        
+        // 丸め済みの仮数部と2進指数（バイアス込み）
+        struct BinaryFloat {
+            uint64_t mantissa;
+            int power2;
+            
+            bool operator==(const BinaryFloat& other) const {
+                return mantissa == other.mantissa && power2 == other.power2;
+            }
+            bool operator!=(const BinaryFloat& other) const { return !(*this == other); }
+        };
+        
+        // Eisel–Lemire 法：w × 10^q を最も近い浮動小数点数に丸める（w は19桁以内）
+        template<typename T>
+        BinaryFloat eisel_lemire(int q, uint64_t w) {
+            typedef FloatFormat<T> Format;
+            BinaryFloat answer;
+            if (w == 0 || q < Format::smallest_power_of_ten) {
+                answer.mantissa = 0;
+                answer.power2 = 0;
+                return answer;
+            }
+            if (q > Format::largest_power_of_ten) {
+                answer.mantissa = 0;
+                answer.power2 = Format::infinite_power;
+                return answer;
+            }
+            
+            int leading_zeros = count_leading_zeros(w);
+            w <<= leading_zeros;
+            
+            // w と 5^q の上位ビットの積（必要な精度が得られない場合のみ下位64ビットも使う）
+            const int bit_precision = Format::mantissa_bits + 3;
+            const uint64_t* power = power_of_five_128() + 2 * (q - FloatFormat<double>::smallest_power_of_ten);
+            Product128 product = multiply_full(w, power[0]);
+            const uint64_t precision_mask = ~uint64_t(0) >> bit_precision;
+            if ((product.high & precision_mask) == precision_mask) {
+                Product128 second = multiply_full(w, power[1]);
+                product.low += second.high;
+                if (second.high > product.low) {
+                    ++product.high;
+                }
+            }
+            
+            int upper_bit = static_cast<int>(product.high >> 63);
+            int shift = upper_bit + 64 - Format::mantissa_bits - 3;
+            answer.mantissa = product.high >> shift;
+            // floor(log2(10^q)) + 63 を整数演算で求める
+            int power_of_two = (((152170 + 65536) * q) >> 16) + 63;
+            answer.power2 = power_of_two + upper_bit - leading_zeros - Format::minimum_exponent;
+            
+            if (answer.power2 <= 0) {
+                // 非正規化数
+                if (-answer.power2 + 1 >= 64) {
+                    answer.mantissa = 0;
+                    answer.power2 = 0;
+                    return answer;
+                }
+                answer.mantissa >>= -answer.power2 + 1;
+                answer.mantissa += (answer.mantissa & 1);
+                answer.mantissa >>= 1;
+                // 丸めの結果、正規化数の最小値に達する場合がある
+                answer.power2 = answer.mantissa < (uint64_t(1) << Format::mantissa_bits) ? 0 : 1;
+                return answer;
+            }
+            
+            // ちょうど中間の値は偶数側へ丸める
+            if (product.low <= 1 && q >= Format::min_round_to_even && q <= Format::max_round_to_even &&
+                (answer.mantissa & 3) == 1 && (answer.mantissa << shift) == product.high) {
+                answer.mantissa &= ~uint64_t(1);
+            }
+            
+            answer.mantissa += (answer.mantissa & 1);
+            answer.mantissa >>= 1;
+            if (answer.mantissa >= (uint64_t(2) << Format::mantissa_bits)) {
+                answer.mantissa = uint64_t(1) << Format::mantissa_bits;
+                ++answer.power2;
+            }
+            answer.mantissa &= ~(uint64_t(1) << Format::mantissa_bits);
+            
+            if (answer.power2 >= Format::infinite_power) {
+                answer.mantissa = 0;
+                answer.power2 = Format::infinite_power;
+            }
+            return answer;
+        }
+        
+        // 多倍長の10進数（0.d[0]d[1]... × 10^decimal_point）
+        // 丸め方向が確定しない長い入力のための正確だが低速な経路
+        class BigDecimal {
+        private:
+            enum : int { MAX_DIGITS = 800, MAX_SHIFT = 60 };
+            
+            unsigned char digits_[MAX_DIGITS];
+            int count_;
+            int decimal_point_;
+            bool truncated_;  // 保持しきれない非ゼロの桁がある
+            
+        public:
+            // 数値部分（符号なし、検証済み）を読み込む
+            explicit BigDecimal(StringView text) : count_(0), decimal_point_(0), truncated_(false) {
+                bool saw_dot = false;
+                size_t pos = 0;
+                for (; pos < text.size(); ++pos) {
+                    char c = text[pos];
+                    if (c == '.') {
+                        saw_dot = true;
+                        decimal_point_ = count_;
+                        continue;
+                    }
+                    if (c < '0' || c > '9') {
+                        break;
+                    }
+                    if (c == '0' && count_ == 0) {
+                        --decimal_point_;  // 先頭の0
+                        continue;
+                    }
+                    if (count_ < MAX_DIGITS) {
+                        digits_[count_++] = static_cast<unsigned char>(c - '0');
+                    } else if (c != '0') {
+                        truncated_ = true;
+                    }
+                }
+                if (!saw_dot) {
+                    decimal_point_ = count_;
+                }
+                
+                if (pos < text.size()) {
+                    // 指数部（検証済み、大きすぎる値は結果に影響しない範囲で打ち切る）
+                    ++pos;
+                    int sign = 1;
+                    if (text[pos] == '+' || text[pos] == '-') {
+                        sign = text[pos] == '-' ? -1 : 1;
+                        ++pos;
+                    }
+                    int exponent = 0;
+                    for (; pos < text.size(); ++pos) {
+                        if (exponent < 10000) {
+                            exponent = exponent * 10 + (text[pos] - '0');
+                        }
+                    }
+                    decimal_point_ += sign * exponent;
+                }
+                _trim();
+            }
+            
+            // 最も近い浮動小数点数に変換（オーバーフロー時はfalse、結果は無限大）
+            template<typename T>
+            bool to_binary(BinaryFloat& answer) {
+                typedef FloatFormat<T> Format;
+                static const int powers[] = {1, 3, 6, 9, 13, 16, 19, 23, 26};  // 10^n < 2^powers[n]
+                const int bias = Format::minimum_exponent;
+                
+                answer.mantissa = 0;
+                answer.power2 = 0;
+                if (count_ == 0 || decimal_point_ < -330) {
+                    return true;  // ゼロ
+                }
+                if (decimal_point_ > 310) {
+                    answer.power2 = Format::infinite_power;
+                    return false;
+                }
+                
+                // [0.5, 1) の範囲になるまで2の冪で割る・掛ける
+                int exponent = 0;
+                while (decimal_point_ > 0) {
+                    int n = decimal_point_ >= 9 ? 27 : powers[decimal_point_];
+                    _shift(-n);
+                    exponent += n;
+                }
+                while (decimal_point_ < 0 || (decimal_point_ == 0 && digits_[0] < 5)) {
+                    int n = -decimal_point_ >= 9 ? 27 : powers[-decimal_point_];
+                    _shift(n);
+                    exponent -= n;
+                }
+                --exponent;
+                
+                // 表現できる最小の指数より小さければ非正規化数
+                if (exponent < bias + 1) {
+                    int n = bias + 1 - exponent;
+                    _shift(-n);
+                    exponent += n;
+                }
+                if (exponent - bias >= Format::infinite_power) {
+                    answer.power2 = Format::infinite_power;
+                    return false;
+                }
+                
+                _shift(1 + Format::mantissa_bits);
+                uint64_t mantissa = _rounded_integer();
+                if (mantissa == (uint64_t(2) << Format::mantissa_bits)) {
+                    mantissa >>= 1;
+                    ++exponent;
+                    if (exponent - bias >= Format::infinite_power) {
+                        answer.power2 = Format::infinite_power;
+                        return false;
+                    }
+                }
+                if (!(mantissa & (uint64_t(1) << Format::mantissa_bits))) {
+                    exponent = bias;  // 非正規化数
+                }
+                
+                answer.mantissa = mantissa & ((uint64_t(1) << Format::mantissa_bits) - 1);
+                answer.power2 = exponent - bias;
+                return true;
+            }
+            
+        private:
+            void _trim() {
+                while (count_ > 0 && digits_[count_ - 1] == 0) {
+                    --count_;
+                }
+                if (count_ == 0) {
+                    decimal_point_ = 0;
+                }
+            }
+            
+            void _shift(int k) {
+                while (k > MAX_SHIFT) {
+                    _left_shift(MAX_SHIFT);
+                    k -= MAX_SHIFT;
+                }
+                if (k > 0) {
+                    _left_shift(k);
+                }
+                while (k < -MAX_SHIFT) {
+                    _right_shift(MAX_SHIFT);
+                    k += MAX_SHIFT;
+                }
+                if (k < 0) {
+                    _right_shift(-k);
+                }
+            }
+            
+            // 2^k 倍
+            void _left_shift(int k) {
+                if (count_ == 0) {
+                    return;
+                }
+                // 増える桁数を先に求める
+                uint64_t n = 0;
+                for (int r = count_ - 1; r >= 0; --r) {
+                    n = (n + (uint64_t(digits_[r]) << k)) / 10;
+                }
+                int delta = 0;
+                for (; n > 0; n /= 10) {
+                    ++delta;
+                }
+                
+                int w = count_ + delta;
+                n = 0;
+                for (int r = count_ - 1; r >= 0; --r) {
+                    n += uint64_t(digits_[r]) << k;
+                    uint64_t quotient = n / 10;
+                    uint64_t remainder = n - 10 * quotient;
+                    --w;
+                    if (w < MAX_DIGITS) {
+                        digits_[w] = static_cast<unsigned char>(remainder);
+                    } else if (remainder != 0) {
+                        truncated_ = true;
+                    }
+                    n = quotient;
+                }
+                while (n > 0) {
+                    uint64_t quotient = n / 10;
+                    uint64_t remainder = n - 10 * quotient;
+                    --w;
+                    if (w < MAX_DIGITS) {
+                        digits_[w] = static_cast<unsigned char>(remainder);
+                    } else if (remainder != 0) {
+                        truncated_ = true;
+                    }
+                    n = quotient;
+                }
+                count_ = std::min(count_ + delta, static_cast<int>(MAX_DIGITS));
+                decimal_point_ += delta;
+                _trim();
+            }
+            
+            // 2^k で割る
+            void _right_shift(int k) {
+                int r = 0;
+                int w = 0;
+                uint64_t n = 0;
+                for (; (n >> k) == 0; ++r) {
+                    if (r >= count_) {
+                        if (n == 0) {
+                            count_ = 0;
+                            return;
+                        }
+                        while ((n >> k) == 0) {
+                            n *= 10;
+                            ++r;
+                        }
+                        break;
+                    }
+                    n = n * 10 + digits_[r];
+                }
+                decimal_point_ -= r - 1;
+                
+                const uint64_t mask = (uint64_t(1) << k) - 1;
+                for (; r < count_; ++r) {
+                    uint64_t digit = n >> k;
+                    n &= mask;
+                    digits_[w++] = static_cast<unsigned char>(digit);
+                    n = n * 10 + digits_[r];
+                }
+                while (n > 0) {
+                    uint64_t digit = n >> k;
+                    n &= mask;
+                    if (w < MAX_DIGITS) {
+                        digits_[w++] = static_cast<unsigned char>(digit);
+                    } else if (digit > 0) {
+                        truncated_ = true;
+                    }
+                    n *= 10;
+                }
+                count_ = w;
+                _trim();
+            }
+            
+            // 整数部分を最近接偶数丸めで取り出す
+            uint64_t _rounded_integer() const {
+                if (decimal_point_ > 20) {
+                    return ~uint64_t(0);
+                }
+                int i = 0;
+                uint64_t n = 0;
+                for (; i < decimal_point_ && i < count_; ++i) {
+                    n = n * 10 + digits_[i];
+                }
+                for (; i < decimal_point_; ++i) {
+                    n *= 10;
+                }
+                if (_should_round_up(decimal_point_)) {
+                    ++n;
+                }
+                return n;
+            }
+            
+            bool _should_round_up(int position) const {
+                if (position < 0 || position >= count_) {
+                    return false;
+                }
+                if (digits_[position] == 5 && position + 1 == count_) {
+                    // ちょうど中間：打ち切った桁があれば切り上げ、なければ偶数へ
+                    if (truncated_) {
+                        return true;
+                    }
+                    return position > 0 && digits_[position - 1] % 2 == 1;
+                }
+                return digits_[position] >= 5;
+            }
+        };
+        
+        // 仮数部・指数からビット列を組み立てる
+        template<typename T>
+        T assemble_float(const BinaryFloat& value, bool negative) {
+            typedef typename FloatFormat<T>::Bits Bits;
+            Bits bits = static_cast<Bits>(value.mantissa) |
+                        (static_cast<Bits>(value.power2) << FloatFormat<T>::mantissa_bits);
+            if (negative) {
+                bits |= Bits(1) << (sizeof(Bits) * 8 - 1);
+            }
+            T result;
+            std::memcpy(&result, &bits, sizeof(result));
+            return result;
+        }
+        
+        // 大文字小文字を区別しない比較（word は小文字で与える。inf/nan や bool の判定用）
+        inline bool equals_ignore_case(StringView text, const char* word) {
+            size_t length = std::strlen(word);
+            if (text.size() != length) {
+                return false;
+            }
+            for (size_t i = 0; i < length; ++i) {
+                char c = text[i];
+                if (c >= 'A' && c <= 'Z') {
+                    c = static_cast<char>(c - 'A' + 'a');
+                }
+                if (c != word[i]) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        
+        // 浮動小数点数の解析（確保なし・ロケール非依存、例外を送出せずエラーコードを返す）
+        // [符号] 数字 [. 数字] [e [符号] 数字] の10進表記と inf/infinity/nan を受け付け、
+        // T（float または double）へ最近接偶数丸めで正確に変換する。失敗時 out は変更しない
+        template<typename T>
+        NumberError parse_float(StringView text, T& out) {
+            typedef FloatFormat<T> Format;
+            
+            text = trim_view(text);
+            if (text.empty()) {
+                return NumberError::EMPTY;
+            }
+            
+            size_t pos = 0;
+            bool negative = false;
+            if (text[0] == '+' || text[0] == '-') {
+                negative = text[0] == '-';
+                ++pos;
+            }
+            
+            StringView body = text.substr(pos);
+            if (equals_ignore_case(body, "inf") || equals_ignore_case(body, "infinity")) {
+                out = negative ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::infinity();
+                return NumberError::NONE;
+            }
+            if (equals_ignore_case(body, "nan")) {
+                out = std::numeric_limits<T>::quiet_NaN();
+                return NumberError::NONE;
+            }
+            
+            // 有効数字を先頭から最大19桁まで w に集め、残りは指数で表す
+            uint64_t w = 0;
+            int significant = 0;
+            long long exponent = 0;
+            bool truncated = false;
+            bool any_digit = false;
+            for (; pos < text.size() && text[pos] >= '0' && text[pos] <= '9'; ++pos) {
+                unsigned digit = static_cast<unsigned>(text[pos] - '0');
+                any_digit = true;
+                if (significant == 0 && digit == 0) {
+                    continue;
+                }
+                if (significant < 19) {
+                    w = w * 10 + digit;
+                    ++significant;
+                } else {
+                    ++exponent;
+                    truncated = truncated || digit != 0;
+                }
+            }
+            if (pos < text.size() && text[pos] == '.') {
+                ++pos;
+                for (; pos < text.size() && text[pos] >= '0' && text[pos] <= '9'; ++pos) {
+                    unsigned digit = static_cast<unsigned>(text[pos] - '0');
+                    any_digit = true;
+                    if (significant == 0 && digit == 0) {
+                        --exponent;
+                    } else if (significant < 19) {
+                        w = w * 10 + digit;
+                        ++significant;
+                        --exponent;
+                    } else {
+                        truncated = truncated || digit != 0;
+                    }
+                }
+            }
+            if (!any_digit) {
+                return NumberError::INVALID;
+            }
+            
+            if (pos < text.size() && (text[pos] == 'e' || text[pos] == 'E')) {
+                ++pos;
+                bool negative_exponent = false;
+                if (pos < text.size() && (text[pos] == '+' || text[pos] == '-')) {
+                    negative_exponent = text[pos] == '-';
+                    ++pos;
+                }
+                if (pos >= text.size()) {
+                    return NumberError::INVALID;
+                }
+                long long value = 0;
+                for (; pos < text.size() && text[pos] >= '0' && text[pos] <= '9'; ++pos) {
+                    if (value < 100000) {
+                        value = value * 10 + (text[pos] - '0');
+                    }
+                }
+                exponent += negative_exponent ? -value : value;
+            }
+            if (pos != text.size()) {
+                return NumberError::INVALID;
+            }
+            
+            if (w == 0) {
+                out = negative ? -T(0) : T(0);
+                return NumberError::NONE;
+            }
+            
+            // Clinger の高速経路：仮数と10の冪がどちらも正確に表せれば1回の演算で正しく丸まる
+            if (!truncated && exponent >= -Format::max_exact_power && exponent <= Format::max_exact_power &&
+                w <= (uint64_t(1) << (Format::mantissa_bits + 1))) {
+                T value = static_cast<T>(w);
+                if (exponent < 0) {
+                    value = value / Format::exact_power_of_ten(static_cast<int>(-exponent));
+                } else {
+                    value = value * Format::exact_power_of_ten(static_cast<int>(exponent));
+                }
+                out = negative ? -value : value;
+                return NumberError::NONE;
+            }
+            
+            int q = static_cast<int>(std::max(-100000LL, std::min(100000LL, exponent)));
+            BinaryFloat result = eisel_lemire<T>(q, w);
+            if (truncated && result != eisel_lemire<T>(q, w + 1)) {
+                // 省略した桁によって丸め方向が変わるため、全桁で計算し直す
+                BigDecimal decimal(text.substr(negative || text[0] == '+' ? 1 : 0));
+                decimal.to_binary<T>(result);
+            }
+            
+            if (result.power2 == Format::infinite_power) {
+                return NumberError::OUT_OF_RANGE;
+            }
+            out = assemble_float<T>(result, negative);
+            return NumberError::NONE;
+        }
+        
+        // ---- 単位付きの値（バイト数・時間・レート）の解析 ----
+        // 数値部分は仮数 × 10^-桁数 として読み、単位の比率と約分してから掛けるため、
+        // 途中で桁あふれせずに端数（INEXACT）と範囲外（OUT_OF_RANGE）を正確に判定できる
+        
+        inline uint64_t gcd_u64(uint64_t a, uint64_t b) {
+            while (b != 0) {
+                uint64_t rest = a % b;
+                a = b;
+                b = rest;
+            }
+            return a;
+        }
+        
+        // a × b（桁あふれすればfalse）
+        inline bool multiply_checked(uint64_t a, uint64_t b, uint64_t& out) {
+            if (a != 0 && b > std::numeric_limits<uint64_t>::max() / a) {
+                return false;
+            }
+            out = a * b;
+            return true;
+        }
+        
+        // 10進の数値部分（符号なし）：値 = mantissa × 10^-fraction_digits
+        struct DecimalMantissa {
+            uint64_t mantissa;
+            unsigned fraction_digits;
+        };
+        
+        // pos から [0-9]*(.[0-9]*)? を読む（確保なし）。小数部末尾の0は無視する
+        // 整数部が64ビットに収まらなければ OUT_OF_RANGE。整数部は収まるが小数部まで含めた仮数が
+        // 収まらない、または小数部が19桁を超える場合は、単位を掛けても整数にならないため INEXACT
+        inline NumberError scan_decimal(StringView text, size_t& pos, DecimalMantissa& out) {
+            out.mantissa = 0;  // 失敗時も out を未初期化のまま返さない
+            out.fraction_digits = 0;
+            uint64_t mantissa = 0;
+            bool overflow = false;
+            bool any_digit = false;
+            for (; pos < text.size() && text[pos] >= '0' && text[pos] <= '9'; ++pos) {
+                any_digit = true;
+                if (!multiply_checked(mantissa, 10, mantissa) ||
+                    mantissa > std::numeric_limits<uint64_t>::max() - static_cast<unsigned>(text[pos] - '0')) {
+                    overflow = true;
+                } else {
+                    mantissa += static_cast<unsigned>(text[pos] - '0');
+                }
+            }
+            
+            unsigned fraction_digits = 0;
+            bool inexact = false;
+            if (pos < text.size() && text[pos] == '.') {
+                ++pos;
+                size_t fraction_begin = pos;
+                while (pos < text.size() && text[pos] >= '0' && text[pos] <= '9') {
+                    ++pos;
+                }
+                any_digit = any_digit || pos > fraction_begin;
+                size_t fraction_end = pos;
+                while (fraction_end > fraction_begin && text[fraction_end - 1] == '0') {
+                    --fraction_end;
+                }
+                inexact = fraction_end - fraction_begin > 19;
+                for (size_t i = fraction_begin; i < fraction_end && !overflow && !inexact; ++i) {
+                    uint64_t shifted = 0;
+                    if (!multiply_checked(mantissa, 10, shifted) ||
+                        shifted > std::numeric_limits<uint64_t>::max() - static_cast<unsigned>(text[i] - '0')) {
+                        inexact = true;
+                    } else {
+                        mantissa = shifted + static_cast<unsigned>(text[i] - '0');
+                        ++fraction_digits;
+                    }
+                }
+            }
+            
+            if (!any_digit) {
+                return NumberError::INVALID;
+            }
+            if (overflow) {
+                return NumberError::OUT_OF_RANGE;
+            }
+            if (inexact) {
+                return NumberError::INEXACT;
+            }
+            out.mantissa = mantissa;
+            out.fraction_digits = fraction_digits;
+            return NumberError::NONE;
+        }
+        
+        // value × numerator / denominator を整数として正確に求める（limit を超えれば OUT_OF_RANGE）
+        inline NumberError scale_decimal(DecimalMantissa value, uint64_t numerator, uint64_t denominator,
+                                         uint64_t limit, uint64_t& out) {
+            uint64_t mantissa = value.mantissa;
+            if (value.fraction_digits == 0 && denominator == 1) {
+                // 整数 × 整数倍の単位（"64MiB", "30s" → ms 等）は約分不要
+                uint64_t result = 0;
+                if (!multiply_checked(mantissa, numerator, result) || result > limit) {
+                    return NumberError::OUT_OF_RANGE;
+                }
+                out = result;
+                return NumberError::NONE;
+            }
+            uint64_t power = 1;
+            for (unsigned i = 0; i < value.fraction_digits; ++i) {
+                power *= 10;
+            }
+            
+            // 約分後、mantissa と numerator はどちらも power・denominator と互いに素になる
+            uint64_t common = gcd_u64(mantissa, power);
+            mantissa /= common;
+            power /= common;
+            common = gcd_u64(mantissa, denominator);
+            mantissa /= common;
+            denominator /= common;
+            common = gcd_u64(numerator, power);
+            numerator /= common;
+            power /= common;
+            common = gcd_u64(numerator, denominator);
+            numerator /= common;
+            denominator /= common;
+            
+            if (mantissa == 0) {
+                out = 0;
+                return NumberError::NONE;
+            }
+            if (power != 1 || denominator != 1) {
+                return NumberError::INEXACT;
+            }
+            uint64_t result = 0;
+            if (!multiply_checked(mantissa, numerator, result) || result > limit) {
+                return NumberError::OUT_OF_RANGE;
+            }
+            out = result;
+            return NumberError::NONE;
+        }
+        
+        // 数値と単位の間の空白を読み飛ばす
+        inline void skip_blanks(StringView text, size_t& pos) {
+            while (pos < text.size() && (text[pos] == ' ' || text[pos] == '\t')) {
+                ++pos;
+            }
+        }
+        
+        // バイト数の解析："4096", "64MiB", "1.5GB", "10 kB"
+        // SI接頭辞 k/M/G/T/P/E は1000の冪、IEC接頭辞 Ki/Mi/... は1024の冪（大文字小文字を問わず、末尾のBは省略可）
+        inline NumberError parse_byte_size(StringView text, uint64_t& out) {
+            text = trim_view(text);
+            if (text.empty()) {
+                return NumberError::EMPTY;
+            }
+            
+            size_t pos = text[0] == '+' ? 1 : 0;
+            DecimalMantissa number;
+            NumberError error = scan_decimal(text, pos, number);
+            if (error == NumberError::INVALID) {
+                return error;
+            }
+            skip_blanks(text, pos);
+            
+            uint64_t multiplier = 1;
+            if (pos < text.size() && (text[pos] | 0x20) != 'b') {
+                static const char prefixes[] = "kmgtpe";
+                const char* found = std::strchr(prefixes, text[pos] | 0x20);
+                if (!found || *found == '\0') {
+                    return NumberError::INVALID;
+                }
+                ++pos;
+                uint64_t base = 1000;
+                if (pos < text.size() && (text[pos] | 0x20) == 'i') {
+                    base = 1024;
+                    ++pos;
+                }
+                for (const char* p = prefixes; p <= found; ++p) {
+                    multiplier *= base;
+                }
+            }
+            if (pos < text.size() && (text[pos] | 0x20) == 'b') {
+                ++pos;
+            }
+            if (pos != text.size()) {
+                return NumberError::INVALID;
+            }
+            if (error != NumberError::NONE) {
+                return error;
+            }
+            return scale_decimal(number, multiplier, 1, std::numeric_limits<uint64_t>::max(), out);
+        }
+        
+        // 時間の単位（秒に対する比率）。名前が一致しなければfalse
+        inline bool duration_unit(StringView unit, uint64_t& numerator, uint64_t& denominator) {
+            numerator = 1;
+            denominator = 1;
+            if (unit == "s") {
+            } else if (unit == "ms") {
+                denominator = 1000;
+            } else if (unit == "us" || unit == "\xC2\xB5s") {
+                denominator = 1000000;
+            } else if (unit == "ns") {
+                denominator = 1000000000;
+            } else if (unit == "m" || unit == "min") {
+                numerator = 60;
+            } else if (unit == "h") {
+                numerator = 3600;
+            } else if (unit == "d") {
+                numerator = 86400;
+            } else {
+                return false;
+            }
+            return true;
+        }
+        
+        // 数値・単位の組を1つずつ読む："250ms", "1h30m", "1.5s"
+        // 単位のない数値は1つだけのとき目標型の単位とみなす（unit_found=false、比率は呼び出し側で設定）
+        struct DurationComponent {
+            StringView number;
+            DecimalMantissa decimal;
+            NumberError error;
+            uint64_t numerator;
+            uint64_t denominator;
+            bool unit_found;
+        };
+        
+        inline bool next_duration_component(StringView text, size_t& pos, DurationComponent& out) {
+            skip_blanks(text, pos);
+            size_t begin = pos;
+            out.error = scan_decimal(text, pos, out.decimal);
+            if (out.error == NumberError::INVALID) {
+                return false;
+            }
+            out.number = text.substr(begin, pos - begin);
+            skip_blanks(text, pos);
+            size_t unit_begin = pos;
+            while (pos < text.size() && !(text[pos] >= '0' && text[pos] <= '9') && text[pos] != '.' &&
+                   text[pos] != ' ' && text[pos] != '\t') {
+                ++pos;
+            }
+            out.unit_found = pos > unit_begin;
+            if (!out.unit_found) {
+                out.numerator = 1;
+                out.denominator = 1;
+                return true;
+            }
+            return duration_unit(text.substr(unit_begin, pos - unit_begin), out.numerator, out.denominator);
+        }
+        
+        // 時間の解析（整数の Rep）：結果は Period 単位の刻み数。端数が出る場合は INEXACT
+        template<typename Rep, typename Period>
+        NumberError parse_duration(StringView text, std::chrono::duration<Rep, Period>& out, std::true_type) {
+            typedef unsigned long long Magnitude;
+            text = trim_view(text);
+            if (text.empty()) {
+                return NumberError::EMPTY;
+            }
+            
+            size_t pos = 0;
+            bool negative = false;
+            if (text[0] == '+' || text[0] == '-') {
+                negative = text[0] == '-';
+                ++pos;
+            }
+            const Magnitude max_value = static_cast<Magnitude>(std::numeric_limits<Rep>::max());
+            const Magnitude limit = !negative ? max_value
+                                  : std::is_signed<Rep>::value ? max_value + 1 : 0;
+            
+            // 単位の比率 (unit / Period) を約分しながら求める（桁あふれは範囲外・端数として扱う）
+            Magnitude total = 0;
+            NumberError pending = NumberError::NONE;
+            size_t components = 0;
+            bool bare_number = false;
+            while (pos < text.size()) {
+                DurationComponent component;
+                if (!next_duration_component(text, pos, component) || bare_number) {
+                    return NumberError::INVALID;
+                }
+                ++components;
+                bare_number = !component.unit_found;
+                if (bare_number && components > 1) {
+                    return NumberError::INVALID;
+                }
+                if (bare_number) {
+                    // 単位のない数値は Period 単位の刻み数
+                    component.numerator = static_cast<uint64_t>(Period::num);
+                    component.denominator = static_cast<uint64_t>(Period::den);
+                }
+                if (component.error != NumberError::NONE) {
+                    pending = pending == NumberError::NONE ? component.error : pending;
+                    continue;
+                }
+                
+                uint64_t g1 = gcd_u64(component.numerator, static_cast<uint64_t>(Period::num));
+                uint64_t g2 = gcd_u64(static_cast<uint64_t>(Period::den), component.denominator);
+                uint64_t numerator = 0;
+                uint64_t denominator = 0;
+                if (!multiply_checked(component.numerator / g1, static_cast<uint64_t>(Period::den) / g2, numerator)) {
+                    if (component.decimal.mantissa != 0 && pending == NumberError::NONE) {
+                        pending = NumberError::OUT_OF_RANGE;
+                    }
+                    continue;
+                }
+                if (!multiply_checked(component.denominator / g2, static_cast<uint64_t>(Period::num) / g1, denominator)) {
+                    if (component.decimal.mantissa != 0 && pending == NumberError::NONE) {
+                        pending = NumberError::INEXACT;
+                    }
+                    continue;
+                }
+                
+                uint64_t ticks = 0;
+                NumberError error = scale_decimal(component.decimal, numerator, denominator, limit, ticks);
+                if (error == NumberError::NONE && ticks > limit - total) {
+                    error = NumberError::OUT_OF_RANGE;
+                }
+                if (error != NumberError::NONE) {
+                    pending = pending == NumberError::NONE ? error : pending;
+                    continue;
+                }
+                total += ticks;
+            }
+            if (components == 0) {
+                return NumberError::INVALID;
+            }
+            if (pending != NumberError::NONE) {
+                return pending;
+            }
+            
+            Rep count;
+            if (negative && total != 0) {
+                count = static_cast<Rep>(-static_cast<long long>(total - 1) - 1);
+            } else {
+                count = static_cast<Rep>(total);
+            }
+            out = std::chrono::duration<Rep, Period>(count);
+            return NumberError::NONE;
+        }
+        
+        // 時間の解析（浮動小数点の Rep）：各成分を double で計算して合計する
+        template<typename Rep, typename Period>
+        NumberError parse_duration(StringView text, std::chrono::duration<Rep, Period>& out, std::false_type) {
+            text = trim_view(text);
+            if (text.empty()) {
+                return NumberError::EMPTY;
+            }
+            
+            size_t pos = 0;
+            bool negative = false;
+            if (text[0] == '+' || text[0] == '-') {
+                negative = text[0] == '-';
+                ++pos;
+            }
+            
+            double total = 0;
+            size_t components = 0;
+            bool bare_number = false;
+            while (pos < text.size()) {
+                DurationComponent component;
+                if (!next_duration_component(text, pos, component) || bare_number) {
+                    return NumberError::INVALID;
+                }
+                ++components;
+                bare_number = !component.unit_found;
+                if (bare_number && components > 1) {
+                    return NumberError::INVALID;
+                }
+                if (bare_number) {
+                    // 単位のない数値は Period 単位の刻み数
+                    component.numerator = static_cast<uint64_t>(Period::num);
+                    component.denominator = static_cast<uint64_t>(Period::den);
+                }
+                double number = 0;
+                if (parse_float(component.number, number) != NumberError::NONE) {
+                    return NumberError::OUT_OF_RANGE;
+                }
+                total += number * static_cast<double>(component.numerator) * static_cast<double>(Period::den) /
+                         (static_cast<double>(component.denominator) * static_cast<double>(Period::num));
+            }
+            if (components == 0) {
+                return NumberError::INVALID;
+            }
+            
+            // float への変換は範囲外だと未定義動作になるため、double のまま上限と比べてから変換する
+            //（long double の Rep でも上限を正確に比べられるよう long double で比較し、inf・NaN も弾く）
+            if (!(static_cast<long double>(total) <= static_cast<long double>(std::numeric_limits<Rep>::max()))) {
+                return NumberError::OUT_OF_RANGE;
+            }
+            out = std::chrono::duration<Rep, Period>(static_cast<Rep>(negative ? -total : total));
+            return NumberError::NONE;
+        }
+        
+        template<typename Rep, typename Period>
+        NumberError parse_duration(StringView text, std::chrono::duration<Rep, Period>& out) {
+            return parse_duration(text, out, std::integral_constant<bool, std::is_integral<Rep>::value>());
+        }
+        
+        // レートの解析（毎秒の回数）："250", "1.5k", "10M/s", "120/min", "2kHz"
+        // SI接頭辞 k/K, M, G, T と、任意の "/s", "/min", "/m", "/h", "/d", "Hz" を受け付ける
+        inline NumberError parse_rate(StringView text, double& out) {
+            text = trim_view(text);
+            if (text.empty()) {
+                return NumberError::EMPTY;
+            }
+            
+            // 数値部分：数字・小数点・指数（e の後に数字か符号が続く場合のみ）
+            size_t pos = text[0] == '+' ? 1 : 0;
+            size_t number_begin = pos;
+            while (pos < text.size()) {
+                char c = text[pos];
+                if ((c >= '0' && c <= '9') || c == '.') {
+                    ++pos;
+                } else if ((c | 0x20) == 'e' && pos + 1 < text.size() &&
+                           ((text[pos + 1] >= '0' && text[pos + 1] <= '9') || text[pos + 1] == '+' || text[pos + 1] == '-')) {
+                    pos += 2;
+                } else {
+                    break;
+                }
+            }
+            double value = 0;
+            NumberError error = parse_float(text.substr(number_begin, pos - number_begin), value);
+            if (error == NumberError::EMPTY) {
+                return NumberError::INVALID;
+            }
+            if (error != NumberError::NONE) {
+                return error;
+            }
+            skip_blanks(text, pos);
+            
+            if (pos < text.size()) {
+                switch (text[pos]) {
+                    case 'k': case 'K': value *= 1e3; ++pos; break;
+                    case 'M': value *= 1e6; ++pos; break;
+                    case 'G': value *= 1e9; ++pos; break;
+                    case 'T': value *= 1e12; ++pos; break;
+                    default: break;
+                }
+            }
+            
+            StringView per = text.substr(pos, text.size() - pos);
+            if (per.empty() || per == "/s" || per == "Hz") {
+                // 毎秒
+            } else if (per == "/min" || per == "/m") {
+                value /= 60;
+            } else if (per == "/h") {
+                value /= 3600;
+            } else if (per == "/d") {
+                value /= 86400;
+            } else {
+                return NumberError::INVALID;
+            }
+            
+            if (value > std::numeric_limits<double>::max()) {
+                return NumberError::OUT_OF_RANGE;
+            }
+            out = value;
+            return NumberError::NONE;
+        }
+        
+        // 時間の刻みの単位名（エラーメッセージ用、標準以外の Period は "ticks"）
+        template<typename Period>
+        inline const char* duration_unit_name() {
+            return std::is_same<Period, std::nano>::value ? "ns"
+                 : std::is_same<Period, std::micro>::value ? "us"
+                 : std::is_same<Period, std::milli>::value ? "ms"
+                 : std::is_same<Period, std::ratio<1>>::value ? "s"
+                 : std::is_same<Period, std::ratio<60>>::value ? "min"
+                 : std::is_same<Period, std::ratio<3600>>::value ? "h"
+                 : "ticks";
+        }
+        
+        // メッセージに示す数値（範囲外エラーの上限、選択肢）
+        // 浮動小数点数は309桁や "0.500000" にならないよう、ストリームの既定形式（"1.79769e+308", "0.5"）で示す
+        template<typename T>
+        inline typename std::enable_if<std::is_integral<T>::value, std::string>::type number_text(T limit) {
+            return std::to_string(limit);
+        }
+        
+        template<typename T>
+        inline typename std::enable_if<std::is_floating_point<T>::value, std::string>::type number_text(T limit) {
+            std::ostringstream text;
+            text << limit;
+            return text.str();
+        }
+        
+        // 単位付きの値の変換エラーのメッセージ（範囲外なら上限、端数なら単位を示す）
+        inline std::string unit_error_message(NumberError error, const char* type_name, const std::string& value,
+                                              const std::string& maximum, const char* unit) {
+            if (error == NumberError::OUT_OF_RANGE) {
+                return std::string(type_name) + " value out of range: '" + value + "' (maximum is " + maximum + " " + unit + ")";
+            }
+            if (error == NumberError::INEXACT) {
+                return std::string("invalid ") + type_name + " value: '" + value + "' (not a whole number of " + unit + ")";
+            }
+            return std::string("invalid ") + type_name + " value: '" + value + "'";
+        }
+        
+        // ValueParser<T>: 文字列から T への変換をコンパイル時に選択する関数オブジェクト
+        // convert() は変換結果を T のまま返し（インライン化可能）、operator() は AnyValue に格納する
+        // parse() は例外を使わずに NumberError を返し、error_message() はそれを convert() と同じメッセージにする
+        template<typename T, typename Enable = void>
+        struct ValueParser {
+            static_assert(sizeof(T) == 0, "no built-in converter for this type; use Argument::converter<T>()");
+        };
+        
+        // 任意幅の整数型（確保なし・ロケール非依存の parse_integer を使用）
+        template<typename T>
+        struct ValueParser<T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value>::type> {
+            static NumberError parse(StringView text, T& out) {
+                return parse_integer(text, out);
+            }
+            
+            static bool try_convert(StringView text, T& out) {
+                return parse(text, out) == NumberError::NONE;
+            }
+            
+            static std::string error_message(NumberError error, const std::string& value) {
+                return number_error_message(error, integer_type_name<T>(), value);
+            }
+            
+            static T convert(const std::string& value) {
+                T result = 0;
+                NumberError error = parse(StringView(value), result);
+                if (error != NumberError::NONE) {
+                    throw std::invalid_argument(error_message(error, value));
+                }
+                return result;
+            }
+            
+            AnyValue operator()(const std::string& value) const { return AnyValue(convert(value)); }
+        };
+        
+        // float/double（確保なし・ロケール非依存の parse_float を使用し、T のまま格納）
+        template<typename T>
+        struct ValueParser<T, typename std::enable_if<std::is_same<T, float>::value || std::is_same<T, double>::value>::type> {
+            static NumberError parse(StringView text, T& out) {
+                return parse_float(text, out);
+            }
+            
+            static bool try_convert(StringView text, T& out) {
+                return parse(text, out) == NumberError::NONE;
+            }
+            
+            static std::string error_message(NumberError error, const std::string& value) {
+                return number_error_message(error, "float", value);
+            }
+            
+            static T convert(const std::string& value) {
+                T result = 0;
+                NumberError error = parse(StringView(value), result);
+                if (error != NumberError::NONE) {
+                    throw std::invalid_argument(error_message(error, value));
+                }
+                return result;
+            }
+            
+            AnyValue operator()(const std::string& value) const { return AnyValue(convert(value)); }
+        };
+        
+        // bool（true/false, 1/0, yes/no, on/off、大文字小文字を区別しない）
+        template<>
+        struct ValueParser<bool> {
+            static NumberError parse(StringView text, bool& out) {
+                text = trim_view(text);
+                if (equals_ignore_case(text, "true") || equals_ignore_case(text, "1") ||
+                    equals_ignore_case(text, "yes") || equals_ignore_case(text, "on")) {
+                    out = true;
+                    return NumberError::NONE;
+                }
+                if (equals_ignore_case(text, "false") || equals_ignore_case(text, "0") ||
+                    equals_ignore_case(text, "no") || equals_ignore_case(text, "off")) {
+                    out = false;
+                    return NumberError::NONE;
+                }
+                return text.empty() ? NumberError::EMPTY : NumberError::INVALID;
+            }
+            
+            static bool try_convert(StringView text, bool& out) {
+                return parse(text, out) == NumberError::NONE;
+            }
+            
+            static std::string error_message(NumberError error, const std::string& value) {
+                if (error == NumberError::EMPTY) {
+                    return "empty string cannot be converted to bool";
+                }
+                return "invalid bool value: '" + value + "' (expected: true/false, 1/0, yes/no, on/off)";
+            }
+            
+            static bool convert(const std::string& value) {
+                bool result = false;
+                NumberError error = parse(StringView(value), result);
+                if (error != NumberError::NONE) {
+                    throw std::invalid_argument(error_message(error, value));
+                }
+                return result;
+            }
+            
+            AnyValue operator()(const std::string& value) const { return AnyValue(convert(value)); }
+        };
+        
+        // string（デフォルト、変換なし）
+        template<>
+        struct ValueParser<std::string> {
+            static const std::string& convert(const std::string& value) { return value; }
+            
+            AnyValue operator()(const std::string& value) const { return AnyValue(value); }
+        };
+        
+        // バイト数（SI/IEC接頭辞、確保なし）
+        template<>
+        struct ValueParser<ByteSize> {
+            static NumberError parse(StringView text, ByteSize& out) {
+                return parse_byte_size(text, out.bytes);
+            }
+            
+            static bool try_convert(StringView text, ByteSize& out) {
+                return parse(text, out) == NumberError::NONE;
+            }
+            
+            static std::string error_message(NumberError error, const std::string& value) {
+                return unit_error_message(error, "byte size", value,
+                    number_text(std::numeric_limits<uint64_t>::max()), "bytes");
+            }
+            
+            static ByteSize convert(const std::string& value) {
+                ByteSize result;
+                NumberError error = parse(StringView(value), result);
+                if (error != NumberError::NONE) {
+                    throw std::invalid_argument(error_message(error, value));
+                }
+                return result;
+            }
+            
+            AnyValue operator()(const std::string& value) const { return AnyValue(convert(value)); }
+        };
+        
+        // 時間（std::chrono::duration、単位 ns/us/ms/s/m/min/h/d、"1h30m" のような連結も可）
+        template<typename Rep, typename Period>
+        struct ValueParser<std::chrono::duration<Rep, Period>> {
+            typedef std::chrono::duration<Rep, Period> Duration;
+            
+            static NumberError parse(StringView text, Duration& out) {
+                return parse_duration(text, out);
+            }
+            
+            static bool try_convert(StringView text, Duration& out) {
+                return parse(text, out) == NumberError::NONE;
+            }
+            
+            static std::string error_message(NumberError error, const std::string& value) {
+                return unit_error_message(error, "duration", value,
+                    number_text(std::numeric_limits<Rep>::max()), duration_unit_name<Period>());
+            }
+            
+            static Duration convert(const std::string& value) {
+                Duration result(0);
+                NumberError error = parse(StringView(value), result);
+                if (error != NumberError::NONE) {
+                    throw std::invalid_argument(error_message(error, value));
+                }
+                return result;
+            }
+            
+            AnyValue operator()(const std::string& value) const { return AnyValue(convert(value)); }
+        };
+        
+        // レート（毎秒の回数、SI接頭辞と /s, /min, /h, /d）
+        template<>
+        struct ValueParser<Rate> {
+            static NumberError parse(StringView text, Rate& out) {
+                return parse_rate(text, out.per_second);
+            }
+            
+            static bool try_convert(StringView text, Rate& out) {
+                return parse(text, out) == NumberError::NONE;
+            }
+            
+            static std::string error_message(NumberError error, const std::string& value) {
+                return unit_error_message(error, "rate", value, number_text(std::numeric_limits<double>::max()), "/s");
+            }
+            
+            static Rate convert(const std::string& value) {
+                Rate result;
+                NumberError error = parse(StringView(value), result);
+                if (error != NumberError::NONE) {
+                    throw std::invalid_argument(error_message(error, value));
+                }
+                return result;
+            }
+            
+            AnyValue operator()(const std::string& value) const { return AnyValue(convert(value)); }
+        };
+        
+        // 組み込みの ValueParser<T> があるか（bind() で型を推論する際に使用）
+        template<typename T>
+        struct HasBuiltinParser : std::integral_constant<bool,
+            std::is_arithmetic<T>::value || std::is_same<T, std::string>::value ||
+            std::is_same<T, ByteSize>::value || std::is_same<T, Rate>::value> {};
+        
+        template<typename Rep, typename Period>
+        struct HasBuiltinParser<std::chrono::duration<Rep, Period>> : std::true_type {};
+        
+        // ユーザー定義の変換関数を AnyValue 返しの関数オブジェクトにする
+        template<typename T, typename Fn>
+        struct CustomConversion {
+            mutable Fn function;  // 非 const な operator() を持つ関数オブジェクト（mutable ラムダ等）も許す
+            
+            AnyValue operator()(const std::string& value) const {
+                try {
+                    T result = function(value);
+                    return AnyValue(std::move(result));
+                } catch (const std::exception& e) {
+                    throw std::invalid_argument("custom conversion failed for '" + value + "': " + e.what());
+                }
+            }
+        };
+        
+        // TypeConverter: 文字列から各型への変換機能
+        // 組み込みの変換器は ValueParser<T> を状態なしで保持するため、生成時に確保しない
+        class TypeConverter {
+        public:
+            // 基本型変換器（T に応じた ValueParser をコンパイル時に選択）
+            template<typename T>
+            static Converter get_converter() {
+                return Converter::stateless<ValueParser<T>>();
+            }
+            
+            // int変換
+            static Converter int_converter() {
+                return get_converter<int>();
+            }
+            
+            // 任意幅の整数型の変換
+            template<typename T>
+            static Converter integer_converter() {
+                return get_converter<T>();
+            }
+            
+            // float/double変換（doubleとして格納）
+            static Converter float_converter() {
+                return get_converter<double>();
+            }
+            
+            // 浮動小数点型の変換（T のまま格納）
+            template<typename T>
+            static Converter floating_converter() {
+                return get_converter<T>();
+            }
+            
+            // bool変換
+            static Converter bool_converter() {
+                return get_converter<bool>();
+            }
+            
+            // string変換（デフォルト）
+            static Converter string_converter() {
+                return get_converter<std::string>();
+            }
+            
+            // バイト数変換（"64MiB" 等）
+            static Converter byte_size_converter() {
+                return get_converter<ByteSize>();
+            }
+            
+            // 時間変換（"250ms" 等、Duration は std::chrono::duration）
+            template<typename Duration>
+            static Converter duration_converter() {
+                return get_converter<Duration>();
+            }
+            
+            // レート変換（"1.5k" 等）
+            static Converter rate_converter() {
+                return get_converter<Rate>();
+            }
+            
+            // カスタム変換器の作成ヘルパー
+            template<typename T, typename Fn>
+            static Converter create_custom_converter(Fn converter_func) {
+                CustomConversion<T, Fn> conversion = {std::move(converter_func)};
+                return Converter(std::move(conversion));
+            }
+        };
+        
+        // ValueAppender: 変換済みの値をスロットのstd::vector<T>へその場で追加する（append/extend用）
+        // element が空なら追加せず、空のリストを要素型で用意するだけにする（値が0個の nargs "*"）
+        typedef void (*ValueAppender)(AnyValue& list, AnyValue&& element);
+        
+        template<typename T>
+        inline void append_typed_value(AnyValue& list, AnyValue&& element) {
+            T* value = element.empty() ? nullptr : &element.get<T>();
+            std::vector<T>* items = list.try_get<std::vector<T>>();
+            if (!items) {
+                // 初回、または単一値が格納されている場合はリストを作り直す
+                std::vector<T> created;
+                if (T* single = list.try_get<T>()) {
+                    created.push_back(std::move(*single));
+                }
+                list = std::move(created);
+                items = list.try_get<std::vector<T>>();
+            }
+            if (value) {
+                items->push_back(std::move(*value));
+            }
+        }
+        
+        // ListConverter: 複数値（nargs "+", "*", "remainder", N）を一括で std::vector<T> に変換する
+        // 要素ごとに AnyValue を作らず、連続領域へ直接書き込む。失敗時は failed に要素の位置を設定して false を返す
+        // out が既に std::vector<T> を保持していれば、その領域を上書きして再利用する
+        typedef bool (*ListConverter)(const std::string* texts, size_t count, AnyValue& out, size_t& failed);
+        
+        template<typename T>
+        inline std::vector<T>& list_storage(AnyValue& out, size_t count) {
+            std::vector<T>* items = out.try_get<std::vector<T>>();
+            if (!items) {
+                out = std::vector<T>();
+                items = out.try_get<std::vector<T>>();
+            }
+            items->resize(count);
+            return *items;
+        }
+        
+        template<typename T>
+        inline bool convert_list(const std::string* texts, size_t count, AnyValue& out, size_t& failed) {
+            std::vector<T>& items = list_storage<T>(out, count);
+            for (size_t i = 0; i < count; ++i) {
+                if (!ValueParser<T>::try_convert(StringView(texts[i]), items[i])) {
+                    failed = i;
+                    return false;
+                }
+            }
+            return true;
+        }
+        
+        // bool は std::vector<bool> のビット参照に直接書き込めないため一時変数を経由する
+        template<>
+        inline bool convert_list<bool>(const std::string* texts, size_t count, AnyValue& out, size_t& failed) {
+            std::vector<bool>& items = list_storage<bool>(out, count);
+            for (size_t i = 0; i < count; ++i) {
+                bool value = false;
+                if (!ValueParser<bool>::try_convert(StringView(texts[i]), value)) {
+                    failed = i;
+                    return false;
+                }
+                items[i] = value;
+            }
+            return true;
+        }
+        
+        // 文字列は要素の容量を再利用して代入する
+        template<>
+        inline bool convert_list<std::string>(const std::string* texts, size_t count, AnyValue& out, size_t&) {
+            std::vector<std::string>& items = list_storage<std::string>(out, count);
+            for (size_t i = 0; i < count; ++i) {
+                items[i].assign(texts[i]);
+            }
+            return true;
+        }
+        
+        // TryConverter: 組み込み型の値を例外を使わずに変換する（失敗時は NumberError を返す）
+        // メッセージは ConversionErrorFormat で必要になった時だけ組み立てる
+        // out が既に T を保持していれば、その値を上書きする
+        typedef NumberError (*TryConverter)(const std::string& text, AnyValue& out);
+        typedef std::string (*ConversionErrorFormat)(NumberError error, const std::string& text);
+        
+        template<typename T>
+        inline NumberError try_convert_value(const std::string& text, AnyValue& out) {
+            T* existing = out.try_get<T>();
+            if (existing) {
+                return ValueParser<T>::parse(StringView(text), *existing);
+            }
+            T result = T();
+            NumberError error = ValueParser<T>::parse(StringView(text), result);
+            if (error == NumberError::NONE) {
+                out = result;
+            }
+            return error;
+        }
+        
+        // 文字列は変換が失敗しないため、通常の変換器で扱う
+        template<typename T>
+        inline TryConverter builtin_try_converter() { return &try_convert_value<T>; }
+        
+        template<>
+        inline TryConverter builtin_try_converter<std::string>() { return nullptr; }
+        
+        template<typename T>
+        inline ConversionErrorFormat builtin_conversion_error() { return &ValueParser<T>::error_message; }
+        
+        template<>
+        inline ConversionErrorFormat builtin_conversion_error<std::string>() { return nullptr; }
+        
+        // TextBuffer: 収集した値の文字列の一時領域
+        // clear() しても要素の std::string を破棄しないため、再利用すると文字列の確保済み容量が次の解析に引き継がれる
+        class TextBuffer {
+        private:
+            std::vector<std::string> items_;
+            size_t size_;
+            
+        public:
+            TextBuffer() : size_(0) {}
+            
+            void push_back(StringView text) {
+                if (size_ < items_.size()) {
+                    items_[size_].assign(text.data(), text.size());
+                } else {
+                    items_.emplace_back(text.data(), text.size());
+                }
+                ++size_;
+            }
+            
+            void clear() { size_ = 0; }
+            
+            size_t size() const { return size_; }
+            bool empty() const { return size_ == 0; }
+            
+            const std::string& operator[](size_t index) const { return items_[index]; }
+            const std::string* data() const { return items_.data(); }
+            const std::string* begin() const { return items_.data(); }
+            const std::string* end() const { return items_.data() + size_; }
+        };
+        
+        // 変換後の型が静的に分からない場合（AnyValueを返すconverter）は格納された型で振り分ける
+        // 要素型の手がかりがない空のリストは std::vector<std::string> にする
+        inline void append_any_value(AnyValue& list, AnyValue&& element) {
+            if (element.empty() || element.try_get<std::string>()) {
+                append_typed_value<std::string>(list, std::move(element));
+            } else if (element.try_get<int>()) {
+                append_typed_value<int>(list, std::move(element));
+            } else if (element.try_get<double>()) {
+                append_typed_value<double>(list, std::move(element));
+            } else if (element.try_get<bool>()) {
+                append_typed_value<bool>(list, std::move(element));
+            } else {
+                std::vector<AnyValue>* items = list.try_get<std::vector<AnyValue>>();
+                if (!items) {
+                    list = std::vector<AnyValue>();
+                    items = list.try_get<std::vector<AnyValue>>();
+                }
+                items->push_back(std::move(element));
+            }
+        }
+        
+        // Token structure for parsed arguments
+        // value / raw_value は元のargv（または呼び出し元のバッファ）へのビューで、
+        // 引用符の除去やエスケープ処理で内容が変わった場合のみTokenizerが所有する文字列を指す
+        struct Token {
+            enum Type {
+                POSITIONAL,    // Non-option argument
+                SHORT_OPTION,  // -o
+                LONG_OPTION,   // --option
+                OPTION_VALUE,  // Value for an option
+                END_OPTIONS    // -- (end of options marker)
+            };
+            
+            Type type;
+            StringView value;
+            StringView raw_value;  // Original value before processing
+            
+            Token(Type t, StringView val)
+                : type(t), value(val), raw_value(val) {}
+            
+            Token(Type t, StringView val, StringView raw_val)
+                : type(t), value(val), raw_value(raw_val.empty() ? val : raw_val) {}
+        };
+        
+        // ArgumentSource: トークン化対象の引数列（argvまたはstring配列への非所有参照）
+        class ArgumentSource {
+        private:
+            char* const* argv_;
+            const std::string* strings_;
+            size_t count_;
+            
+        public:
+            ArgumentSource() : argv_(nullptr), strings_(nullptr), count_(0) {}
+            
+            // argv版（argv[0]のプログラム名は含めない）
+            ArgumentSource(int argc, char* const* argv)
+                : argv_(argc > 1 ? argv + 1 : nullptr), strings_(nullptr)
+                , count_(argc > 1 ? static_cast<size_t>(argc - 1) : 0) {}
+            
+            // string配列版
+            explicit ArgumentSource(const std::vector<std::string>& args)
+                : argv_(nullptr), strings_(args.empty() ? nullptr : &args[0]), count_(args.size()) {}
+            
+            size_t size() const { return count_; }
+            
+            StringView operator[](size_t index) const {
+                return argv_ ? StringView(argv_[index]) : StringView(strings_[index]);
+            }
+        };
+        
+        // ResponseFileError: 応答ファイル（@file）を展開できない（Parserが RESPONSE_FILE_ERROR として記録する）
+        class ResponseFileError : public std::runtime_error {
+        public:
+            explicit ResponseFileError(const std::string& message) : std::runtime_error(message) {}
+        };
+        
+        // ResponseFile: 1つの応答ファイルの内容
+        // 通常のファイルは書き込み可能なプライベートマッピング（MAP_PRIVATE）として開き、引用符の除去はその場で行う
+        // （書き換えたページだけが複製され、ファイル自体は変更されない）。
+        // パイプ・端末（/dev/stdin など）は一定の大きさの領域へ順に読み込み、ファイルの長さによらずメモリ使用量を一定に保つ。
+        // mmapのない環境では全体をバッファに読み込む
+        class ResponseFile {
+        private:
+            char* data_;       // 内容（ストリームでは直近に読み込んだ領域）
+            size_t size_;
+            bool mapped_;
+            bool streamed_;
+            int fd_;           // ストリームとして読んでいる間のみ有効
+            std::vector<char> buffer_;
+            std::string path_;
+#if ARGPARSE_HAS_MMAP
+            dev_t device_;
+            ino_t inode_;
+#endif
+            
+        public:
+            ResponseFile() : data_(nullptr), size_(0), mapped_(false), streamed_(false), fd_(-1) {}
+            ~ResponseFile() { close(); }
+            
+            ResponseFile(const ResponseFile&) = delete;
+            ResponseFile& operator=(const ResponseFile&) = delete;
+            
+            // ファイルを開く（失敗時は理由をerrorに格納してfalseを返す）
+            bool open(const std::string& path, std::string& error) {
+                close();
+                path_ = path;
+#if ARGPARSE_HAS_MMAP
+                int fd = ::open(path.c_str(), O_RDONLY);
+                if (fd < 0) {
+                    error = std::strerror(errno);
+                    return false;
+                }
+                struct stat info;
+                if (::fstat(fd, &info) != 0) {
+                    error = std::strerror(errno);
+                    ::close(fd);
+                    return false;
+                }
+                if (S_ISDIR(info.st_mode)) {
+                    error = std::strerror(EISDIR);
+                    ::close(fd);
+                    return false;
+                }
+                device_ = info.st_dev;
+                inode_ = info.st_ino;
+                
+                if (!S_ISREG(info.st_mode)) {
+                    // パイプ・端末は refill() で少しずつ読む
+                    fd_ = fd;
+                    streamed_ = true;
+                    buffer_.resize(65536);
+                    data_ = buffer_.data();
+                    return true;
+                }
+                
+                bool ok = true;
+                size_ = static_cast<size_t>(info.st_size);
+                if (size_ > 0) {
+                    void* address = ::mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+                    if (address == MAP_FAILED) {
+                        error = std::strerror(errno);
+                        size_ = 0;
+                        ok = false;
+                    } else {
+                        ::madvise(address, size_, MADV_SEQUENTIAL);
+                        data_ = static_cast<char*>(address);
+                        mapped_ = true;
+                    }
+                }
+                ::close(fd);
+                return ok;
+#else
+                std::ifstream in(path.c_str(), std::ios::binary);
+                if (!in) {
+                    error = "cannot open file";
+                    return false;
+                }
+                buffer_.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+                data_ = buffer_.empty() ? nullptr : buffer_.data();
+                size_ = buffer_.size();
+                return true;
+#endif
+            }
+            
+            void close() {
+#if ARGPARSE_HAS_MMAP
+                if (mapped_) {
+                    ::munmap(data_, size_);
+                }
+                if (fd_ >= 0) {
+                    ::close(fd_);
+                }
+#endif
+                buffer_.clear();
+                data_ = nullptr;
+                size_ = 0;
+                mapped_ = false;
+                streamed_ = false;
+                fd_ = -1;
+            }
+            
+            char* data() const { return data_; }
+            size_t size() const { return size_; }
+            const std::string& path() const { return path_; }
+            
+            // 少しずつ読み込むファイルか（data() は refill() のたびに置き換わる）
+            bool streamed() const { return streamed_; }
+            
+            // 次の領域を読み込む（終端ならfalse）
+            bool refill() {
+                size_ = 0;
+#if ARGPARSE_HAS_MMAP
+                while (fd_ >= 0) {
+                    ssize_t count = ::read(fd_, buffer_.data(), buffer_.size());
+                    if (count > 0) {
+                        size_ = static_cast<size_t>(count);
+                        return true;
+                    }
+                    if (count == 0) {
+                        // 終端（端末で再び読み込みを待たないよう閉じる）
+                        ::close(fd_);
+                        fd_ = -1;
+                        break;
+                    }
+                    if (errno != EINTR) {
+                        throw ResponseFileError("cannot read response file '" + path_ + "': " + std::strerror(errno));
+                    }
+                }
+#endif
+                return false;
+            }
+            
+            // 同じファイルか（デバイスとiノード、mmapのない環境ではパスで比較）
+            bool same_file(const ResponseFile& other) const {
+#if ARGPARSE_HAS_MMAP
+                return device_ == other.device_ && inode_ == other.inode_;
+#else
+                return path_ == other.path_;
+#endif
+            }
+        };
+        
+        // ResponseFileReader: 応答ファイルを入れ子も含めて先頭から順に読み進める
+        // 引数はシェル風の規則で区切る：空白で区切り、'...' の中はそのまま、"..." の中は \" と \\ のみエスケープ、
+        // 引用符の外の \ は次の1文字をそのまま使う。
+        // マップしたファイルの引数はその内容へのビューで、close_all() まで有効（読み終えたファイルも解析が終わるまで保持する）。
+        // ストリームから読んだ引数は内部の枠に複写され、続けて stream_slot_count 個の引数を読むまで有効（is_volatile()）
+        class ResponseFileReader {
+        public:
+            static const int stream_slot_count = 4;
+            
+        private:
+            struct Frame {
+                ResponseFile* file;
+                size_t pos;  // 次に読む位置
+            };
+            
+            // マップした内容を読む入力
+            struct MappedInput {
+                const char* data;
+                size_t size;
+                size_t& pos;
+                
+                bool more() const { return pos < size; }
+                char peek() const { return data[pos]; }
+                char get() { return data[pos++]; }
+            };
+            
+            // 領域を使い切るたびに次を読み込む入力
+            struct StreamInput {
+                ResponseFile& file;
+                size_t& pos;
+                
+                bool more() {
+                    if (pos < file.size()) {
+                        return true;
+                    }
+                    pos = 0;
+                    return file.refill();
+                }
+                char peek() const { return file.data()[pos]; }
+                char get() { return file.data()[pos++]; }
+            };
+            
+            // 引用符・エスケープを取り除いた内容を前に詰めて書く出力（書き込み位置は読み込み位置を越えない）
+            // 同じバイトなら書き込まず、ページの複製を避ける
+            struct InPlaceOutput {
+                char* out;
+                
+                void put(char c) {
+                    if (*out != c) {
+                        *out = c;
+                    }
+                    ++out;
+                }
+            };
+            
+            struct StringOutput {
+                std::string& text;
+                
+                void put(char c) { text.push_back(c); }
+            };
+            
+            std::vector<std::unique_ptr<ResponseFile>> files_;  // 開いた全ファイル
+            std::vector<Frame> stack_;                          // 読み込み中のファイル（末尾が最も内側）
+            std::string stream_slots_[stream_slot_count];       // ストリームから読んだ引数（順に使い回す）
+            int stream_slot_;
+            
+        public:
+            ResponseFileReader() : stream_slot_(0) {}
+            
+            // 全ファイルを閉じる
+            void close_all() {
+                stack_.clear();
+                files_.clear();
+            }
+            
+            // ファイルを開き、現在位置に割り込ませる（読み込み中のファイルを再び開こうとした場合は例外）
+            void push(StringView path) {
+                std::string name = path.str();
+                _reclaim_slot(path);
+                std::unique_ptr<ResponseFile> file(new ResponseFile());
+                std::string error;
+                if (!file->open(name, error)) {
+                    throw ResponseFileError("cannot read response file '" + name + "': " + error);
+                }
+                for (const Frame& frame : stack_) {
+                    if (frame.file->same_file(*file)) {
+                        throw ResponseFileError("response file '" + name + "' includes itself");
+                    }
+                }
+                Frame frame = {file.get(), 0};
+                files_.push_back(std::move(file));
+                stack_.push_back(frame);
+            }
+            
+            // 次の引数を取り出す（読み終えたファイルは読み込み位置から外す。全て読み終えたらfalse）
+            bool next(StringView& arg) {
+                while (!stack_.empty()) {
+                    if (_next_in(stack_.back(), arg)) {
+                        return true;
+                    }
+                    stack_.pop_back();
+                }
+                return false;
+            }
+            
+            // ストリームから読んだ引数の枠を指しているか（保持するなら複写が必要）
+            bool is_volatile(StringView view) const {
+                for (int i = 0; i < stream_slot_count; ++i) {
+                    if (_in_slot(view, stream_slots_[i])) {
+                        return true;
+                    }
+                }
+                return false;
+            }
+            
+        private:
+            static bool _is_space(char c) {
+                return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+            }
+            
+            static bool _in_slot(StringView view, const std::string& slot) {
+                return !slot.empty() && view.data() >= slot.data() && view.data() <= slot.data() + slot.size();
+            }
+            
+            // 直前に返した "@path" の枠はパスを複写した後は不要なので、次の引数に使う
+            void _reclaim_slot(StringView path) {
+                int last = (stream_slot_ + stream_slot_count - 1) % stream_slot_count;
+                if (_in_slot(path, stream_slots_[last])) {
+                    stream_slot_ = last;
+                }
+            }
+            
+            // 空白を読み飛ばす（引数が残っていなければfalse）
+            template<typename Input>
+            static bool _skip_space(Input& in) {
+                while (in.more()) {
+                    if (!_is_space(in.peek())) {
+                        return true;
+                    }
+                    in.get();
+                }
+                return false;
+            }
+            
+            // 1引数分の引用符・エスケープを処理して出力に書く
+            template<typename Input, typename Output>
+            static void _scan(Input& in, Output& out, const std::string& path) {
+                while (in.more() && !_is_space(in.peek())) {
+                    char c = in.get();
+                    if (c == '\'' || c == '"') {
+                        for (;;) {
+                            if (!in.more()) {
+                                throw ResponseFileError("unterminated quote in response file '" + path + "'");
+                            }
+                            char quoted = in.get();
+                            if (quoted == c) {
+                                break;
+                            }
+                            if (c == '"' && quoted == '\\' && in.more() && (in.peek() == '"' || in.peek() == '\\')) {
+                                quoted = in.get();
+                            }
+                            out.put(quoted);
+                        }
+                    } else {
+                        if (c == '\\' && in.more()) {
+                            c = in.get();
+                        }
+                        out.put(c);
+                    }
+                }
+            }
             
-            // argv配列からトークンを生成
-            void tokenize(int argc, char* argv[]) {
-                std::vector<std::string> args;
-                for (int i = 1; i < argc; ++i) {  // Skip program name (argv[0])
-                    args.push_back(std::string(argv[i]));
+            // 1引数を切り出す
+            bool _next_in(Frame& frame, StringView& arg) {
+                ResponseFile& file = *frame.file;
+                if (file.streamed()) {
+                    StreamInput in = {file, frame.pos};
+                    if (!_skip_space(in)) {
+                        return false;
+                    }
+                    std::string& slot = stream_slots_[stream_slot_];
+                    stream_slot_ = (stream_slot_ + 1) % stream_slot_count;
+                    slot.clear();
+                    StringOutput out = {slot};
+                    _scan(in, out, file.path());
+                    arg = StringView(slot);
+                    return true;
                 }
-                tokenize(args);
+                
+                MappedInput in = {file.data(), file.size(), frame.pos};
+                if (!_skip_space(in)) {
+                    return false;
+                }
+                char* begin = file.data() + frame.pos;
+                InPlaceOutput out = {begin};
+                _scan(in, out, file.path());
+                arg = StringView(begin, static_cast<size_t>(out.out - begin));
+                return true;
             }
+        };
+        
+        // TokenCursor: 引数列を必要な分だけ逐次分類するストリーミングカーソル
+        // トークン列を事前に構築せず、追加メモリはO(1)。
+        // next()/peek() が返す参照は次に next() を呼ぶまで有効
+        // 応答ファイルの接頭辞が指定されていれば、"@file" をファイル内の引数列に置き換えながら読み進める
+        class TokenCursor {
+        private:
+            ArgumentSource source_;
+            size_t index_;              // 次に分類する引数の位置
+            size_t token_argument_;     // lookahead_ の元になった引数の位置
+            size_t consumed_argument_;  // consumed_ の元になった引数の位置
+            bool end_of_options_;
             
-            // string配列からトークンを生成
-            void tokenize(const std::vector<std::string>& args) {
-                tokens_.clear();
-                current_index_ = 0;
+            StringView cluster_;        // 展開中の短縮形オプション (-abc)
+            size_t cluster_pos_;
+            bool has_pending_value_;    // --option=value の value 側
+            Token pending_value_;
+            
+            bool has_lookahead_;
+            Token lookahead_;
+            Token consumed_;
+            
+            // エスケープ処理でバイトが変わった値の置き場所
+            // 同時に参照され得るのは consumed_ と lookahead_ の2つなので交互に使う
+            std::string scratch_[2];
+            int scratch_slot_;
+            
+            // 応答ファイルの展開（接頭辞が空なら引数列を直接読む）
+            StringView prefix_chars_;
+            std::unique_ptr<ResponseFileReader> files_;  // 最初の応答ファイルで作成
+            size_t file_argument_;      // 展開中の応答ファイルを指定した引数の位置
+            bool has_argument_;         // 展開済みの次の引数（has_next() のために先読みしたもの）
+            StringView argument_;
+            size_t argument_index_;
+            
+        public:
+            TokenCursor()
+                : index_(0), token_argument_(0), consumed_argument_(0), end_of_options_(false)
+                , cluster_pos_(0), has_pending_value_(false), pending_value_(Token::POSITIONAL, StringView())
+                , has_lookahead_(false), lookahead_(Token::POSITIONAL, StringView())
+                , consumed_(Token::POSITIONAL, StringView()), scratch_slot_(0)
+                , file_argument_(0), has_argument_(false), argument_index_(0) {}
+            
+            explicit TokenCursor(const ArgumentSource& source, StringView prefix_chars = StringView()) : TokenCursor() {
+                reset(source, prefix_chars);
+            }
+            
+            // 新しい引数列で開始（前回の状態を破棄）
+            // prefix_chars のいずれかで始まる引数は応答ファイルとして展開する（参照先は解析の間有効であること）
+            void reset(const ArgumentSource& source, StringView prefix_chars = StringView()) {
+                source_ = source;
+                prefix_chars_ = prefix_chars;
+                close_files();
+                file_argument_ = 0;
+                has_argument_ = false;
+                index_ = 0;
+                token_argument_ = 0;
+                consumed_argument_ = 0;
                 end_of_options_ = false;
+                cluster_ = StringView();
+                cluster_pos_ = 0;
+                has_pending_value_ = false;
+                has_lookahead_ = false;
+            }
+            
+            // トークンが残っているかチェック（各引数は1つ以上のトークンになる）
+            // 応答ファイルの展開中は次の引数まで読み進める（空のファイルだけが残っていればfalse）
+            bool has_next() {
+                return has_lookahead_ || has_pending_value_ || cluster_pos_ < cluster_.size() || _has_argument();
+            }
+            
+            // 現在のトークンを確認（消費しない）
+            const Token& peek() {
+                _fill_lookahead();
+                return lookahead_;
+            }
+            
+            // 次のトークンを取得
+            const Token& next() {
+                _fill_lookahead();
+                consumed_ = lookahead_;
+                consumed_argument_ = token_argument_;
+                has_lookahead_ = false;
+                return consumed_;
+            }
+            
+            // 直前に next() で取得したトークン
+            const Token& current() const {
+                return consumed_;
+            }
+            
+            // 直前に next() で取得したトークンの元の引数位置（argv[0]を除いた0始まり）
+            size_t argument_index() const {
+                return consumed_argument_;
+            }
+            
+            // ビューがカーソル内部の一時領域を指しているか（呼び出し元で保持するならコピーが必要）
+            // ストリームとして読んでいる応答ファイルの引数も、数引数先まで読み進めると上書きされる
+            bool is_scratch(StringView view) const {
+                if (files_ && files_->is_volatile(view)) {
+                    return true;
+                }
+                for (int i = 0; i < 2; ++i) {
+                    const std::string& buffer = scratch_[i];
+                    if (!buffer.empty() && view.data() >= buffer.data() &&
+                        view.data() < buffer.data() + buffer.size()) {
+                        return true;
+                    }
+                }
+                return false;
+            }
+            
+            // 最後に展開を始めた応答ファイルを指定した引数の位置
+            size_t response_file_argument() const {
+                return file_argument_;
+            }
+            
+            // 応答ファイルを閉じる（以降、それまでに返したトークンのビューは無効）
+            void close_files() {
+                if (files_) {
+                    files_->close_all();
+                }
+            }
+            
+        private:
+            // lookahead_ に次のトークンを分類して格納
+            void _fill_lookahead() {
+                if (has_lookahead_) {
+                    return;
+                }
                 
-                for (size_t i = 0; i < args.size(); ++i) {
-                    const std::string& arg = args[i];
+                if (has_pending_value_) {
+                    lookahead_ = pending_value_;
+                    has_pending_value_ = false;
+                } else if (cluster_pos_ < cluster_.size()) {
+                    // 複数の短縮形オプション (-abc → -a -b -c)
+                    lookahead_ = Token(Token::SHORT_OPTION, _short_option_name(cluster_[cluster_pos_]), cluster_);
+                    ++cluster_pos_;
+                } else if (_has_argument()) {
+                    _classify(_take_argument());
+                } else {
+                    throw std::runtime_error("No more tokens available");
+                }
+                has_lookahead_ = true;
+            }
+            
+            bool _has_argument() {
+                if (prefix_chars_.empty()) {
+                    return index_ < source_.size();
+                }
+                return has_argument_ || _expand_next_argument();
+            }
+            
+            // 次の引数を取り出し、token_argument_ に元の引数位置を設定
+            StringView _take_argument() {
+                if (has_argument_) {
+                    has_argument_ = false;
+                    token_argument_ = argument_index_;
+                    return argument_;
+                }
+                token_argument_ = index_;
+                return source_[index_++];
+            }
+            
+            // 応答ファイルを展開して次の引数を argument_ に先読みする
+            // ファイル内の引数の位置は、そのファイルを指定した引数の位置とする
+            bool _expand_next_argument() {
+                for (;;) {
+                    StringView arg;
+                    size_t origin = file_argument_;
+                    if (!(files_ && files_->next(arg))) {
+                        if (index_ >= source_.size()) {
+                            return false;
+                        }
+                        origin = index_;
+                        arg = source_[index_++];
+                    }
                     
-                    // "--" は引数終了マーカー
-                    if (arg == "--" && !end_of_options_) {
-                        tokens_.push_back(Token(Token::END_OPTIONS, arg));
-                        end_of_options_ = true;
+                    if (!arg.empty() && prefix_chars_.find(arg[0]) != StringView::npos) {
+                        if (!files_) {
+                            files_.reset(new ResponseFileReader());
+                        }
+                        file_argument_ = origin;
+                        files_->push(arg.substr(1));
                         continue;
                     }
                     
-                    // 引数終了後はすべて位置引数として扱う
-                    if (end_of_options_) {
-                        tokens_.push_back(Token(Token::POSITIONAL, arg));
-                        continue;
+                    argument_ = arg;
+                    argument_index_ = origin;
+                    has_argument_ = true;
+                    return true;
+                }
+            }
+            
+            // 1引数分の分類
+            void _classify(StringView arg) {
+                // "--" は引数終了マーカー
+                if (!end_of_options_ && arg.size() == 2 && arg[0] == '-' && arg[1] == '-') {
+                    lookahead_ = Token(Token::END_OPTIONS, arg);
+                    end_of_options_ = true;
+                    return;
+                }
+                
+                // 引数終了後、またはオプション形式でなければ位置引数
+                if (end_of_options_ || arg.size() < 2 || arg[0] != '-') {
+                    lookahead_ = Token(Token::POSITIONAL, arg);
+                    return;
+                }
+                
+                if (arg[1] == '-') {
+                    // 長形式オプション (--option or --option=value)
+                    size_t equals_pos = arg.find('=');
+                    if (equals_pos != StringView::npos) {
+                        lookahead_ = Token(Token::LONG_OPTION, arg.substr(0, equals_pos), arg);
+                        pending_value_ = Token(Token::OPTION_VALUE, _unquote_string(arg.substr(equals_pos + 1)), arg);
+                        has_pending_value_ = true;
+                    } else {
+                        lookahead_ = Token(Token::LONG_OPTION, arg);
+                    }
+                } else if (arg.size() == 2) {
+                    // 単一の短縮形オプション (-o)
+                    lookahead_ = Token(Token::SHORT_OPTION, arg);
+                } else {
+                    // 複数の短縮形オプション：先頭の文字を返し、残りは後で展開
+                    lookahead_ = Token(Token::SHORT_OPTION, _short_option_name(arg[1]), arg);
+                    cluster_ = arg;
+                    cluster_pos_ = 2;
+                }
+            }
+            
+            // 1文字の短縮形オプション名 "-x" のビュー（静的テーブルを参照するため確保なし）
+            static StringView _short_option_name(char c) {
+                struct ShortOptionTable {
+                    char names[256][2];
+                    ShortOptionTable() {
+                        for (int i = 0; i < 256; ++i) {
+                            names[i][0] = '-';
+                            names[i][1] = static_cast<char>(i);
+                        }
+                    }
+                };
+                static const ShortOptionTable table;
+                return StringView(table.names[static_cast<unsigned char>(c)], 2);
+            }
+            
+            // 引用符付き文字列の処理（引用符の除去のみならビューのまま返す）
+            StringView _unquote_string(StringView str) {
+                if (str.size() < 2) {
+                    return str;
+                }
+                
+                char first = str[0];
+                char last = str[str.size() - 1];
+                
+                // ダブルクォートまたはシングルクォートで囲まれている場合
+                if ((first == '"' && last == '"') || (first == '\'' && last == '\'')) {
+                    StringView inner = str.substr(1, str.size() - 2);
+                    
+                    // エスケープシーケンスの処理（バイトが変わる場合のみ一時領域に書き出す）
+                    if (first == '"' && inner.find('\\') != StringView::npos) {
+                        std::string& buffer = scratch_[scratch_slot_];
+                        scratch_slot_ = 1 - scratch_slot_;
+                        _process_escape_sequences(inner, buffer);
+                        return StringView(buffer);
+                    }
+                    
+                    return inner;
+                }
+                
+                return str;
+            }
+            
+            // エスケープシーケンスの処理
+            static void _process_escape_sequences(StringView str, std::string& result) {
+                result.clear();
+                result.reserve(str.size());
+                
+                for (size_t i = 0; i < str.size(); ++i) {
+                    if (str[i] == '\\' && i + 1 < str.size()) {
+                        char next = str[i + 1];
+                        switch (next) {
+                            case 'n': result += '\n'; break;
+                            case 't': result += '\t'; break;
+                            case 'r': result += '\r'; break;
+                            case '\\': result += '\\'; break;
+                            case '"': result += '"'; break;
+                            case '\'': result += '\''; break;
+                            default:
+                                // 不明なエスケープシーケンスはそのまま保持
+                                result += '\\';
+                                result += next;
+                                break;
+                        }
+                        ++i;  // 次の文字をスキップ
+                    } else {
+                        result += str[i];
+                    }
+                }
+            }
+        };
+        
+        // Tokenizer: コマンドライン引数のトークン化（全トークンを保持する版）
+        // 解析はTokenCursorで逐次行う。こちらはトークン列の検査・デバッグ用。
+        // トークンは入力へのビューを保持するため、入力（argvやstring配列）は
+        // トークンの使用中は生存している必要がある
+        class Tokenizer {
+        private:
+            std::vector<Token> tokens_;
+            std::deque<std::string> owned_;  // 処理で内容が変わった値（dequeなので追加で参照が無効化されない）
+            size_t current_index_;
+            
+        public:
+            // Constructor
+            Tokenizer() : current_index_(0) {}
+            
+            // argv配列からトークンを生成（argvはコピーしない）
+            void tokenize(int argc, char* argv[]) {
+                _tokenize(ArgumentSource(argc, argv));
+            }
+            
+            // string配列からトークンを生成（argsはコピーしない）
+            void tokenize(const std::vector<std::string>& args) {
+                _tokenize(ArgumentSource(args));
+            }
+            
+            // 次のトークンを取得
+            const Token& next() {
+                if (current_index_ >= tokens_.size()) {
+                    throw std::runtime_error("No more tokens available");
+                }
+                return tokens_[current_index_++];
+            }
+            
+            // 現在のトークンを確認（消費しない）
+            const Token& peek() const {
+                if (current_index_ >= tokens_.size()) {
+                    throw std::runtime_error("No more tokens available");
+                }
+                return tokens_[current_index_];
+            }
+            
+            // トークンが残っているかチェック
+            bool has_next() const {
+                return current_index_ < tokens_.size();
+            }
+            
+            // インデックスをリセット
+            void reset() {
+                current_index_ = 0;
+            }
+            
+            // 全トークンの取得（デバッグ用）
+            const std::vector<Token>& get_tokens() const {
+                return tokens_;
+            }
+            
+            // トークン数の取得
+            size_t size() const {
+                return tokens_.size();
+            }
+            
+            // 現在位置の取得
+            size_t position() const {
+                return current_index_;
+            }
+            
+            // 指定位置にシーク
+            void seek(size_t pos) {
+                if (pos > tokens_.size()) {
+                    pos = tokens_.size();
+                }
+                current_index_ = pos;
+            }
+            
+            // 処理で内容が変わったため所有している値の数（確保の発生回数）
+            size_t owned_count() const {
+                return owned_.size();
+            }
+            
+        private:
+            // カーソルで全トークンを取り出して保持
+            void _tokenize(const ArgumentSource& source) {
+                tokens_.clear();
+                tokens_.reserve(source.size());
+                owned_.clear();
+                current_index_ = 0;
+                
+                TokenCursor cursor(source);
+                while (cursor.has_next()) {
+                    Token token = cursor.next();
+                    // カーソルの一時領域はすぐに再利用されるため、所有する文字列に移す
+                    if (cursor.is_scratch(token.value)) {
+                        owned_.push_back(token.value.str());
+                        token.value = StringView(owned_.back());
+                    }
+                    tokens_.push_back(token);
+                }
+            }
+        };
+        
+        // OptionTable: 名前 → インデックスの凍結済み検索表（完全ハッシュ、hash-and-displace）
+        // オプション名の検索（ParsePlan）と保存キー → スロットの解決（NamespaceSchema）に使う
+        // hash-and-displace方式：名前のハッシュを一度だけ計算し、バケットごとの変位で
+        // 衝突のないスロットへ再配置する。検索はハッシュ1回＋比較1回で、名前はバイト列で保持する
+        // スロット数は2の冪で空き（EMPTY）が残るため、完全ハッシュだが最小ではない
+        // ハッシュ値が完全に一致する名前があると配置できないため、試行回数を超えたら名前順の表の二分探索に切り替える
+        class OptionTable {
+        private:
+            static const uint32_t EMPTY = 0xFFFFFFFFu;
+            
+            struct Entry {
+                uint32_t offset;  // names_ 内の開始位置
+                uint32_t length;
+                uint32_t value;
+            };
+            
+            std::vector<char> names_;           // 全オプション名を連結したバイト列
+            std::vector<Entry> entries_;
+            std::vector<uint32_t> displacements_;  // バケットごとの変位（空なら名前順の表）
+            std::vector<uint32_t> slots_;          // スロット → entries_ インデックス（名前順の表では名前順の entries_ インデックス）
+            uint64_t slot_mask_;
+            
+        public:
+            enum : size_t { npos = static_cast<size_t>(-1) };  // 列挙子なのでODR使用でも定義不要
+            enum : size_t { default_attempts = 4 };             // 配置に失敗したらスロット数を倍にして再試行する回数
+            
+            OptionTable() : slot_mask_(0) {}
+            
+            // (名前, 値) の組から構築。同じ名前は後の値で上書きする
+            // max_attempts 回の配置に失敗したら名前順の表にする（0なら常に名前順）
+            explicit OptionTable(const std::vector<std::pair<std::string, size_t>>& items,
+                                 size_t max_attempts = default_attempts) : slot_mask_(0) {
+                std::unordered_map<std::string, size_t> unique;
+                std::vector<std::string> order;
+                for (const auto& item : items) {
+                    auto it = unique.find(item.first);
+                    if (it == unique.end()) {
+                        unique[item.first] = item.second;
+                        order.push_back(item.first);
+                    } else {
+                        it->second = item.second;
+                    }
+                }
+                
+                for (const auto& name : order) {
+                    Entry entry;
+                    entry.offset = static_cast<uint32_t>(names_.size());
+                    entry.length = static_cast<uint32_t>(name.size());
+                    entry.value = static_cast<uint32_t>(unique[name]);
+                    names_.insert(names_.end(), name.begin(), name.end());
+                    entries_.push_back(entry);
+                }
+                
+                _build(max_attempts);
+            }
+            
+            // 名前を検索し、値（見つからなければnpos）を返す
+            size_t find(StringView name) const {
+                if (entries_.empty()) {
+                    return npos;
+                }
+                if (displacements_.empty()) {
+                    return _find_sorted(name);
+                }
+                uint64_t hash = hash_bytes(name);
+                uint32_t displacement = displacements_[hash % displacements_.size()];
+                uint32_t index = slots_[_slot(hash, displacement)];
+                if (index == EMPTY) {
+                    return npos;
+                }
+                const Entry& entry = entries_[index];
+                if (entry.length != name.size() ||
+                    (entry.length != 0 && std::memcmp(&names_[entry.offset], name.data(), entry.length) != 0)) {
+                    return npos;
+                }
+                return entry.value;
+            }
+            
+            size_t size() const { return entries_.size(); }
+            
+            // 完全ハッシュで検索するか（false なら名前順の表の二分探索）
+            bool hashed() const { return !displacements_.empty(); }
+            
+            // FNV-1a（64bit）
+            static uint64_t hash_bytes(StringView bytes) {
+                uint64_t hash = 14695981039346656037ULL;
+                for (size_t i = 0; i < bytes.size(); ++i) {
+                    hash ^= static_cast<unsigned char>(bytes.data()[i]);
+                    hash *= 1099511628211ULL;
+                }
+                return hash;
+            }
+            
+        private:
+            // ハッシュと変位からスロット位置を求める（fmix64で再攪拌）
+            size_t _slot(uint64_t hash, uint32_t displacement) const {
+                uint64_t x = hash ^ (static_cast<uint64_t>(displacement) * 0x9E3779B97F4A7C15ULL);
+                x ^= x >> 33;
+                x *= 0xFF51AFD7ED558CCDULL;
+                x ^= x >> 33;
+                x *= 0xC4CEB9FE1A85EC53ULL;
+                x ^= x >> 33;
+                return static_cast<size_t>(x & slot_mask_);
+            }
+            
+            // entries_[index] の名前と name の大小（バイト列の辞書順）
+            int _compare(uint32_t index, StringView name) const {
+                const Entry& entry = entries_[index];
+                size_t common = std::min(static_cast<size_t>(entry.length), name.size());
+                int result = common == 0 ? 0 : std::memcmp(&names_[entry.offset], name.data(), common);
+                if (result != 0) {
+                    return result;
+                }
+                return entry.length < name.size() ? -1 : (entry.length > name.size() ? 1 : 0);
+            }
+            
+            size_t _find_sorted(StringView name) const {
+                size_t low = 0;
+                size_t high = slots_.size();
+                while (low < high) {
+                    size_t middle = low + (high - low) / 2;
+                    int order = _compare(slots_[middle], name);
+                    if (order == 0) {
+                        return entries_[slots_[middle]].value;
+                    }
+                    if (order < 0) {
+                        low = middle + 1;
+                    } else {
+                        high = middle;
+                    }
+                }
+                return npos;
+            }
+            
+            void _build(size_t max_attempts) {
+                if (entries_.empty()) {
+                    return;
+                }
+                
+                std::vector<uint64_t> hashes(entries_.size());
+                for (size_t i = 0; i < entries_.size(); ++i) {
+                    hashes[i] = hash_bytes(StringView(&names_[entries_[i].offset], entries_[i].length));
+                }
+                
+                // バケット数は名前4つにつき1つ、スロット数は名前数以上の2のべき乗
+                size_t bucket_count = (entries_.size() + 3) / 4;
+                size_t slot_count = 1;
+                while (slot_count < entries_.size() + entries_.size() / 4) {
+                    slot_count <<= 1;
+                }
+                
+                // 配置に失敗した場合はスロット数を増やして再試行
+                // ハッシュ値の一致する名前はどの変位でも同じスロットになるため、回数を限って名前順の表にする
+                for (size_t attempt = 0; attempt < max_attempts; ++attempt) {
+                    if (_try_place(hashes, bucket_count, slot_count)) {
+                        return;
+                    }
+                    slot_count <<= 1;
+                }
+                
+                std::vector<uint32_t>().swap(displacements_);
+                slot_mask_ = 0;
+                std::vector<uint32_t> sorted(entries_.size());
+                for (size_t i = 0; i < entries_.size(); ++i) {
+                    sorted[i] = static_cast<uint32_t>(i);
+                }
+                std::sort(sorted.begin(), sorted.end(), [this](uint32_t a, uint32_t b) {
+                    const Entry& entry = entries_[b];
+                    return _compare(a, StringView(names_.data() + entry.offset, entry.length)) < 0;
+                });
+                slots_.swap(sorted);
+            }
+            
+            bool _try_place(const std::vector<uint64_t>& hashes, size_t bucket_count, size_t slot_count) {
+                const uint32_t max_displacement = 1u << 16;
+                
+                slot_mask_ = slot_count - 1;
+                slots_.assign(slot_count, static_cast<uint32_t>(EMPTY));
+                displacements_.assign(bucket_count, 0);
+                
+                std::vector<std::vector<uint32_t>> buckets(bucket_count);
+                for (size_t i = 0; i < hashes.size(); ++i) {
+                    buckets[hashes[i] % bucket_count].push_back(static_cast<uint32_t>(i));
+                }
+                
+                // 要素の多いバケットから配置する
+                std::vector<size_t> order(bucket_count);
+                for (size_t b = 0; b < bucket_count; ++b) {
+                    order[b] = b;
+                }
+                std::sort(order.begin(), order.end(), [&buckets](size_t a, size_t b) {
+                    return buckets[a].size() > buckets[b].size();
+                });
+                
+                std::vector<size_t> placed;
+                for (size_t b : order) {
+                    const auto& bucket = buckets[b];
+                    if (bucket.empty()) {
+                        break;
                     }
                     
-                    // オプション引数の判定と処理
-                    if (arg.length() >= 2 && arg[0] == '-') {
-                        if (arg[1] == '-') {
-                            // 長形式オプション (--option or --option=value)
-                            _process_long_option(arg);
+                    bool done = false;
+                    for (uint32_t d = 0; d < max_displacement && !done; ++d) {
+                        placed.clear();
+                        done = true;
+                        for (uint32_t index : bucket) {
+                            size_t slot = _slot(hashes[index], d);
+                            if (slots_[slot] != EMPTY) {
+                                done = false;
+                                break;
+                            }
+                            slots_[slot] = index;
+                            placed.push_back(slot);
+                        }
+                        if (!done) {
+                            // このバケットで仮置きしたスロットを戻す
+                            for (size_t slot : placed) {
+                                slots_[slot] = EMPTY;
+                            }
                         } else {
-                            // 短縮形オプション (-o or -o value or -abc)
-                            _process_short_option(arg);
+                            displacements_[b] = d;
                         }
-                    } else {
-                        // 位置引数
-                        tokens_.push_back(Token(Token::POSITIONAL, arg));
+                    }
+                    if (!done) {
+                        return false;
                     }
                 }
+                return true;
             }
+        };
+        
+        // NamespaceSchema: 保存キー → 密なスロット番号の凍結済み対応表
+        // ParsePlanが構築し、そのスキーマで作られたNamespaceは値を連続配列に格納する
+        class NamespaceSchema {
+        private:
+            std::vector<std::string> keys_;  // スロット順の保存キー
+            OptionTable index_;
+            std::vector<std::shared_ptr<Argument>> arguments_;   // 引数定義（解析計画の定義順）
+            std::vector<std::vector<size_t>> slot_arguments_;    // スロット → arguments_ のインデックス
             
-            // 次のトークンを取得
-            Token next() {
-                if (current_index_ >= tokens_.size()) {
-                    throw std::runtime_error("No more tokens available");
+        public:
+            enum : size_t { npos = static_cast<size_t>(-1) };
+            
+            explicit NamespaceSchema(const std::vector<std::string>& keys) : keys_(keys) {
+                std::vector<std::pair<std::string, size_t>> items;
+                items.reserve(keys.size());
+                for (size_t i = 0; i < keys.size(); ++i) {
+                    items.push_back(std::make_pair(keys[i], i));
                 }
-                return tokens_[current_index_++];
+                index_ = OptionTable(items);
+                slot_arguments_.resize(keys.size());
             }
             
-            // 現在のトークンを確認（消費しない）
-            Token peek() const {
-                if (current_index_ >= tokens_.size()) {
-                    throw std::runtime_error("No more tokens available");
-                }
-                return tokens_[current_index_];
+            // スロットに書き込む引数定義を登録（解析計画の構築時のみ）
+            void add_argument(size_t slot, const std::shared_ptr<Argument>& argument) {
+                slot_arguments_[slot].push_back(arguments_.size());
+                arguments_.push_back(argument);
             }
             
-            // トークンが残っているかチェック
-            bool has_next() const {
-                return current_index_ < tokens_.size();
+            // 登録順 index 番目の引数定義
+            const std::shared_ptr<Argument>& argument(size_t index) const { return arguments_[index]; }
+            
+            // スロットに書き込む引数定義の数
+            size_t slot_argument_count(size_t slot) const { return slot_arguments_[slot].size(); }
+            
+            // スロットの既定値（同じスロットの引数のうち最後に定義されたもの、無ければnullptr）
+            // 遅延変換モードでは既定値をNamespaceへ複写せず、参照時にここから取り出す（実装はArgument定義後）
+            const AnyValue* default_value(size_t slot) const;
+            
+            // スロット数
+            size_t size() const { return keys_.size(); }
+            
+            // キーからスロットを解決（無ければnpos）
+            size_t slot(StringView key) const {
+                size_t found = index_.find(key);
+                return found == OptionTable::npos ? static_cast<size_t>(npos) : found;
             }
             
-            // インデックスをリセット
-            void reset() {
-                current_index_ = 0;
+            // スロットのキー
+            const std::string& key(size_t slot) const { return keys_[slot]; }
+        };
+        
+        // HelpGenerator: ヘルプメッセージの生成
+        class HelpGenerator {
+        public:
+            // ヘルプメッセージを生成（実装はArgumentParserクラス定義後）
+            static std::string generate_help(const ArgumentParser& parser);
+        };
+        
+        // ActionKind: action文字列を定義時に解決した種別（解析ループではswitchで分岐する）
+        enum class ActionKind {
+            STORE,        // "store"（既定）
+            STORE_TRUE,   // "store_true"
+            STORE_FALSE,  // "store_false"
+            COUNT,        // "count"
+            APPEND,       // "append"
+            EXTEND,       // "extend"
+            HELP,         // "help"
+            CUSTOM,       // custom_action() で設定されたハンドラ
+            UNKNOWN       // 未対応のaction（解析時にエラー）
+        };
+        
+        // action文字列をActionKindに解決
+        inline ActionKind resolve_action(const std::string& action) {
+            if (action.empty() || action == "store") return ActionKind::STORE;
+            if (action == "store_true") return ActionKind::STORE_TRUE;
+            if (action == "store_false") return ActionKind::STORE_FALSE;
+            if (action == "count") return ActionKind::COUNT;
+            if (action == "append") return ActionKind::APPEND;
+            if (action == "extend") return ActionKind::EXTEND;
+            if (action == "help") return ActionKind::HELP;
+            if (action == "custom") return ActionKind::CUSTOM;
+            return ActionKind::UNKNOWN;
+        }
+        
+        // 値を取るactionかどうか（ヘルプのmetavar表示に使用）
+        inline bool action_takes_value(ActionKind kind) {
+            switch (kind) {
+                case ActionKind::STORE_TRUE:
+                case ActionKind::STORE_FALSE:
+                case ActionKind::COUNT:
+                case ActionKind::HELP:
+                    return false;
+                default:
+                    return true;
             }
+        }
+        
+        // ChoiceIndex: choices() で一度だけ構築する選択肢の検索表
+        // 検証とエラーメッセージの組み立てで同じ表を使う（型が異なる値は選択肢に含まれない）
+        class ChoiceIndex {
+        public:
+            virtual ~ChoiceIndex() {}
             
-            // 全トークンの取得（デバッグ用）
-            const std::vector<Token>& get_tokens() const {
-                return tokens_;
+            // 変換済みの値が選択肢に含まれるか
+            virtual bool contains(const AnyValue& value) const = 0;
+            
+            // エラーメッセージ用に値を文字列にする（表示できない型ならfalse）
+            virtual bool format(const AnyValue& value, std::string& out) const = 0;
+        };
+        
+        // std::hash<T> が使える型か
+        template<typename T>
+        struct IsHashable {
+            template<typename U>
+            static auto test(int) -> decltype(std::hash<U>()(std::declval<const U&>()), std::true_type());
+            template<typename U>
+            static std::false_type test(...);
+            
+            static const bool value = decltype(test<T>(0))::value;
+        };
+        
+        // operator< で順序付けできる型か
+        template<typename T>
+        struct IsOrdered {
+            template<typename U>
+            static auto test(int) -> decltype(std::declval<const U&>() < std::declval<const U&>(), std::true_type());
+            template<typename U>
+            static std::false_type test(...);
+            
+            static const bool value = decltype(test<T>(0))::value;
+        };
+        
+        // 選択肢の格納方法：ハッシュ可能なら O(1)、順序付け可能なら二分探索で O(log n)、それ以外は線形探索
+        template<typename T>
+        class HashedChoices {
+        private:
+            std::unordered_set<T> items_;
+        public:
+            explicit HashedChoices(const std::vector<T>& items) : items_(items.begin(), items.end()) {}
+            bool contains(const T& value) const { return items_.find(value) != items_.end(); }
+        };
+        
+        template<typename T>
+        class SortedChoices {
+        private:
+            std::vector<T> items_;
+        public:
+            explicit SortedChoices(const std::vector<T>& items) : items_(items) {
+                std::sort(items_.begin(), items_.end());
             }
+            bool contains(const T& value) const { return std::binary_search(items_.begin(), items_.end(), value); }
+        };
+        
+        template<typename T>
+        class LinearChoices {
+        private:
+            std::vector<T> items_;
+        public:
+            explicit LinearChoices(const std::vector<T>& items) : items_(items) {}
+            bool contains(const T& value) const { return std::find(items_.begin(), items_.end(), value) != items_.end(); }
+        };
+        
+        // エラーメッセージ・metavar 用の値の表示（数値は number_text、bool は true/false、文字列はそのまま）
+        template<typename T>
+        inline typename std::enable_if<std::is_arithmetic<T>::value, bool>::type
+        format_choice_value(const T& value, std::string& out) {
+            out = number_text(value);
+            return true;
+        }
+        
+        inline bool format_choice_value(bool value, std::string& out) {
+            out = value ? "true" : "false";
+            return true;
+        }
+        
+        inline bool format_choice_value(const std::string& value, std::string& out) {
+            out = value;
+            return true;
+        }
+        
+        template<typename T>
+        inline typename std::enable_if<!std::is_arithmetic<T>::value, bool>::type
+        format_choice_value(const T&, std::string&) {
+            return false;
+        }
+        
+        template<typename T>
+        class TypedChoiceIndex final : public ChoiceIndex {
+        private:
+            typedef typename std::conditional<IsHashable<T>::value, HashedChoices<T>,
+                typename std::conditional<IsOrdered<T>::value, SortedChoices<T>, LinearChoices<T>>::type>::type Storage;
             
-            // トークン数の取得
-            size_t size() const {
-                return tokens_.size();
+            Storage storage_;
+            
+        public:
+            explicit TypedChoiceIndex(const std::vector<T>& items) : storage_(items) {}
+            
+            bool contains(const AnyValue& value) const override {
+                const T* typed = value.try_get<T>();
+                return typed && storage_.contains(*typed);
             }
             
-            // 現在位置の取得
-            size_t position() const {
-                return current_index_;
+            bool format(const AnyValue& value, std::string& out) const override {
+                const T* typed = value.try_get<T>();
+                return typed && format_choice_value(*typed, out);
             }
+        };
+    }
+    
+    namespace detail {
+        // FieldBinding: 解析結果を利用者の構造体のメンバへ直接書き込む（Argument::bind()）
+        class FieldBinding {
+        public:
+            virtual ~FieldBinding() {}
             
-            // 指定位置にシーク
-            void seek(size_t pos) {
-                if (pos > tokens_.size()) {
-                    pos = tokens_.size();
+            // メンバを持つ構造体の型
+            virtual const std::type_info& owner() const = 0;
+            
+            // owner のメンバへ値を書き込む（型が合わなければfalse）。movable なら値を移動する
+            virtual bool assign(void* owner, AnyValue& value, bool movable) const = 0;
+        };
+        
+        template<typename T>
+        inline typename std::enable_if<std::is_signed<T>::value, bool>::type is_negative(T value) { return value < 0; }
+        
+        template<typename T>
+        inline typename std::enable_if<!std::is_signed<T>::value, bool>::type is_negative(T) { return false; }
+        
+        // 算術型どうしの代入（整数は値が収まる場合のみ、浮動小数点数から整数へは不可）
+        template<typename Field, typename Source>
+        inline bool assign_arithmetic(Field& field, const AnyValue& value) {
+            const Source* source = value.try_get<Source>();
+            if (!source) {
+                return false;
+            }
+            if (std::is_integral<Field>::value && !std::is_integral<Source>::value) {
+                return false;
+            }
+            Field converted = static_cast<Field>(*source);
+            if (std::is_integral<Field>::value &&
+                (static_cast<Source>(converted) != *source || is_negative(converted) != is_negative(*source))) {
+                return false;
+            }
+            field = converted;
+            return true;
+        }
+        
+        template<typename Field>
+        inline typename std::enable_if<std::is_arithmetic<Field>::value, bool>::type
+        assign_converted(Field& field, const AnyValue& value) {
+            return assign_arithmetic<Field, int>(field, value) ||
+                   assign_arithmetic<Field, bool>(field, value) ||
+                   assign_arithmetic<Field, long>(field, value) ||
+                   assign_arithmetic<Field, long long>(field, value) ||
+                   assign_arithmetic<Field, unsigned>(field, value) ||
+                   assign_arithmetic<Field, unsigned long>(field, value) ||
+                   assign_arithmetic<Field, unsigned long long>(field, value) ||
+                   assign_arithmetic<Field, short>(field, value) ||
+                   assign_arithmetic<Field, unsigned short>(field, value) ||
+                   assign_arithmetic<Field, signed char>(field, value) ||
+                   assign_arithmetic<Field, unsigned char>(field, value) ||
+                   assign_arithmetic<Field, double>(field, value) ||
+                   assign_arithmetic<Field, float>(field, value);
+        }
+        
+        template<typename Field>
+        inline typename std::enable_if<!std::is_arithmetic<Field>::value, bool>::type
+        assign_converted(Field&, const AnyValue&) {
+            return false;
+        }
+        
+        // 格納された値をメンバへ書き込む（同じ型なら移動、算術型は範囲内なら変換）
+        template<typename Field>
+        inline bool assign_field(Field& field, AnyValue& value, bool movable) {
+            if (Field* typed = value.try_get<Field>()) {
+                if (movable) {
+                    field = std::move(*typed);
+                } else {
+                    field = *typed;
                 }
-                current_index_ = pos;
+                return true;
             }
+            return assign_converted(field, value);
+        }
+        
+        template<typename Owner, typename Field>
+        class MemberBinding final : public FieldBinding {
+        private:
+            Field Owner::* member_;
+            
+        public:
+            explicit MemberBinding(Field Owner::* member) : member_(member) {}
             
+            const std::type_info& owner() const override { return typeid(Owner); }
+            
+            bool assign(void* owner, AnyValue& value, bool movable) const override {
+                return assign_field(static_cast<Owner*>(owner)->*member_, value, movable);
+            }
+        };
+    }
+    
+    // One entry of a static name -> enum value table for Argument::choices()
+    template<typename E>
+    struct EnumChoice {
+        const char* name;
+        E value;
+    };
+    
+    namespace detail {
+        // EnumChoiceTable: 名前 → 列挙値の凍結済み対応表
+        // 名前の検索はOptionTable（完全ハッシュ、hash-and-displace）でハッシュ1回＋比較1回、
+        // 値 → 名前の逆引き（検証とメッセージ用）は基底型で整列した配列の二分探索
+        template<typename E>
+        class EnumChoiceTable final : public ChoiceIndex {
         private:
-            // 長形式オプションの処理 (--option or --option=value)
-            void _process_long_option(const std::string& arg) {
-                size_t equals_pos = arg.find('=');
-                
-                if (equals_pos != std::string::npos) {
-                    // --option=value 形式
-                    std::string option = arg.substr(0, equals_pos);
-                    std::string value = arg.substr(equals_pos + 1);
-                    
-                    // 引用符の処理
-                    value = _unquote_string(value);
-                    
-                    tokens_.push_back(Token(Token::LONG_OPTION, option, arg));
-                    tokens_.push_back(Token(Token::OPTION_VALUE, value, arg));
-                } else {
-                    // --option 形式
-                    tokens_.push_back(Token(Token::LONG_OPTION, arg));
+            typedef typename std::underlying_type<E>::type Underlying;
+            
+            std::vector<std::string> names_;
+            std::vector<E> values_;
+            OptionTable lookup_;                                 // 名前 → names_/values_ のインデックス
+            std::vector<std::pair<Underlying, size_t>> by_value_;  // 基底値で整列（同じ値は最初の名前）
+            
+        public:
+            template<size_t N>
+            explicit EnumChoiceTable(const EnumChoice<E> (&table)[N]) {
+                std::vector<std::pair<std::string, size_t>> items;
+                items.reserve(N);
+                names_.reserve(N);
+                values_.reserve(N);
+                by_value_.reserve(N);
+                for (size_t i = 0; i < N; ++i) {
+                    names_.push_back(table[i].name);
+                    values_.push_back(table[i].value);
+                    items.push_back(std::make_pair(names_.back(), i));
+                    by_value_.push_back(std::make_pair(static_cast<Underlying>(table[i].value), i));
                 }
+                lookup_ = OptionTable(items);
+                std::stable_sort(by_value_.begin(), by_value_.end(),
+                                 [](const std::pair<Underlying, size_t>& a, const std::pair<Underlying, size_t>& b) {
+                                     return a.first < b.first;
+                                 });
             }
             
-            // 短縮形オプションの処理 (-o or -abc)
-            void _process_short_option(const std::string& arg) {
-                if (arg.length() == 2) {
-                    // 単一の短縮形オプション (-o)
-                    tokens_.push_back(Token(Token::SHORT_OPTION, arg));
-                } else {
-                    // 複数の短縮形オプション (-abc → -a -b -c)
-                    for (size_t i = 1; i < arg.length(); ++i) {
-                        std::string single_opt = "-" + std::string(1, arg[i]);
-                        tokens_.push_back(Token(Token::SHORT_OPTION, single_opt, arg));
-                    }
+            // 名前から列挙値を求める（見つからなければfalse）
+            bool find(StringView name, E& out) const {
+                size_t index = lookup_.find(name);
+                if (index == OptionTable::npos) {
+                    return false;
                 }
+                out = values_[index];
+                return true;
             }
             
-            // 引用符付き文字列の処理
-            std::string _unquote_string(const std::string& str) {
-                if (str.length() < 2) {
-                    return str;
+            size_t size() const { return values_.size(); }
+            const std::string& name(size_t index) const { return names_[index]; }
+            E value(size_t index) const { return values_[index]; }
+            
+            bool contains(const AnyValue& value) const override {
+                const E* typed = value.try_get<E>();
+                return typed && _index_of(*typed) != OptionTable::npos;
+            }
+            
+            bool format(const AnyValue& value, std::string& out) const override {
+                const E* typed = value.try_get<E>();
+                if (!typed) {
+                    return false;
                 }
-                
-                char first = str[0];
-                char last = str[str.length() - 1];
-                
-                // ダブルクォートまたはシングルクォートで囲まれている場合
-                if ((first == '"' && last == '"') || (first == '\'' && last == '\'')) {
-                    std::string result = str.substr(1, str.length() - 2);
-                    
-                    // エスケープシーケンスの処理
-                    if (first == '"') {
-                        result = _process_escape_sequences(result);
-                    }
-                    
-                    return result;
+                size_t index = _index_of(*typed);
+                if (index == OptionTable::npos) {
+                    return false;
                 }
-                
-                return str;
+                out = names_[index];
+                return true;
             }
             
-            // エスケープシーケンスの処理
-            std::string _process_escape_sequences(const std::string& str) {
-                std::string result;
-                result.reserve(str.length());
-                
-                for (size_t i = 0; i < str.length(); ++i) {
-                    if (str[i] == '\\' && i + 1 < str.length()) {
-                        char next = str[i + 1];
-                        switch (next) {
-                            case 'n': result += '\n'; break;
-                            case 't': result += '\t'; break;
-                            case 'r': result += '\r'; break;
-                            case '\\': result += '\\'; break;
-                            case '"': result += '"'; break;
-                            case '\'': result += '\''; break;
-                            default:
-                                // 不明なエスケープシーケンスはそのまま保持
-                                result += '\\';
-                                result += next;
-                                break;
-                        }
-                        ++i;  // 次の文字をスキップ
-                    } else {
-                        result += str[i];
-                    }
+        private:
+            size_t _index_of(E value) const {
+                Underlying key = static_cast<Underlying>(value);
+                auto it = std::lower_bound(by_value_.begin(), by_value_.end(), key,
+                                           [](const std::pair<Underlying, size_t>& entry, Underlying k) {
+                                               return entry.first < k;
+                                           });
+                if (it == by_value_.end() || it->first != key) {
+                    return OptionTable::npos;
                 }
-                
-                return result;
+                return it->second;
             }
         };
         
-        // HelpGenerator: ヘルプメッセージの生成
-        class HelpGenerator {
-        public:
-            // ヘルプメッセージを生成（実装はArgumentParserクラス定義後）
-            static std::string generate_help(const ArgumentParser& parser);
+        // 列挙値の名前による変換器
+        // 未知の名前は文字列のまま返し、選択肢の検証で INVALID_CHOICE として報告させる
+        template<typename E>
+        struct EnumConversion {
+            std::shared_ptr<const EnumChoiceTable<E>> table;
+            
+            AnyValue operator()(const std::string& text) const {
+                E value;
+                if (table->find(StringView(text), value)) {
+                    return AnyValue(value);
+                }
+                return AnyValue(text);
+            }
+        };
+        
+        // stream() の受け取り側：変換済みの値を T として利用者の関数に渡す
+        // 引数定義ごとに1つで、並行する解析からは同じ関数が同時に呼ばれる（排他は利用者の責任）
+        template<typename T, typename Fn>
+        struct StreamSink {
+            mutable Fn function;
+            
+            void operator()(const AnyValue& value) const {
+                function(value.get<T>());
+            }
         };
     }
     
@@ -739,17 +4225,28 @@ namespace argparse {
         std::string help;                           // Help text
         std::string metavar;                        // Display name in help
         std::string action;                         // "store", "store_true", etc.
+        detail::ActionKind action_kind;             // action resolved at definition time
         std::string type_name;                      // "int", "float", "string"
         detail::AnyValue default_value;             // Default value (type-erased)
         std::vector<detail::AnyValue> choices;      // Valid choices
+        std::shared_ptr<const detail::ChoiceIndex> choice_index;  // Lookup table built by choices()
+        std::shared_ptr<const detail::FieldBinding> binding;      // Struct member set by bind()
         int nargs;                                  // Number of arguments (-1 = any)
         bool required;                              // Required flag
-        std::function<detail::AnyValue(const std::string&)> converter;
-        std::function<bool(const detail::AnyValue&)> validator;
-        std::function<detail::AnyValue(const detail::AnyValue&, const std::string&)> custom_action;  // Custom action handler
+        detail::Converter converter;                // String -> value conversion
+        detail::ValueAppender appender;             // Accumulates converted values for append/extend
+        detail::ListConverter list_converter;       // Batched conversion for multi-value nargs (built-in types)
+        detail::TryConverter try_converter;         // Non-throwing conversion (built-in types)
+        detail::ConversionErrorFormat conversion_error;  // Message for a try_converter failure
+        detail::Validator validator;
+        detail::ActionHandler custom_action;        // Custom action handler
+        detail::ValueSink stream_sink;              // Receives each value of a streamed positional (stream())
         
         ArgumentDefinition() 
-            : action("store"), type_name("string"), nargs(1), required(false) {}
+            : action("store"), action_kind(detail::ActionKind::STORE), type_name("string"), nargs(1), required(false)
+            , appender(&detail::append_typed_value<std::string>)
+            , list_converter(&detail::convert_list<std::string>)
+            , try_converter(nullptr), conversion_error(nullptr) {}
     };
     
     // ArgumentGroup class for grouping related arguments
@@ -829,6 +4326,7 @@ namespace argparse {
         
         Argument& action(const std::string& action_type) {
             definition_.action = action_type;
+            definition_.action_kind = detail::resolve_action(action_type);
             return *this;
         }
         
@@ -836,9 +4334,13 @@ namespace argparse {
         template<typename T>
         Argument& type() {
             definition_.converter = detail::TypeConverter::get_converter<T>();
+            definition_.appender = &detail::append_typed_value<T>;
+            definition_.list_converter = &detail::convert_list<T>;
+            definition_.try_converter = detail::builtin_try_converter<T>();
+            definition_.conversion_error = detail::builtin_conversion_error<T>();
             // 型名を設定
-            if (std::is_same<T, int>::value) {
-                definition_.type_name = "int";
+            if (std::is_integral<T>::value && !std::is_same<T, bool>::value) {
+                definition_.type_name = detail::integer_type_name<T>();
             } else if (std::is_same<T, float>::value) {
                 definition_.type_name = "float";
             } else if (std::is_same<T, double>::value) {
@@ -862,12 +4364,33 @@ namespace argparse {
         template<typename T>
         Argument& choices(const std::vector<T>& choice_list) {
             definition_.choices.clear();
+            definition_.choices.reserve(choice_list.size());
             for (const auto& choice : choice_list) {
                 definition_.choices.push_back(detail::AnyValue(choice));
             }
+            definition_.choice_index = std::make_shared<detail::TypedChoiceIndex<T>>(choice_list);
             return *this;
         }
-        
+
+        // Restrict to the names of a static (name, enum value) table and store the enum value.
+        // Help and "invalid choice" messages list the names.
+        template<typename E, size_t N>
+        Argument& choices(const EnumChoice<E> (&table)[N]) {
+            static_assert(std::is_enum<E>::value, "EnumChoice requires an enumeration type");
+            auto index = std::make_shared<const detail::EnumChoiceTable<E>>(table);
+            definition_.choices.clear();
+            definition_.choices.reserve(N);
+            for (size_t i = 0; i < N; ++i) {
+                definition_.choices.push_back(detail::AnyValue(table[i].value));
+            }
+            definition_.choice_index = index;
+            definition_.converter = detail::EnumConversion<E>{index};
+            definition_.appender = &detail::append_typed_value<E>;
+            definition_.list_converter = nullptr;
+            definition_.try_converter = nullptr;
+            return *this;
+        }
+
         Argument& nargs(int count) {
             definition_.nargs = count;
             return *this;
@@ -892,22 +4415,57 @@ namespace argparse {
         }
         
         // カスタム型変換器の設定
-        template<typename T>
-        Argument& converter(std::function<T(const std::string&)> converter_func) {
-            definition_.converter = detail::TypeConverter::create_custom_converter<T>(converter_func);
+        template<typename T, typename Fn>
+        Argument& converter(Fn converter_func) {
+            definition_.converter = detail::TypeConverter::create_custom_converter<T>(std::move(converter_func));
+            definition_.appender = &detail::append_typed_value<T>;
+            definition_.list_converter = nullptr;
+            definition_.try_converter = nullptr;
             return *this;
         }
         
         // 直接的なconverter設定（上級者向け）
-        Argument& converter(std::function<detail::AnyValue(const std::string&)> converter_func) {
-            definition_.converter = converter_func;
+        Argument& converter(detail::Converter converter_func) {
+            definition_.converter = std::move(converter_func);
+            definition_.appender = &detail::append_any_value;
+            definition_.list_converter = nullptr;
+            definition_.try_converter = nullptr;
+            return *this;
+        }
+        
+        // Store the parsed value directly into a struct member (see ArgumentParser::parse_into).
+        // A member of a built-in type (or a std::vector of one, for nargs/append) also sets type<T>()
+        // unless a converter was already chosen.
+        template<typename Owner, typename Field>
+        Argument& bind(Field Owner::* member) {
+            definition_.binding = std::make_shared<const detail::MemberBinding<Owner, Field>>(member);
+            if (definition_.converter.invoker() == detail::TypeConverter::string_converter().invoker()) {
+                _bind_type(static_cast<Field*>(nullptr));
+            }
+            return *this;
+        }
+        
+        // Streaming positional (nargs "*", "+" or "remainder"): instead of collecting a list, pass each
+        // value to fn(const T&) as soon as it is read and converted, so memory stays flat however many
+        // values follow. The Namespace holds only the number of values (get<size_t>(name)).
+        // Like bind(), a built-in T also sets type<T>() unless a converter was already chosen.
+        // fn is shared by every parse of this definition: when the parser is used concurrently
+        // (parse_batch_parallel, const parse_args), fn is called from several threads at once
+        // and must be thread-safe.
+        template<typename T, typename Fn>
+        Argument& stream(Fn fn) {
+            if (definition_.converter.invoker() == detail::TypeConverter::string_converter().invoker()) {
+                _bind_type(static_cast<T*>(nullptr));
+            }
+            definition_.stream_sink = detail::StreamSink<T, Fn>{std::move(fn)};
             return *this;
         }
         
         // カスタムアクション設定
-        Argument& custom_action(std::function<detail::AnyValue(const detail::AnyValue&, const std::string&)> action_func) {
-            definition_.custom_action = action_func;
+        Argument& custom_action(detail::ActionHandler action_func) {
+            definition_.custom_action = std::move(action_func);
             definition_.action = "custom";
+            definition_.action_kind = detail::ActionKind::CUSTOM;
             return *this;
         }
         
@@ -946,20 +4504,27 @@ namespace argparse {
             return detail::AnyValue(str_value);  // Default to string
         }
         
+        // Check whether a value is one of the choices (true when no choices are set)
+        bool is_choice(const detail::AnyValue& value) const {
+            if (definition_.choices.empty()) {
+                return true;
+            }
+            if (definition_.choice_index) {
+                return definition_.choice_index->contains(value);
+            }
+            // choices set directly on the definition: linear scan
+            for (const auto& choice : definition_.choices) {
+                if (choice.equals(value)) {
+                    return true;
+                }
+            }
+            return false;
+        }
+        
         // Validate value using the configured validator
         bool validate_value(const detail::AnyValue& value) const {
-            // Check choices if specified
-            if (!definition_.choices.empty()) {
-                bool found = false;
-                for (const auto& choice : definition_.choices) {
-                    if (choice.equals(value)) {
-                        found = true;
-                        break;
-                    }
-                }
-                if (!found) {
-                    return false;
-                }
+            if (!is_choice(value)) {
+                return false;
             }
             
             // Use custom validator if provided
@@ -972,71 +4537,66 @@ namespace argparse {
         
         // Generate error message for validation failure
         std::string get_validation_error_message(const detail::AnyValue& value) const {
-            // Check choices if specified
-            if (!definition_.choices.empty()) {
-                bool found = false;
-                for (const auto& choice : definition_.choices) {
-                    if (choice.equals(value)) {
-                        found = true;
-                        break;
-                    }
-                }
-                if (!found) {
-                    std::string error_msg = "invalid choice: ";
-                    
-                    // Try to get string representation of the value
-                    try {
-                        if (value.type() == typeid(std::string)) {
-                            error_msg += "'" + value.get<std::string>() + "'";
-                        } else if (value.type() == typeid(int)) {
-                            error_msg += "'" + std::to_string(value.get<int>()) + "'";
-                        } else if (value.type() == typeid(double)) {
-                            error_msg += "'" + std::to_string(value.get<double>()) + "'";
-                        } else {
-                            error_msg += "(value)";
-                        }
-                    } catch (...) {
-                        error_msg += "(value)";
-                    }
-                    
-                    error_msg += " (choose from ";
-                    
-                    // Add choices to error message
-                    for (size_t i = 0; i < definition_.choices.size(); ++i) {
-                        if (i > 0) error_msg += ", ";
-                        error_msg += "'";
-                        
-                        try {
-                            const auto& choice = definition_.choices[i];
-                            if (choice.type() == typeid(std::string)) {
-                                error_msg += choice.get<std::string>();
-                            } else if (choice.type() == typeid(int)) {
-                                error_msg += std::to_string(choice.get<int>());
-                            } else if (choice.type() == typeid(double)) {
-                                error_msg += std::to_string(choice.get<double>());
-                            } else {
-                                error_msg += "?";
-                            }
-                        } catch (...) {
-                            error_msg += "?";
-                        }
-                        
-                        error_msg += "'";
-                    }
-                    error_msg += ")";
-                    return error_msg;
-                }
+            if (is_choice(value)) {
+                return "validation failed";
+            }
+            
+            std::string error_msg = "invalid choice: ";
+            std::string text;
+            if (_format_choice(value, text)) {
+                error_msg += "'" + text + "'";
+            } else {
+                error_msg += "(value)";
             }
             
-            return "validation failed";
+            error_msg += " (choose from ";
+            for (size_t i = 0; i < definition_.choices.size(); ++i) {
+                if (i > 0) error_msg += ", ";
+                error_msg += "'";
+                error_msg += _format_choice(definition_.choices[i], text) ? text : std::string("?");
+                error_msg += "'";
+            }
+            error_msg += ")";
+            return error_msg;
         }
         
     private:
         // Setup default string converter
         void _setup_default_converter() {
-            definition_.converter = [](const std::string& value) -> detail::AnyValue {
-                return detail::AnyValue(value);
-            };
+            definition_.converter = detail::TypeConverter::string_converter();
+        }
+        
+        // Pick type<T>() from a bound member type (no-op for types without a built-in converter)
+        template<typename T>
+        typename std::enable_if<detail::HasBuiltinParser<T>::value>::type _bind_type(T*) {
+            type<T>();
+        }
+        
+        template<typename T>
+        typename std::enable_if<detail::HasBuiltinParser<T>::value>::type _bind_type(std::vector<T>*) {
+            type<T>();
+        }
+        
+        template<typename T>
+        typename std::enable_if<!detail::HasBuiltinParser<T>::value>::type _bind_type(T*) {}
+        
+        // Format a value for the choices error message
+        bool _format_choice(const detail::AnyValue& value, std::string& out) const {
+            if (definition_.choice_index && definition_.choice_index->format(value, out)) {
+                return true;
+            }
+            if (const std::string* text = value.try_get<std::string>()) {
+                out = *text;
+            } else if (const int* number = value.try_get<int>()) {
+                out = std::to_string(*number);
+            } else if (const double* real = value.try_get<double>()) {
+                out = std::to_string(*real);
+            } else if (const float* single = value.try_get<float>()) {
+                out = std::to_string(*single);
+            } else {
+                return false;
+            }
+            return true;
         }
         
     };
@@ -1063,6 +4623,8 @@ namespace argparse {
         std::string epilog_;
         std::string usage_;
         bool add_help_;
+        bool lazy_conversion_;
+        std::string fromfile_prefix_chars_;
         
         std::vector<std::shared_ptr<Argument>> arguments_;
         std::map<std::string, std::shared_ptr<Argument>> argument_map_;
@@ -1070,13 +4632,17 @@ namespace argparse {
         std::shared_ptr<ArgumentGroup> positional_group_;
         std::shared_ptr<ArgumentGroup> optional_group_;
         
+        // 解析計画のキャッシュ（引数追加時に破棄される）
+        mutable std::shared_ptr<const detail::ParsePlan> plan_;
+        
     public:
         // コンストラクタ
         explicit ArgumentParser(const std::string& prog = "", 
                                const std::string& description = "",
                                const std::string& epilog = "",
                                bool add_help = true)
-            : prog_(prog.empty() ? "program" : prog), description_(description), epilog_(epilog), add_help_(add_help) {
+            : prog_(prog.empty() ? "program" : prog), description_(description), epilog_(epilog), add_help_(add_help)
+            , lazy_conversion_(false) {
             
             // prog が空の場合は"program"をデフォルトとして設定
             // parse_argsでargv[0]から上書きされる場合がある
@@ -1100,6 +4666,7 @@ namespace argparse {
             
             auto arg = std::make_shared<Argument>(name);
             arguments_.push_back(arg);
+            plan_.reset();
             
             // 引数名をマップに登録（位置引数かオプション引数かに関わらず）
             argument_map_[name] = arg;
@@ -1123,6 +4690,7 @@ namespace argparse {
             
             auto arg = std::make_shared<Argument>(names);
             arguments_.push_back(arg);
+            plan_.reset();
             
             // 両方の名前をマップに登録
             argument_map_[short_name] = arg;
@@ -1140,6 +4708,7 @@ namespace argparse {
             
             auto arg = std::make_shared<Argument>(names);
             arguments_.push_back(arg);
+            plan_.reset();
             
             // すべての名前をマップに登録
             for (const auto& name : names) {
@@ -1215,6 +4784,34 @@ namespace argparse {
             return add_help_;
         }
         
+        // Lazy conversion: keep single values as strings and convert them (and copy defaults)
+        // on first access. Conversion and choice errors are thrown by Namespace::get()
+        // or reported together by Namespace::validate().
+        // Reads convert in place, so a lazy Namespace must not be read from several threads
+        // at once; call Namespace::resolve() before sharing it.
+        ArgumentParser& lazy_conversion(bool enabled = true) {
+            lazy_conversion_ = enabled;
+            plan_.reset();
+            return *this;
+        }
+        
+        bool lazy_conversion_enabled() const {
+            return lazy_conversion_;
+        }
+        
+        // Response files: an argument starting with one of these characters ("@" → "@args.txt")
+        // is replaced by the arguments read from that file. Arguments are separated by whitespace
+        // with shell-like quoting, and files may name further response files. Empty disables expansion.
+        ArgumentParser& fromfile_prefix_chars(const std::string& chars) {
+            fromfile_prefix_chars_ = chars;
+            plan_.reset();
+            return *this;
+        }
+        
+        const std::string& fromfile_prefix_chars() const {
+            return fromfile_prefix_chars_;
+        }
+        
         // Get all argument groups
         const std::vector<std::shared_ptr<ArgumentGroup>>& get_groups() const {
             return groups_;
@@ -1236,6 +4833,38 @@ namespace argparse {
         // Parse from string vector (declaration only, implementation after detail::Parser)
         Namespace parse_args(const std::vector<std::string>& args, bool throw_on_error = true);
         
+        // Parse without throwing: errors and help requests are reported in the result
+        // (implementation after CompiledParser definition)
+        ParseResult try_parse_args(int argc, char* argv[]);
+        ParseResult try_parse_args(const std::vector<std::string>& args);
+        
+        // Parse without modifying the parser, reporting help and errors to output instead of
+        // std::cout/std::cerr and process exit; safe to call from several threads at once
+        // (argv[0] is skipped and, unlike parse_args(argc, argv), never becomes the program name)
+        ParseResult parse_args(int argc, char* argv[], ParseOutput& output) const;
+        ParseResult parse_args(const std::vector<std::string>& args, ParseOutput& output) const;
+        
+        // Freeze the current argument definitions into a reusable parser
+        // (implementation after CompiledParser definition)
+        CompiledParser compile() const;
+        
+        // Parse and store values of bind() arguments directly into the members of target
+        // (implementation after CompiledParser definition)
+        template<typename Owner>
+        void parse_into(int argc, char* argv[], Owner& target, bool throw_on_error = true);
+        template<typename Owner>
+        void parse_into(const std::vector<std::string>& args, Owner& target, bool throw_on_error = true);
+        
+        // Parse into a value-initialized Owner
+        template<typename Owner>
+        Owner parse_into(int argc, char* argv[]);
+        template<typename Owner>
+        Owner parse_into(const std::vector<std::string>& args);
+        
+        // Parse without throwing, storing bound values into target on success
+        template<typename Owner>
+        ParseResult try_parse_into(const std::vector<std::string>& args, Owner& target);
+        
     private:
         // Extract program name from path (removes directory path)
         std::string _extract_prog_name(const std::string& argv0) const {
@@ -1338,6 +4967,7 @@ namespace argparse {
                     .help("show this help message and exit");
             
             arguments_.push_back(help_arg);
+            plan_.reset();
             argument_map_["--help"] = help_arg;
             argument_map_["-h"] = help_arg;
             
@@ -1348,33 +4978,86 @@ namespace argparse {
         }
     };
     
+    namespace detail {
+        inline const AnyValue* NamespaceSchema::default_value(size_t slot) const {
+            const std::vector<size_t>& indices = slot_arguments_[slot];
+            for (size_t i = indices.size(); i > 0; --i) {
+                const AnyValue& value = arguments_[indices[i - 1]]->definition().default_value;
+                if (!value.empty()) {
+                    return &value;
+                }
+            }
+            return nullptr;
+        }
+        
+        // 遅延変換モードで保持していた文字列を変換・検証する（失敗時は std::invalid_argument）
+        inline AnyValue convert_pending_value(const Argument& argument, const std::string& text) {
+            AnyValue value;
+            try {
+                value = argument.convert_value(text);
+            } catch (const std::exception& e) {
+                throw std::invalid_argument("argument " + argument.get_name() + ": " + e.what());
+            }
+            if (!argument.validate_value(value)) {
+                throw std::invalid_argument("argument " + argument.get_name() + ": " +
+                                            argument.get_validation_error_message(value));
+            }
+            return value;
+        }
+    } // namespace detail
+    
     // Namespace class for storing parsed argument values
+    // Namespaces created by a parser share its frozen schema: each argument has a
+    // dense slot index, values live in a contiguous array and presence in a bitset.
+    // Keys outside the schema (ad-hoc set() calls) fall back to a hash map.
     class Namespace {
     private:
-        std::unordered_map<std::string, detail::AnyValue> values_;
+        std::shared_ptr<const detail::NamespaceSchema> schema_;
+        mutable std::vector<detail::AnyValue> slots_;
+        std::vector<uint64_t> present_;    // presence bitset, one bit per slot
+        size_t present_count_;
+        std::unordered_map<std::string, detail::AnyValue> values_;  // keys outside the schema
+        // Lazy conversion: per-slot state (0 = converted, PENDING_DEFAULT, or schema argument index + 1
+        // for a raw string still to be converted); empty unless the parser runs in lazy mode
+        mutable std::vector<uint32_t> pending_;
+        
+        enum : uint32_t { PENDING_DEFAULT = 0xFFFFFFFFu };
         
     public:
+        enum : size_t { npos = detail::NamespaceSchema::npos };
+        
         // Default constructor
-        Namespace() = default;
+        Namespace() : present_count_(0) {}
+        
+        // Construct with a slot schema (used by the parser)
+        explicit Namespace(const std::shared_ptr<const detail::NamespaceSchema>& schema)
+            : schema_(schema), slots_(schema ? schema->size() : 0)
+            , present_(schema ? (schema->size() + 63) / 64 : 0, 0), present_count_(0) {}
         
         // Copy constructor
-        Namespace(const Namespace& other) : values_(other.values_) {}
+        Namespace(const Namespace& other) = default;
         
         // Move constructor
-        Namespace(Namespace&& other) : values_(std::move(other.values_)) {}
+        Namespace(Namespace&& other)
+            : schema_(std::move(other.schema_)), slots_(std::move(other.slots_))
+            , present_(std::move(other.present_)), present_count_(other.present_count_)
+            , values_(std::move(other.values_)), pending_(std::move(other.pending_)) {
+            other.present_count_ = 0;
+        }
         
         // Copy assignment
-        Namespace& operator=(const Namespace& other) {
-            if (this != &other) {
-                values_ = other.values_;
-            }
-            return *this;
-        }
+        Namespace& operator=(const Namespace& other) = default;
         
         // Move assignment
         Namespace& operator=(Namespace&& other) {
             if (this != &other) {
+                schema_ = std::move(other.schema_);
+                slots_ = std::move(other.slots_);
+                present_ = std::move(other.present_);
+                present_count_ = other.present_count_;
                 values_ = std::move(other.values_);
+                pending_ = std::move(other.pending_);
+                other.present_count_ = 0;
             }
             return *this;
         }
@@ -1382,37 +5065,48 @@ namespace argparse {
         // Set a value by name
         template<typename T>
         void set(const std::string& name, const T& value) {
-            values_[name] = detail::AnyValue(value);
+            _value_for_write(name) = detail::AnyValue(value);
         }
         
         // Set a value by name (move version)
         template<typename T>
         void set(const std::string& name, T&& value) {
-            values_[name] = detail::AnyValue(std::forward<T>(value));
+            _value_for_write(name) = detail::AnyValue(std::forward<T>(value));
         }
         
         // Get a value by name with type safety
         template<typename T>
         T get(const std::string& name) const {
-            auto it = values_.find(name);
-            if (it == values_.end()) {
+            const detail::AnyValue* value = _find(name);
+            if (!value) {
                 throw std::runtime_error("Argument '" + name + "' not found");
             }
-            return it->second.template get<T>();
+            return value->template get<T>();
         }
         
         // Get a value by name with default value
         template<typename T>
         T get(const std::string& name, const T& default_value) const {
-            auto it = values_.find(name);
-            if (it == values_.end()) {
+            const detail::AnyValue* value = _find(name);
+            if (!value) {
                 return default_value;
             }
-            return it->second.template get<T>();
+            return value->template get<T>();
+        }
+        
+        // Get a pointer to a value without throwing (nullptr if missing or of another type)
+        template<typename T>
+        const T* try_get(const std::string& name) const {
+            const detail::AnyValue* value = _find(name);
+            return value ? value->template try_get<T>() : nullptr;
         }
         
-        // Check if a value exists
+        // Check if a value exists (does not convert lazily stored values)
         bool has(const std::string& name) const {
+            size_t slot = this->slot(name);
+            if (slot != npos) {
+                return has_slot(slot);
+            }
             return values_.find(name) != values_.end();
         }
         
@@ -1421,10 +5115,15 @@ namespace argparse {
             return has(name);
         }
         
-        // Get all argument names
+        // Get all argument names (schema slots first, in definition order)
         std::vector<std::string> keys() const {
             std::vector<std::string> result;
-            result.reserve(values_.size());
+            result.reserve(size());
+            for (size_t slot = 0; slot < slots_.size(); ++slot) {
+                if (has_slot(slot)) {
+                    result.push_back(schema_->key(slot));
+                }
+            }
             for (const auto& pair : values_) {
                 result.push_back(pair.first);
             }
@@ -1433,108 +5132,649 @@ namespace argparse {
         
         // Get number of stored values
         size_t size() const {
-            return values_.size();
+            return present_count_ + values_.size();
         }
         
         // Check if empty
         bool empty() const {
-            return values_.empty();
+            return size() == 0;
         }
         
         // Clear all values
         void clear() {
+            for (size_t slot = 0; slot < slots_.size(); ++slot) {
+                slots_[slot].reset();
+            }
+            std::fill(present_.begin(), present_.end(), 0);
+            present_count_ = 0;
             values_.clear();
+            pending_.clear();
+        }
+        
+        // Clear all values for a new parse with schema; the slots keep their storage
+        // (and the capacity of the strings and vectors in them) so that it can be reused
+        void recycle(const std::shared_ptr<const detail::NamespaceSchema>& schema) {
+            if (!schema_ || schema_ != schema || slots_.size() != schema->size()) {
+                *this = Namespace(schema);
+                return;
+            }
+            std::fill(present_.begin(), present_.end(), 0);
+            present_count_ = 0;
+            values_.clear();
+            std::fill(pending_.begin(), pending_.end(), 0);
         }
         
         // Remove a specific value
         bool remove(const std::string& name) {
+            size_t slot = this->slot(name);
+            if (slot != npos) {
+                if (!has_slot(slot)) {
+                    return false;
+                }
+                slots_[slot].reset();
+                present_[slot / 64] &= ~(uint64_t(1) << (slot % 64));
+                --present_count_;
+                if (!pending_.empty()) {
+                    pending_[slot] = 0;
+                }
+                return true;
+            }
             return values_.erase(name) > 0;
         }
         
         // Access to raw value (for advanced use)
         const detail::AnyValue& get_raw(const std::string& name) const {
-            auto it = values_.find(name);
-            if (it == values_.end()) {
+            const detail::AnyValue* value = _find(name);
+            if (!value) {
                 throw std::runtime_error("Argument '" + name + "' not found");
             }
-            return it->second;
+            return *value;
         }
         
         // Set raw value (for advanced use)
         void set_raw(const std::string& name, const detail::AnyValue& value) {
-            values_[name] = value;
+            _value_for_write(name) = value;
         }
         
         // Set raw value (move version)
         void set_raw(const std::string& name, detail::AnyValue&& value) {
-            values_[name] = std::move(value);
+            _value_for_write(name) = std::move(value);
+        }
+        
+        // Slot-based access: resolve a name once, then read and write without hashing
+        
+        // Resolve the slot of a name in the schema (npos if not part of it)
+        size_t slot(const std::string& name) const {
+            return schema_ ? schema_->slot(detail::StringView(name)) : static_cast<size_t>(npos);
+        }
+        
+        // Number of schema slots
+        size_t slot_count() const {
+            return slots_.size();
+        }
+        
+        // Check if a slot holds a value
+        bool has_slot(size_t slot) const {
+            return slot < slots_.size() && (present_[slot / 64] >> (slot % 64)) & 1;
+        }
+        
+        // Get a slot value with type safety
+        template<typename T>
+        const T& get_slot(size_t slot) const {
+            if (!has_slot(slot)) {
+                throw std::runtime_error("Slot " + std::to_string(slot) + " has no value");
+            }
+            return _resolved(slot).template get<T>();
+        }
+        
+        // Get a pointer to a slot value without throwing on absence or type mismatch
+        template<typename T>
+        const T* try_get_slot(size_t slot) const {
+            return has_slot(slot) ? _resolved(slot).template try_get<T>() : nullptr;
+        }
+        
+        // Access to a raw slot value
+        const detail::AnyValue& get_raw_slot(size_t slot) const {
+            if (!has_slot(slot)) {
+                throw std::runtime_error("Slot " + std::to_string(slot) + " has no value");
+            }
+            return _resolved(slot);
+        }
+        
+        // Set a slot value
+        template<typename T>
+        void set_slot(size_t slot, T&& value) {
+            _slot_for_write(slot) = detail::AnyValue(std::forward<T>(value));
+        }
+        
+        // Mutable access to a slot, marking it present (for in-place accumulation)
+        detail::AnyValue& raw_slot_for_write(size_t slot) {
+            if (has_slot(slot)) {
+                _resolved(slot);
+                return _slot_for_write(slot);
+            }
+            detail::AnyValue& value = _slot_for_write(slot);
+            value.reset();  // drop a value kept by recycle()
+            return value;
+        }
+        
+        // Mutable access to a slot that the caller overwrites entirely, marking it present
+        // (after recycle() it may still hold a value of an earlier parse, whose storage can be reused)
+        detail::AnyValue& recycled_slot(size_t slot) {
+            return _slot_for_write(slot);
+        }
+        
+        // Set a raw slot value
+        void set_raw_slot(size_t slot, const detail::AnyValue& value) {
+            _slot_for_write(slot) = value;
+        }
+        
+        void set_raw_slot(size_t slot, detail::AnyValue&& value) {
+            _slot_for_write(slot) = std::move(value);
+        }
+        
+        // Remove a slot value, marking it absent
+        void reset_slot(size_t slot) {
+            if (!has_slot(slot)) {
+                return;
+            }
+            present_[slot / 64] &= ~(uint64_t(1) << (slot % 64));
+            --present_count_;
+            slots_[slot].reset();
+            if (!pending_.empty()) {
+                pending_[slot] = 0;
+            }
+        }
+        
+        // Lazy conversion (used by the parser in lazy mode)
+        
+        // Store a raw string that the schema argument at argument_index converts on first access
+        void set_pending_slot(size_t slot, size_t argument_index, const std::string& text) {
+            detail::AnyValue& value = _slot_for_write(slot);
+            if (std::string* existing = value.try_get<std::string>()) {
+                existing->assign(text);
+            } else {
+                value = text;
+            }
+            _pending_for_write()[slot] = static_cast<uint32_t>(argument_index + 1);
+        }
+        
+        // Mark a slot present with the schema's default value, copied only when first read
+        void set_default_slot(size_t slot) {
+            _slot_for_write(slot).reset();
+            _pending_for_write()[slot] = PENDING_DEFAULT;
+        }
+        
+        // Check whether a value is still waiting for conversion
+        bool is_pending(const std::string& name) const {
+            size_t slot = this->slot(name);
+            return slot != npos && has_slot(slot) && !pending_.empty() && pending_[slot] != 0;
+        }
+        
+        // Convert and validate every value still waiting for conversion
+        // (throws std::invalid_argument with the first error, like the eager parser)
+        void validate() const {
+            for (size_t slot = 0; slot < pending_.size(); ++slot) {
+                if (pending_[slot] != 0 && pending_[slot] != PENDING_DEFAULT && has_slot(slot)) {
+                    _resolved(slot);
+                }
+            }
+        }
+        
+        // Convert every pending value and copy every deferred default, so that later const
+        // reads no longer write to the namespace (throws like validate()). A lazily converted
+        // namespace must not be read from several threads at once until this has been called.
+        void resolve() {
+            for (size_t slot = 0; slot < pending_.size(); ++slot) {
+                if (pending_[slot] != 0 && has_slot(slot)) {
+                    _resolved(slot);
+                }
+            }
+        }
+        
+        // Schema this namespace was created with (may be null)
+        const std::shared_ptr<const detail::NamespaceSchema>& schema() const {
+            return schema_;
+        }
+        
+    private:
+        const detail::AnyValue* _find(const std::string& name) const {
+            size_t slot = this->slot(name);
+            if (slot != npos) {
+                return has_slot(slot) ? &_resolved(slot) : nullptr;
+            }
+            auto it = values_.find(name);
+            return it == values_.end() ? nullptr : &it->second;
+        }
+        
+        detail::AnyValue& _value_for_write(const std::string& name) {
+            size_t slot = this->slot(name);
+            if (slot != npos) {
+                return _slot_for_write(slot);
+            }
+            return values_[name];
+        }
+        
+        // Mark a slot present and return its storage
+        detail::AnyValue& _slot_for_write(size_t slot) {
+            if (slot >= slots_.size()) {
+                throw std::out_of_range("Slot " + std::to_string(slot) + " is out of range");
+            }
+            uint64_t bit = uint64_t(1) << (slot % 64);
+            if (!(present_[slot / 64] & bit)) {
+                present_[slot / 64] |= bit;
+                ++present_count_;
+            }
+            if (!pending_.empty()) {
+                pending_[slot] = 0;
+            }
+            return slots_[slot];
+        }
+        
+        std::vector<uint32_t>& _pending_for_write() {
+            if (pending_.empty()) {
+                pending_.resize(slots_.size(), 0);
+            }
+            return pending_;
+        }
+        
+        // Slot value after converting a pending string or copying a deferred default (cached)
+        const detail::AnyValue& _resolved(size_t slot) const {
+            if (pending_.empty() || pending_[slot] == 0) {
+                return slots_[slot];
+            }
+            uint32_t state = pending_[slot];
+            if (state == PENDING_DEFAULT) {
+                const detail::AnyValue* value = schema_->default_value(slot);
+                if (value) {
+                    slots_[slot] = *value;
+                }
+            } else {
+                // On failure the slot stays pending, so later reads and validate() report the same error
+                const Argument& argument = *schema_->argument(state - 1);
+                slots_[slot] = detail::convert_pending_value(argument, slots_[slot].get<std::string>());
+            }
+            pending_[slot] = 0;
+            return slots_[slot];
         }
     };
     
     namespace detail {
+        // ArgumentSpec: 解析計画内の1引数分の凍結済み情報
+        struct ArgumentSpec {
+            std::shared_ptr<Argument> argument;  // 元の引数定義
+            std::string key;                     // Namespaceへの保存キー
+            size_t slot;                         // Namespace内のスロット番号（同じキーの引数は共有）
+            bool positional;                     // 位置引数かどうか
+            
+            ArgumentSpec(const std::shared_ptr<Argument>& arg, const std::string& storage_key, size_t slot_index,
+                         bool is_positional)
+                : argument(arg), key(storage_key), slot(slot_index), positional(is_positional) {}
+            
+            const ArgumentDefinition& definition() const { return argument->definition(); }
+        };
+        
+        // ParsePlan: 引数定義から一度だけ構築し、以降の解析で再利用する解析計画
+        // オプション名の検索表、保存キー、位置引数の順序を事前計算しておく
+        class ParsePlan {
+        private:
+            std::vector<ArgumentSpec> specs_;
+            std::vector<size_t> positionals_;           // specs_ 内の位置引数インデックス（定義順）
+            OptionTable options_;                       // オプション名 → specs_ インデックス
+            std::shared_ptr<const NamespaceSchema> schema_;  // 保存キー → スロット
+            bool lazy_;
+            std::string fromfile_prefix_chars_;
+            
+        public:
+            explicit ParsePlan(const std::vector<std::shared_ptr<Argument>>& arguments, bool lazy = false,
+                               const std::string& fromfile_prefix_chars = "")
+                : lazy_(lazy), fromfile_prefix_chars_(fromfile_prefix_chars) {
+                std::vector<std::pair<std::string, size_t>> option_names;
+                std::vector<std::string> keys;
+                std::unordered_map<std::string, size_t> key_slots;
+                specs_.reserve(arguments.size());
+                for (const auto& arg : arguments) {
+                    bool positional = arg->is_positional();
+                    size_t index = specs_.size();
+                    
+                    // 保存キーごとにスロットを割り当てる
+                    std::string key = storage_key(*arg);
+                    auto found = key_slots.find(key);
+                    size_t slot = keys.size();
+                    if (found == key_slots.end()) {
+                        key_slots[key] = slot;
+                        keys.push_back(key);
+                    } else {
+                        slot = found->second;
+                    }
+                    specs_.push_back(ArgumentSpec(arg, key, slot, positional));
+                    
+                    // 逐次受け渡しは残りの値を読み進める位置引数のみ
+                    int nargs = arg->definition().nargs;
+                    if (arg->definition().stream_sink && !(positional && (nargs == -3 || nargs == -4 || nargs == -5))) {
+                        throw std::invalid_argument("stream() requires a positional argument with nargs "
+                                                    "\"*\", \"+\" or \"remainder\": " + key);
+                    }
+                    
+                    if (positional) {
+                        positionals_.push_back(index);
+                    } else {
+                        // オプション引数は全ての名前で登録
+                        for (const auto& name : arg->get_names()) {
+                            option_names.push_back(std::make_pair(name, index));
+                        }
+                    }
+                }
+                options_ = OptionTable(option_names);
+                std::shared_ptr<NamespaceSchema> schema = std::make_shared<NamespaceSchema>(keys);
+                for (const auto& spec : specs_) {
+                    schema->add_argument(spec.slot, spec.argument);
+                }
+                schema_ = schema;
+            }
+            
+            // 解析結果のNamespaceが使うスロット構成
+            const std::shared_ptr<const NamespaceSchema>& schema() const { return schema_; }
+            
+            // 遅延変換モード（値の変換と既定値の設定を参照時まで遅らせる）
+            bool lazy() const { return lazy_; }
+            
+            // 応答ファイルを示す接頭辞（空なら展開しない）
+            const std::string& fromfile_prefix_chars() const { return fromfile_prefix_chars_; }
+            
+            // specs() 内での引数の位置（NamespaceSchema::argument() の index と一致）
+            size_t index_of(const ArgumentSpec& spec) const { return static_cast<size_t>(&spec - specs_.data()); }
+            
+            // 全引数（定義順）
+            const std::vector<ArgumentSpec>& specs() const { return specs_; }
+            
+            // 位置引数の数
+            size_t positional_count() const { return positionals_.size(); }
+            
+            // n番目の位置引数
+            const ArgumentSpec& positional(size_t n) const { return specs_[positionals_[n]]; }
+            
+            // オプション名から引数を検索（見つからなければnullptr）
+            const ArgumentSpec* find_option(StringView name) const {
+                size_t index = options_.find(name);
+                if (index == OptionTable::npos) {
+                    return nullptr;
+                }
+                return &specs_[index];
+            }
+            
+            // オプション名から引数インデックスを検索（見つからなければOptionTable::npos）
+            size_t find_option_index(StringView name) const {
+                return options_.find(name);
+            }
+            
+            // 引数の保存キーを取得（位置引数は名前、オプション引数は長形式優先で先頭の '-' を除去）
+            static std::string storage_key(const Argument& arg) {
+                const auto& names = arg.get_names();
+                if (names.empty()) {
+                    return "unnamed";
+                }
+                
+                if (arg.is_positional()) {
+                    return names[0];
+                }
+                
+                // オプション引数の場合、長形式を優先
+                for (const auto& name : names) {
+                    if (name.length() > 2 && name.compare(0, 2, "--") == 0) {
+                        return name.substr(2);  // "--" を除去
+                    }
+                }
+                
+                // 長形式がない場合は短形式を使用
+                const std::string& short_name = names[0];
+                if (short_name.length() >= 2 && short_name[0] == '-') {
+                    return short_name.substr(1);  // "-" を除去
+                }
+                
+                return names[0];
+            }
+        };
+        
+        // ParseFailure: 例外を使わずに解析失敗を記録する
+        // メッセージはmessage()を呼ぶまで組み立てず、組み立てに必要な断片だけを保持する
+        struct ParseFailure {
+            // 例外APIで送出する例外の種類（従来のparse_argsと同じ型を保つ）
+            enum Raise {
+                RAISE_HELP,
+                RAISE_ARGUMENT_ERROR,
+                RAISE_INVALID_ARGUMENT,
+                RAISE_RUNTIME_ERROR
+            };
+            
+            enum : size_t { npos = static_cast<size_t>(-1) };
+            
+            ParseStatus status;
+            Raise raise;
+            size_t argument_index;                    // 失敗した引数の位置（argv[0]を除く0始まり、該当なしはnpos）
+            std::shared_ptr<Argument> argument;       // 失敗に関係する引数定義
+            std::string token;                        // 入力されたオプション名、または位置引数の保存キー
+            std::string text;                         // 元の値や下位のエラーメッセージ
+            std::vector<std::string> names;           // 不足している必須引数
+            AnyValue value;                           // 検証で拒否された変換済みの値
+            int expected;                             // 必要な値の数（nargs）
+            NumberError number_error;                 // 組み込み型の変換の失敗理由
+            std::string (*format)(const ParseFailure&);
+            
+            ParseFailure()
+                : status(ParseStatus::SUCCESS), raise(RAISE_RUNTIME_ERROR), argument_index(npos)
+                , expected(0), number_error(NumberError::NONE), format(nullptr) {}
+            
+            // エラーメッセージを組み立てる（例外APIのwhat()と同じ文字列）
+            std::string message() const {
+                return format ? format(*this) : std::string();
+            }
+            
+            // 例外APIとして従来と同じ例外を送出
+            [[noreturn]] void raise_exception() const {
+                switch (raise) {
+                    case RAISE_HELP:
+                        throw help_requested(message());
+                    case RAISE_ARGUMENT_ERROR:
+                        throw ArgumentError(message());
+                    case RAISE_INVALID_ARGUMENT:
+                        throw std::invalid_argument(message());
+                    case RAISE_RUNTIME_ERROR:
+                        break;
+                }
+                throw std::runtime_error(message());
+            }
+        };
+        
+        // bind() されたメンバへの書き込みの失敗メッセージ
+        inline std::string format_binding_failure(const ParseFailure& failure) {
+            return "argument " + failure.argument->get_name() + ": " + failure.text;
+        }
+        
+        // bind() されたメンバへ解析結果を書き込む（Namespace から取り出したスロットは空にする）
+        // 同じスロットを複数の引数が共有する場合は値を複写する。
+        // 型が合わなければ failure に BINDING_FAILED を記録して false を返す（それまでのメンバは書き込み済み）
+        template<typename Owner>
+        bool store_bound_values(const ParsePlan& plan, Namespace& values, Owner& target, ParseFailure& failure) {
+            const NamespaceSchema& schema = *plan.schema();
+            for (const auto& spec : plan.specs()) {
+                const std::shared_ptr<const FieldBinding>& binding = spec.definition().binding;
+                if (!binding || !values.has_slot(spec.slot)) {
+                    continue;
+                }
+                const char* error = nullptr;
+                bool movable = schema.slot_argument_count(spec.slot) == 1;
+                if (binding->owner() != typeid(Owner)) {
+                    error = "bound to a member of another struct type";
+                } else if (!binding->assign(&target, values.raw_slot_for_write(spec.slot), movable)) {
+                    error = "parsed value does not match the type of the bound member";
+                }
+                if (error) {
+                    failure.status = ParseStatus::BINDING_FAILED;
+                    failure.raise = ParseFailure::RAISE_INVALID_ARGUMENT;
+                    failure.argument_index = ParseFailure::npos;
+                    failure.argument = spec.argument;
+                    failure.token = spec.key;
+                    failure.text = error;
+                    failure.format = &format_binding_failure;
+                    return false;
+                }
+                if (movable) {
+                    values.reset_slot(spec.slot);
+                }
+            }
+            return true;
+        }
+        
+        // 例外API用（失敗時は std::invalid_argument）
+        template<typename Owner>
+        void store_bound_values(const ParsePlan& plan, Namespace& values, Owner& target) {
+            ParseFailure failure;
+            if (!store_bound_values(plan, values, target, failure)) {
+                failure.raise_exception();
+            }
+        }
+        
         // Parser: コマンドライン引数の解析ロジック
+        // 入力の誤りやヘルプ要求は例外ではなくParseFailureに記録して返す
         class Parser {
         private:
-            Tokenizer tokenizer_;
-            std::vector<std::shared_ptr<Argument>> positional_args_;
-            std::map<std::string, std::shared_ptr<Argument>> option_args_;
-            
+            TokenCursor cursor_;
+            std::shared_ptr<const ParsePlan> plan_;
+            ParseFailure* failure_;  // 解析中のみ有効
+            TextBuffer texts_;       // 収集中の値（解析をまたいで容量を再利用する）
+            std::string token_text_;     // ハンドラが保持するトークンの複写（一時領域を指す場合のみ）
+            std::string stream_text_;    // stream() で変換中の値
+            AnyValue stream_value_;
+        
         public:
             // Constructor
-            Parser() = default;
+            Parser() : failure_(nullptr) {}
+            
+            // 構築済みの解析計画を再利用するコンストラクタ
+            explicit Parser(const std::shared_ptr<const ParsePlan>& plan) : plan_(plan), failure_(nullptr) {}
             
             // メイン解析メソッド
             Namespace parse(int argc, char* argv[], const std::vector<std::shared_ptr<Argument>>& arguments) {
-                std::vector<std::string> args;
-                for (int i = 1; i < argc; ++i) {  // Skip program name
-                    args.push_back(std::string(argv[i]));
+                plan_ = std::make_shared<ParsePlan>(arguments);
+                return parse(argc, argv);
+            }
+            
+            // string配列版の解析メソッド（引数定義から解析計画を構築して解析）
+            Namespace parse(const std::vector<std::string>& args,
+                          const std::vector<std::shared_ptr<Argument>>& arguments) {
+                plan_ = std::make_shared<ParsePlan>(arguments);
+                return parse(args);
+            }
+            
+            // 保持している解析計画で解析（argvはコピーせずにトークン化する）
+            Namespace parse(int argc, char* argv[]) {
+                Namespace result;
+                ParseFailure failure;
+                if (!try_parse(argc, argv, result, failure)) {
+                    failure.raise_exception();
+                }
+                return result;
+            }
+            
+            // 保持している解析計画で解析
+            Namespace parse(const std::vector<std::string>& args) {
+                Namespace result;
+                ParseFailure failure;
+                if (!try_parse(args, result, failure)) {
+                    failure.raise_exception();
+                }
+                return result;
+            }
+            
+            // 例外を送出せずに解析（失敗時はfalseを返し、理由をfailureに記録する）
+            bool try_parse(int argc, char* argv[], Namespace& result, ParseFailure& failure) {
+                _require_plan();
+                cursor_.reset(ArgumentSource(argc, argv), StringView(plan_->fromfile_prefix_chars()));
+                return _run(result, failure);
+            }
+            
+            bool try_parse(const std::vector<std::string>& args, Namespace& result, ParseFailure& failure) {
+                _require_plan();
+                cursor_.reset(ArgumentSource(args), StringView(plan_->fromfile_prefix_chars()));
+                return _run(result, failure);
+            }
+            
+            // 使用中の解析計画
+            const std::shared_ptr<const ParsePlan>& plan() const { return plan_; }
+            
+            // 解析計画を差し替える（トークン化・値の一時領域はそのまま再利用する）
+            void set_plan(const std::shared_ptr<const ParsePlan>& plan) { plan_ = plan; }
+        
+        private:
+            void _require_plan() const {
+                if (!plan_) {
+                    throw std::logic_error("Parser has no parse plan");
+                }
+            }
+            
+            bool _run(Namespace& result, ParseFailure& failure) {
+                failure_ = &failure;
+                bool ok = false;
+                try {
+                    ok = _parse_tokens(result);
+                } catch (const ResponseFileError& error) {
+                    // 応答ファイルの誤りは、そのファイルを指定した引数の位置で報告する
+                    _fail(ParseStatus::RESPONSE_FILE_ERROR, ParseFailure::RAISE_ARGUMENT_ERROR, nullptr, StringView(),
+                          &_format_text).text = error.what();
+                    failure.argument_index = cursor_.response_file_argument();
                 }
-                return parse(args, arguments);
+                // 値はすべてNamespaceに複写済みなので、解析が終われば応答ファイルは不要
+                cursor_.close_files();
+                failure_ = nullptr;
+                return ok;
             }
             
-            // string配列版の解析メソッド
-            Namespace parse(const std::vector<std::string>& args, 
-                          const std::vector<std::shared_ptr<Argument>>& arguments) {
-                
-                // 引数をタイプ別に分類
-                _classify_arguments(arguments);
-                
-                // トークン化
-                tokenizer_.tokenize(args);
-                
-                // 結果を保持するNamespace
-                Namespace result;
+            // トークン列を解析してresultに格納
+            bool _parse_tokens(Namespace& result) {
+                // 結果を保持するNamespace（解析計画のスロット構成を共有し、前回の解析の領域は再利用する）
+                result.recycle(plan_->schema());
                 
                 // 明示的なデフォルト値を設定（store_true/store_falseは除く）
-                _set_explicit_default_values(result, arguments);
+                _set_explicit_default_values(result);
                 
                 // 位置引数のインデックス
                 size_t positional_index = 0;
                 
-                // トークンを順次処理
-                while (tokenizer_.has_next()) {
-                    Token token = tokenizer_.next();
+                // トークンを順次処理（ハンドラが続く値を読み進めるため、トークンはコピーして保持する）
+                while (cursor_.has_next()) {
+                    Token token = cursor_.next();
+                    // ストリームとして読む応答ファイルの引数は数引数先で上書きされるため、ハンドラには複写を渡す
+                    if (cursor_.is_scratch(token.value)) {
+                        token_text_.assign(token.value.data(), token.value.size());
+                        token.value = StringView(token_text_);
+                    }
                     
                     switch (token.type) {
                         case Token::POSITIONAL:
-                            _handle_positional_argument(token, result, positional_index);
+                            if (!_handle_positional_argument(token, result, positional_index)) {
+                                return false;
+                            }
                             break;
-                            
+                        
                         case Token::SHORT_OPTION:
                         case Token::LONG_OPTION:
-                            _handle_option_argument(token, result);
+                            if (!_handle_option_argument(token, result)) {
+                                return false;
+                            }
                             break;
-                            
+                        
                         case Token::END_OPTIONS:
                             // "--" 以降はすべて位置引数として処理
-                            while (tokenizer_.has_next()) {
-                                Token pos_token = tokenizer_.next();
-                                if (pos_token.type == Token::POSITIONAL) {
-                                    _handle_positional_argument(pos_token, result, positional_index);
+                            while (cursor_.has_next()) {
+                                const Token& pos_token = cursor_.next();
+                                if (pos_token.type == Token::POSITIONAL &&
+                                    !_handle_positional_argument(pos_token, result, positional_index)) {
+                                    return false;
                                 }
                             }
                             break;
-                            
+                        
                         case Token::OPTION_VALUE:
                             // このケースは通常 _handle_option_argument で処理される
                             break;
@@ -1542,310 +5782,483 @@ namespace argparse {
                 }
                 
                 // 必須引数のチェック
-                _validate_required_arguments(result, arguments);
+                if (!_validate_required_arguments(result)) {
+                    return false;
+                }
                 
                 // boolean アクションのデフォルト値を設定（必須引数チェック後）
-                _set_boolean_action_defaults(result, arguments);
-                
-                return result;
-            }
-            
-        private:
-            // 引数を位置引数とオプション引数に分類
-            void _classify_arguments(const std::vector<std::shared_ptr<Argument>>& arguments) {
-                positional_args_.clear();
-                option_args_.clear();
+                _set_boolean_action_defaults(result);
                 
-                for (const auto& arg : arguments) {
-                    if (arg->is_positional()) {
-                        positional_args_.push_back(arg);
-                    } else {
-                        // オプション引数は全ての名前でマップに登録
-                        for (const auto& name : arg->get_names()) {
-                            option_args_[name] = arg;
-                        }
-                    }
-                }
+                return true;
             }
             
             // 明示的なデフォルト値を設定（boolean アクションは除く）
-            void _set_explicit_default_values(Namespace& result, 
-                                             const std::vector<std::shared_ptr<Argument>>& arguments) {
-                for (const auto& arg : arguments) {
-                    const auto& def = arg->definition();
-                    std::string key = _get_storage_key(arg);
+            // 遅延変換モードでは複写せず、参照時にスキーマから取り出す印だけを付ける
+            void _set_explicit_default_values(Namespace& result) {
+                for (const auto& spec : plan_->specs()) {
+                    const auto& def = spec.definition();
                     
                     if (!def.default_value.empty()) {
-                        result.set_raw(key, def.default_value);
+                        if (plan_->lazy()) {
+                            result.set_default_slot(spec.slot);
+                        } else {
+                            result.set_raw_slot(spec.slot, def.default_value);
+                        }
                     }
                 }
             }
             
             // boolean アクションのデフォルト値を設定
-            void _set_boolean_action_defaults(Namespace& result, 
-                                             const std::vector<std::shared_ptr<Argument>>& arguments) {
-                for (const auto& arg : arguments) {
-                    const auto& def = arg->definition();
-                    std::string key = _get_storage_key(arg);
+            void _set_boolean_action_defaults(Namespace& result) {
+                for (const auto& spec : plan_->specs()) {
+                    const auto& def = spec.definition();
                     
                     // 既に値が設定されている場合はスキップ
-                    if (result.has(key)) {
+                    if (result.has_slot(spec.slot)) {
                         continue;
                     }
                     
-                    if (def.action == "store_true") {
+                    if (def.action_kind == ActionKind::STORE_TRUE) {
                         // store_trueアクションの場合、明示的なデフォルト値がなければfalseを設定
-                        result.set(key, false);
-                    } else if (def.action == "store_false") {
+                        result.set_slot(spec.slot, false);
+                    } else if (def.action_kind == ActionKind::STORE_FALSE) {
                         // store_falseアクションの場合、明示的なデフォルト値がなければtrueを設定
-                        result.set(key, true);
+                        result.set_slot(spec.slot, true);
                     }
                 }
             }
             
             // 位置引数の処理（nargs対応）
-            void _handle_positional_argument(const Token& token, Namespace& result, 
+            bool _handle_positional_argument(const Token& token, Namespace& result,
                                            size_t& positional_index) {
-                if (positional_index >= positional_args_.size()) {
-                    throw ArgumentError("unrecognized arguments: " + token.value);
+                if (positional_index >= plan_->positional_count()) {
+                    _fail(ParseStatus::UNRECOGNIZED_ARGUMENTS, ParseFailure::RAISE_ARGUMENT_ERROR, nullptr,
+                          token.value, &_format_unrecognized);
+                    return false;
                 }
                 
-                auto arg = positional_args_[positional_index];
-                const auto& def = arg->definition();
-                std::string key = _get_storage_key(arg);
+                const ArgumentSpec& spec = plan_->positional(positional_index);
+                const auto& def = spec.definition();
                 
-                try {
-                    std::vector<std::string> values;
-                    values.push_back(token.value);  // 現在のトークンを追加
-                    
-                    // nargs処理による追加値の収集
-                    if (def.nargs == -5) {  // remainder - 残り全て
-                        while (tokenizer_.has_next()) {
-                            values.push_back(tokenizer_.next().value);
-                        }
-                    } else if (def.nargs == -3) {  // "*" - zero or more (すでに1つあるので、残りを収集)
-                        while (tokenizer_.has_next()) {
-                            Token next = tokenizer_.peek();
-                            if (next.type == Token::POSITIONAL) {
-                                values.push_back(tokenizer_.next().value);
-                            } else {
-                                break;
-                            }
-                        }
-                    } else if (def.nargs == -4) {  // "+" - one or more (すでに1つあるので、残りを収集)
-                        while (tokenizer_.has_next()) {
-                            Token next = tokenizer_.peek();
-                            if (next.type == Token::POSITIONAL) {
-                                values.push_back(tokenizer_.next().value);
-                            } else {
-                                break;
-                            }
+                if (def.stream_sink) {
+                    return _stream_positional(token, spec, result, positional_index);
+                }
+                
+                TextBuffer& values = texts_;
+                values.clear();
+                values.push_back(token.value);  // 現在のトークンを追加
+                
+                // nargs処理による追加値の収集
+                if (def.nargs == -5) {  // remainder - 残り全て
+                    while (cursor_.has_next()) {
+                        values.push_back(cursor_.next().value);
+                    }
+                } else if (def.nargs == -3 || def.nargs == -4) {  // "*" / "+" (すでに1つあるので、残りを収集)
+                    while (cursor_.has_next()) {
+                        const Token& next = cursor_.peek();
+                        if (next.type == Token::POSITIONAL) {
+                            values.push_back(cursor_.next().value);
+                        } else {
+                            break;
                         }
-                    } else if (def.nargs > 1) {  // 固定数（2以上）
-                        for (int i = 1; i < def.nargs; ++i) {
-                            if (!tokenizer_.has_next()) {
-                                throw std::runtime_error("Positional argument '" + key + "' requires " + std::to_string(def.nargs) + " values");
-                            }
-                            Token next = tokenizer_.next();
-                            if (next.type != Token::POSITIONAL) {
-                                throw std::runtime_error("Positional argument '" + key + "' requires " + std::to_string(def.nargs) + " values");
-                            }
-                            values.push_back(next.value);
+                    }
+                } else if (def.nargs > 1) {  // 固定数（2以上）
+                    for (int i = 1; i < def.nargs; ++i) {
+                        if (!cursor_.has_next() || cursor_.next().type != Token::POSITIONAL) {
+                            _fail(ParseStatus::MISSING_VALUE, ParseFailure::RAISE_INVALID_ARGUMENT, &spec,
+                                  StringView(spec.key), &_format_positional_missing_values).expected = def.nargs;
+                            return false;
                         }
+                        values.push_back(cursor_.current().value);
+                    }
+                }
+                
+                // 値の変換と格納
+                if (values.size() == 1 && def.nargs != -3 && def.nargs != -4 && def.nargs != -5 && def.nargs <= 1) {
+                    // 単一値
+                    if (plan_->lazy()) {
+                        // 遅延変換モード：文字列のまま保持し、参照時に変換する
+                        result.set_pending_slot(spec.slot, plan_->index_of(spec), values[0]);
+                        ++positional_index;
+                        return true;
+                    }
+                    if (!_convert_value(StringView(spec.key), spec, values[0], result.recycled_slot(spec.slot))) {
+                        return false;
+                    }
+                } else if (!_store_values(StringView(spec.key), spec, values, result)) {
+                    return false;
+                }
+                
+                ++positional_index;
+                return true;
+            }
+            
+            // 逐次受け渡しの位置引数（stream()）：読み進めるたびに変換して受け取り側に渡し、個数だけを格納する
+            bool _stream_positional(const Token& token, const ArgumentSpec& spec, Namespace& result,
+                                    size_t& positional_index) {
+                const bool remainder = spec.definition().nargs == -5;
+                size_t count = 0;
+                StringView text = token.value;
+                for (;;) {
+                    if (!_stream_value(spec, text)) {
+                        return false;
+                    }
+                    ++count;
+                    if (!cursor_.has_next() || (!remainder && cursor_.peek().type != Token::POSITIONAL)) {
+                        break;
                     }
+                    text = cursor_.next().value;
+                }
+                
+                result.set_slot(spec.slot, count);
+                ++positional_index;
+                return true;
+            }
+            
+            // 1つの値を変換・検証して受け取り側に渡す（変換先と文字列の領域は使い回す）
+            bool _stream_value(const ArgumentSpec& spec, StringView text) {
+                stream_text_.assign(text.data(), text.size());
+                if (!_convert_value(StringView(spec.key), spec, stream_text_, stream_value_)) {
+                    return false;
+                }
+                try {
+                    spec.definition().stream_sink(stream_value_);
+                } catch (const std::exception& e) {
+                    _fail(ParseStatus::ACTION_FAILED, ParseFailure::RAISE_INVALID_ARGUMENT, &spec, StringView(spec.key),
+                          &_format_positional_error).text = e.what();
+                    return false;
+                }
+                return true;
+            }
+            
+            // オプション引数の処理
+            bool _handle_option_argument(const Token& token, Namespace& result) {
+                const ArgumentSpec* spec = plan_->find_option(token.value);
+                if (!spec) {
+                    _fail(ParseStatus::UNRECOGNIZED_ARGUMENTS, ParseFailure::RAISE_ARGUMENT_ERROR, nullptr,
+                          token.value, &_format_unrecognized);
+                    return false;
+                }
+                
+                const auto& def = spec->definition();
+                const size_t slot = spec->slot;
+                
+                // actionに基づく処理（定義時に解決済みのActionKindで分岐）
+                switch (def.action_kind) {
+                    case ActionKind::HELP:
+                        // ヘルプ要求も失敗と同じ経路で呼び出し元に返す
+                        _fail(ParseStatus::HELP_REQUESTED, ParseFailure::RAISE_HELP, spec, token.value,
+                              &_format_help_requested);
+                        return false;
+                    
+                    case ActionKind::STORE_TRUE:
+                        result.set_slot(slot, true);
+                        return true;
+                    
+                    case ActionKind::STORE_FALSE:
+                        result.set_slot(slot, false);
+                        return true;
                     
-                    // 値の変換と格納
-                    if (values.size() == 1 && def.nargs != -3 && def.nargs != -4 && def.nargs != -5 && def.nargs <= 1) {
-                        // 単一値
-                        AnyValue value = arg->convert_value(values[0]);
-                        if (!arg->validate_value(value)) {
-                            std::string error_msg = "argument " + key + ": " + arg->get_validation_error_message(value);
-                            throw std::invalid_argument(error_msg);
+                    case ActionKind::COUNT: {
+                        // カウント数を増加
+                        int current_count = 0;
+                        if (result.has_slot(slot)) {
+                            current_count = result.get_slot<int>(slot);
                         }
-                        result.set_raw(key, value);
-                    } else {
-                        // 複数値、文字列リストとして格納
-                        result.set(key, values);
+                        result.set_slot(slot, current_count + 1);
+                        return true;
                     }
                     
-                    ++positional_index;
+                    case ActionKind::APPEND:
+                        return _handle_append_action(token, *spec, result);
+                    
+                    case ActionKind::EXTEND:
+                        return _handle_extend_action(token, *spec, result);
+                    
+                    case ActionKind::CUSTOM:
+                        return _handle_custom_action(token, *spec, result);
+                    
+                    case ActionKind::STORE:
+                        return _handle_store_action(token, *spec, result);
+                    
+                    case ActionKind::UNKNOWN:
+                        break;
+                }
+                
+                _fail(ParseStatus::UNSUPPORTED_ACTION, ParseFailure::RAISE_RUNTIME_ERROR, spec, token.value,
+                      &_format_unsupported_action).text = def.action;
+                return false;
+            }
+            
+            // appendアクション: リストに値を追加
+            bool _handle_append_action(const Token& token, const ArgumentSpec& spec, Namespace& result) {
+                if (!cursor_.has_next() || !_is_value(cursor_.peek())) {
+                    _fail(ParseStatus::MISSING_VALUE, ParseFailure::RAISE_RUNTIME_ERROR, &spec, token.value,
+                          &_format_missing_value);
+                    return false;
+                }
+                
+                const Token& value_token = cursor_.next();
+                return _append_converted(token, spec, value_token.value, result);
+            }
+            
+            // extendアクション: nargsで収集した値をすべてリストに追加
+            bool _handle_extend_action(const Token& token, const ArgumentSpec& spec, Namespace& result) {
+                const auto& def = spec.definition();
+                
+                TextBuffer& values = texts_;
+                if (!_collect_values(def, token, spec, values)) {
+                    return false;
+                }
+                if (values.empty() && def.nargs != -2 && def.nargs != -3) {
+                    _fail(ParseStatus::MISSING_VALUE, ParseFailure::RAISE_RUNTIME_ERROR, &spec, token.value,
+                          &_format_option_missing_values).expected = 0;
+                    return false;
+                }
+                
+                // 値なしの "*" / "?" は何も追加しない（デフォルト値が使われる）
+                for (const auto& value : values) {
+                    if (!_append_converted(token, spec, value, result)) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+            
+            // 値を変換・検証し、スロットのstd::vector<T>へその場で追加（リスト全体のコピーは行わない）
+            bool _append_converted(const Token& token, const ArgumentSpec& spec, const std::string& text,
+                                   Namespace& result) {
+                AnyValue value;
+                if (!_convert_value(token.value, spec, text, value)) {
+                    return false;
+                }
+                
+                const auto& def = spec.definition();
+                ValueAppender appender = def.appender ? def.appender : &append_any_value;
+                try {
+                    appender(result.raw_slot_for_write(spec.slot), std::move(value));
                 } catch (const std::exception& e) {
-                    throw std::invalid_argument("Error parsing positional argument '" + key + "': " + e.what());
+                    // 既存の値とリストの要素型が合わない場合
+                    _fail(ParseStatus::INVALID_VALUE, ParseFailure::RAISE_RUNTIME_ERROR, &spec, token.value,
+                          &_format_option_error).text = e.what();
+                    return false;
                 }
+                return true;
             }
             
-            // オプション引数の処理
-            void _handle_option_argument(const Token& token, Namespace& result) {
-                auto it = option_args_.find(token.value);
-                if (it == option_args_.end()) {
-                    throw ArgumentError("unrecognized arguments: " + token.value);
+            // カスタムアクション処理
+            bool _handle_custom_action(const Token& token, const ArgumentSpec& spec, Namespace& result) {
+                const auto& def = spec.definition();
+                const size_t slot = spec.slot;
+                
+                if (!def.custom_action) {
+                    _fail(ParseStatus::UNSUPPORTED_ACTION, ParseFailure::RAISE_RUNTIME_ERROR, &spec, token.value,
+                          &_format_missing_custom_action);
+                    return false;
                 }
                 
-                auto arg = it->second;
-                const auto& def = arg->definition();
-                std::string key = _get_storage_key(arg);
-                
-                // actionに基づく処理
-                if (def.action == "help") {
-                    // ヘルプが要求された場合は例外を投げる
-                    throw help_requested("Help requested");
-                } else if (def.action == "store_true") {
-                    result.set(key, true);
-                } else if (def.action == "store_false") {
-                    result.set(key, false);
-                } else if (def.action == "count") {
-                    // カウント数を増加
-                    int current_count = 0;
-                    if (result.has(key)) {
-                        current_count = result.get<int>(key);
-                    }
-                    result.set(key, current_count + 1);
-                } else if (def.action == "append") {
-                    // リストに値を追加
-                    if (!tokenizer_.has_next()) {
-                        throw std::runtime_error("Argument " + token.value + " requires a value");
+                // 値が必要かどうかはnargによる（この場合は簡単のため値を取る）
+                std::string value_str = "";
+                if (cursor_.has_next() && _is_value(cursor_.peek())) {
+                    value_str = cursor_.next().value;
+                }
+                
+                try {
+                    AnyValue current_value;
+                    if (result.has_slot(slot)) {
+                        current_value = result.get_raw_slot(slot);
                     }
                     
-                    Token value_token = tokenizer_.next();
-                    if (value_token.type != Token::OPTION_VALUE && value_token.type != Token::POSITIONAL) {
-                        throw std::runtime_error("Argument " + token.value + " requires a value");
+                    AnyValue new_value = def.custom_action(current_value, value_str);
+                    result.set_raw_slot(slot, std::move(new_value));
+                } catch (const std::exception& e) {
+                    // ユーザー定義のハンドラが送出した例外は失敗として記録する
+                    _fail(ParseStatus::ACTION_FAILED, ParseFailure::RAISE_INVALID_ARGUMENT, &spec, token.value,
+                          &_format_custom_action_error).text = e.what();
+                    return false;
+                }
+                return true;
+            }
+            
+            // storeアクション: nargs処理による値の収集と格納
+            bool _handle_store_action(const Token& token, const ArgumentSpec& spec, Namespace& result) {
+                const auto& def = spec.definition();
+                const size_t slot = spec.slot;
+                
+                TextBuffer& values = texts_;
+                if (!_collect_values(def, token, spec, values)) {
+                    return false;
+                }
+                
+                if (values.empty()) {
+                    // nargs="?" で値が無い場合、デフォルト値を使用
+                    if (def.nargs == -2 && !def.default_value.empty()) {
+                        result.set_raw_slot(slot, def.default_value);
+                    } else if (def.nargs == -2) {
+                        // デフォルト値もない場合はNone的な扱い（設定しない）
+                    } else if (def.nargs == -3) {
+                        // nargs="*" の場合、空のリストを設定
+                        return _store_values(token.value, spec, values, result);
+                    } else {
+                        _fail(ParseStatus::MISSING_VALUE, ParseFailure::RAISE_RUNTIME_ERROR, &spec, token.value,
+                              &_format_option_missing_values).expected = 0;
+                        return false;
                     }
-                    
-                    try {
-                        AnyValue value = arg->convert_value(value_token.value);
-                        if (!arg->validate_value(value)) {
-                            std::string error_msg = "argument " + token.value + ": " + arg->get_validation_error_message(value);
-                            throw std::invalid_argument(error_msg);
-                        }
-                        
-                        // 既存のリストに追加、またはリストを作成
-                        if (result.has(key)) {
-                            const auto& current_list = result.get_raw(key);
-                            // ListハンドラーでリストAPI処理が必要だが、簡単のため文字列ベクターで実装
-                            if (current_list.type() == typeid(std::vector<std::string>)) {
-                                auto list = current_list.get<std::vector<std::string>>();
-                                list.push_back(value.get<std::string>());
-                                result.set(key, list);
-                            } else {
-                                // 初回、単一値を含むリストに変換
-                                std::vector<std::string> new_list;
-                                new_list.push_back(current_list.get<std::string>());
-                                new_list.push_back(value.get<std::string>());
-                                result.set(key, new_list);
-                            }
-                        } else {
-                            // 初回はリストとして作成
-                            std::vector<std::string> new_list;
-                            new_list.push_back(value.get<std::string>());
-                            result.set(key, new_list);
-                        }
-                    } catch (const std::invalid_argument& e) {
-                        throw;  // Re-throw invalid_argument as-is for type conversion errors
-                    } catch (const std::exception& e) {
-                        throw std::runtime_error("Error parsing argument " + token.value + ": " + e.what());
+                } else if (values.size() == 1 && def.nargs != -3 && def.nargs != -4 && def.nargs <= 1) {
+                    // 単一値の場合（遅延変換モードでは文字列のまま保持し、参照時に変換する）
+                    if (plan_->lazy()) {
+                        result.set_pending_slot(slot, plan_->index_of(spec), values[0]);
+                        return true;
                     }
-                } else if (def.action == "custom") {
-                    // カスタムアクション処理
-                    if (!def.custom_action) {
-                        throw std::runtime_error("Custom action specified but no handler provided for " + token.value);
+                    if (!_convert_value(token.value, spec, values[0], result.recycled_slot(slot))) {
+                        return false;
                     }
-                    
-                    // 値が必要かどうかはnargによる（この場合は簡単のため値を取る）
-                    std::string value_str = "";
-                    if (tokenizer_.has_next()) {
-                        Token value_token = tokenizer_.peek();
-                        if (value_token.type == Token::OPTION_VALUE || value_token.type == Token::POSITIONAL) {
-                            value_token = tokenizer_.next();
-                            value_str = value_token.value;
-                        }
+                } else {
+                    return _store_values(token.value, spec, values, result);
+                }
+                return true;
+            }
+            
+            // 複数値をまとめて変換し、std::vector<T> としてスロットに格納する
+            // 組み込み型で選択肢・検証関数がなければ一括変換、それ以外は要素ごとに変換・検証して蓄積する
+            bool _store_values(StringView name, const ArgumentSpec& spec, const TextBuffer& values,
+                               Namespace& result) {
+                const auto& def = spec.definition();
+                if (def.list_converter && def.choices.empty() && !def.validator) {
+                    // スロットに残っている前回のリストの領域へ直接書き込む
+                    size_t failed = 0;
+                    if (def.list_converter(values.data(), values.size(), result.recycled_slot(spec.slot), failed)) {
+                        return true;
                     }
-                    
-                    try {
-                        AnyValue current_value;
-                        if (result.has(key)) {
-                            current_value = result.get_raw(key);
-                        }
-                        
-                        AnyValue new_value = def.custom_action(current_value, value_str);
-                        result.set_raw(key, new_value);
-                    } catch (const std::exception& e) {
-                        throw std::invalid_argument("Error in custom action for " + token.value + ": " + e.what());
+                    // 失敗した要素を通常の変換にかけてエラーを記録する
+                    AnyValue ignored;
+                    if (!_convert_value(name, spec, values[failed], ignored)) {
+                        return false;
+                    }
+                }
+                
+                AnyValue list;
+                ValueAppender appender = def.appender ? def.appender : &append_any_value;
+                if (values.empty()) {
+                    // 値の個数によらず、空のリストも要素型で格納する
+                    appender(list, AnyValue());
+                    result.set_raw_slot(spec.slot, std::move(list));
+                    return true;
+                }
+                for (const auto& text : values) {
+                    AnyValue value;
+                    if (!_convert_value(name, spec, text, value)) {
+                        return false;
                     }
-                } else if (def.action == "store" || def.action.empty()) {
-                    // nargs処理による値の収集
                     try {
-                        std::vector<std::string> values = _collect_values(def, token);
-                        
-                        if (values.empty()) {
-                            // nargs="?" で値が無い場合、デフォルト値を使用
-                            if (def.nargs == -2 && !def.default_value.empty()) {
-                                result.set_raw(key, def.default_value);
-                            } else if (def.nargs == -2) {
-                                // デフォルト値もない場合はNone的な扱い（設定しない）
-                            } else if (def.nargs == -3) {
-                                // nargs="*" の場合、空のリストを設定
-                                result.set(key, std::vector<std::string>());
-                            } else {
-                                throw std::runtime_error("Argument " + token.value + " requires a value");
-                            }
-                        } else if (values.size() == 1 && def.nargs != -3 && def.nargs != -4 && def.nargs <= 1) {
-                            // 単一値の場合
-                            AnyValue value = arg->convert_value(values[0]);
-                            if (!arg->validate_value(value)) {
-                                std::string error_msg = "argument " + token.value + ": " + arg->get_validation_error_message(value);
-                                throw std::invalid_argument(error_msg);
-                            }
-                            result.set_raw(key, value);
-                        } else {
-                            // 複数値の場合、元の文字列のリストとして格納
-                            result.set(key, values);
-                        }
-                    } catch (const std::invalid_argument& e) {
-                        throw;  // Re-throw invalid_argument as-is for type conversion errors
+                        appender(list, std::move(value));
                     } catch (const std::exception& e) {
-                        throw std::runtime_error("Error parsing argument " + token.value + ": " + e.what());
+                        // 変換結果の型が要素型と合わない場合
+                        _fail(ParseStatus::INVALID_VALUE, ParseFailure::RAISE_RUNTIME_ERROR, &spec, name,
+                              &_format_option_error).text = e.what();
+                        return false;
                     }
-                } else {
-                    throw std::runtime_error("Unsupported action: " + def.action);
                 }
+                result.set_raw_slot(spec.slot, std::move(list));
+                return true;
+            }
+            
+            // 値の変換と検証（組み込み型は例外を使わず、その他の変換器が送出する例外はここで捕捉して失敗として記録する）
+            // name はエラーメッセージに使う名前（オプションは入力された形、位置引数は保存キー）
+            // value が既に std::string を保持していれば、文字列のままの値はその容量を再利用して代入する
+            bool _convert_value(StringView name, const ArgumentSpec& spec, const std::string& text, AnyValue& value) {
+                const auto& arg = spec.argument;
+                if (TryConverter try_converter = arg->definition().try_converter) {
+                    // 組み込み型は例外を使わずに変換し、メッセージは NumberError から後で組み立てる
+                    NumberError error = try_converter(text, value);
+                    if (error != NumberError::NONE) {
+                        ParseFailure& failure = _fail(ParseStatus::INVALID_VALUE, ParseFailure::RAISE_INVALID_ARGUMENT,
+                            &spec, name, spec.positional ? &_format_positional_conversion_error : &_format_conversion_error);
+                        failure.text = text;
+                        failure.number_error = error;
+                        return false;
+                    }
+                    return _check_value(name, spec, value);
+                }
+                
+                const Converter& converter = arg->definition().converter;
+                std::string* existing =
+                    (!converter || converter.invoker() == TypeConverter::string_converter().invoker())
+                    ? value.try_get<std::string>() : nullptr;
+                try {
+                    if (existing) {
+                        existing->assign(text);
+                    } else {
+                        value = arg->convert_value(text);
+                    }
+                } catch (const std::invalid_argument& e) {
+                    _fail(ParseStatus::INVALID_VALUE, ParseFailure::RAISE_INVALID_ARGUMENT, &spec, name,
+                          spec.positional ? &_format_positional_error : &_format_text).text = e.what();
+                    return false;
+                } catch (const std::exception& e) {
+                    if (spec.positional) {
+                        _fail(ParseStatus::INVALID_VALUE, ParseFailure::RAISE_INVALID_ARGUMENT, &spec, name,
+                              &_format_positional_error).text = e.what();
+                    } else {
+                        _fail(ParseStatus::INVALID_VALUE, ParseFailure::RAISE_RUNTIME_ERROR, &spec, name,
+                              &_format_option_error).text = e.what();
+                    }
+                    return false;
+                }
+                return _check_value(name, spec, value);
+            }
+            
+            // 変換済みの値を選択肢・検証関数で確認する
+            bool _check_value(StringView name, const ArgumentSpec& spec, AnyValue& value) {
+                const auto& arg = spec.argument;
+                if (!arg->validate_value(value)) {
+                    ParseStatus status = arg->is_choice(value)
+                        ? ParseStatus::INVALID_VALUE : ParseStatus::INVALID_CHOICE;
+                    _fail(status, ParseFailure::RAISE_INVALID_ARGUMENT, &spec, name,
+                          spec.positional ? &_format_invalid_positional : &_format_invalid_option).value = std::move(value);
+                    return false;
+                }
+                return true;
             }
             
             // 必須引数のチェック
-            void _validate_required_arguments(const Namespace& result, 
-                                            const std::vector<std::shared_ptr<Argument>>& arguments) {
+            bool _validate_required_arguments(const Namespace& result) {
                 std::vector<std::string> missing_required;
                 std::vector<std::string> missing_positional;
                 
-                for (const auto& arg : arguments) {
-                    const auto& def = arg->definition();
-                    std::string key = _get_storage_key(arg);
+                for (const auto& spec : plan_->specs()) {
+                    const auto& def = spec.definition();
                     
                     // オプション引数でrequiredフラグがtrueの場合
-                    if (def.required && !result.has(key)) {
-                        missing_required.push_back(arg->get_name());
+                    if (def.required && !result.has_slot(spec.slot)) {
+                        missing_required.push_back(spec.argument->get_name());
                     }
                     
                     // 位置引数は常に必須（nargs="?" "*"の場合を除く）
-                    if (arg->is_positional() && def.nargs != -2 && def.nargs != -3) {
-                        if (!result.has(key)) {
-                            missing_positional.push_back(arg->get_name());
+                    if (spec.positional && def.nargs != -2 && def.nargs != -3) {
+                        if (!result.has_slot(spec.slot)) {
+                            missing_positional.push_back(spec.argument->get_name());
                         }
                     }
                 }
                 
                 // 必須引数のエラー報告
                 if (!missing_required.empty()) {
-                    throw ArgumentError(ErrorFormatter::format_multiple_required_error(missing_required));
+                    ParseFailure& failure = _fail(ParseStatus::MISSING_REQUIRED, ParseFailure::RAISE_ARGUMENT_ERROR,
+                                                  nullptr, StringView(), &_format_missing_required);
+                    failure.argument_index = ParseFailure::npos;
+                    failure.names = std::move(missing_required);
+                    return false;
                 }
                 
                 if (!missing_positional.empty()) {
-                    std::string message = "the following arguments are required: ";
-                    for (size_t i = 0; i < missing_positional.size(); ++i) {
-                        if (i > 0) message += ", ";
-                        message += missing_positional[i];
-                    }
-                    throw ArgumentError(message);
+                    ParseFailure& failure = _fail(ParseStatus::MISSING_REQUIRED, ParseFailure::RAISE_ARGUMENT_ERROR,
+                                                  nullptr, StringView(), &_format_missing_positional);
+                    failure.argument_index = ParseFailure::npos;
+                    failure.names = std::move(missing_positional);
+                    return false;
                 }
+                return true;
             }
             
             // nargs値を取得（固定数、特殊値の処理）
@@ -1859,112 +6272,196 @@ namespace argparse {
                 }
             }
             
+            // オプションの値として扱えるトークンか
+            static bool _is_value(const Token& token) {
+                return token.type == Token::OPTION_VALUE || token.type == Token::POSITIONAL;
+            }
+            
             // nargs仕様に基づいて値を収集
-            std::vector<std::string> _collect_values(const ArgumentDefinition& def, const Token& initial_token) {
-                std::vector<std::string> values;
-                
+            bool _collect_values(const ArgumentDefinition& def, const Token& token, const ArgumentSpec& spec,
+                                 TextBuffer& values) {
+                values.clear();
                 if (def.nargs == -2) {  // "?" - 0 or 1
-                    if (tokenizer_.has_next()) {
-                        Token next = tokenizer_.peek();
-                        if (next.type == Token::OPTION_VALUE || next.type == Token::POSITIONAL) {
-                            values.push_back(tokenizer_.next().value);
-                        }
+                    if (cursor_.has_next() && _is_value(cursor_.peek())) {
+                        values.push_back(cursor_.next().value);
                     }
-                } else if (def.nargs == -3) {  // "*" - 0 or more
-                    while (tokenizer_.has_next()) {
-                        Token next = tokenizer_.peek();
-                        if (next.type == Token::OPTION_VALUE || 
-                            (next.type == Token::POSITIONAL && next.value[0] != '-')) {
-                            values.push_back(tokenizer_.next().value);
-                        } else {
-                            break;
+                } else if (def.nargs == -3 || def.nargs == -4) {  // "*" - 0 or more / "+" - 1 or more
+                    if (def.nargs == -4) {
+                        // 最初の値を取得
+                        if (!cursor_.has_next() || !_is_value(cursor_.next())) {
+                            _fail(ParseStatus::MISSING_VALUE, ParseFailure::RAISE_RUNTIME_ERROR, &spec, token.value,
+                                  &_format_option_missing_values).expected = -4;
+                            return false;
                         }
+                        values.push_back(cursor_.current().value);
                     }
-                } else if (def.nargs == -4) {  // "+" - 1 or more
-                    if (!tokenizer_.has_next()) {
-                        throw std::runtime_error("Argument requires at least one value");
-                    }
-                    
-                    // 最初の値を取得
-                    Token first = tokenizer_.next();
-                    if (first.type != Token::OPTION_VALUE && first.type != Token::POSITIONAL) {
-                        throw std::runtime_error("Argument requires at least one value");
-                    }
-                    values.push_back(first.value);
                     
                     // 追加の値を収集
-                    while (tokenizer_.has_next()) {
-                        Token next = tokenizer_.peek();
-                        if (next.type == Token::OPTION_VALUE || 
+                    while (cursor_.has_next()) {
+                        const Token& next = cursor_.peek();
+                        if (next.type == Token::OPTION_VALUE ||
                             (next.type == Token::POSITIONAL && next.value[0] != '-')) {
-                            values.push_back(tokenizer_.next().value);
+                            values.push_back(cursor_.next().value);
                         } else {
                             break;
                         }
                     }
                 } else if (def.nargs == -5) {  // "remainder" - all remaining
                     // 残りの全てのトークンを収集
-                    while (tokenizer_.has_next()) {
-                        values.push_back(tokenizer_.next().value);
+                    while (cursor_.has_next()) {
+                        values.push_back(cursor_.next().value);
                     }
                 } else if (def.nargs > 0) {  // 固定数
                     for (int i = 0; i < def.nargs; ++i) {
-                        if (!tokenizer_.has_next()) {
-                            throw std::runtime_error("Argument requires " + std::to_string(def.nargs) + " values");
-                        }
-                        
-                        Token value_token = tokenizer_.next();
-                        if (value_token.type != Token::OPTION_VALUE && value_token.type != Token::POSITIONAL) {
-                            throw std::runtime_error("Argument requires " + std::to_string(def.nargs) + " values");
+                        if (!cursor_.has_next() || !_is_value(cursor_.next())) {
+                            _fail(ParseStatus::MISSING_VALUE, ParseFailure::RAISE_RUNTIME_ERROR, &spec, token.value,
+                                  &_format_option_missing_values).expected = def.nargs;
+                            return false;
                         }
-                        values.push_back(value_token.value);
+                        values.push_back(cursor_.current().value);
                     }
                 } else if (def.nargs == 0) {  // 値を取らない
                     // store_true, store_false, count等の処理
                 } else {  // デフォルト（1つの値）
-                    if (!tokenizer_.has_next()) {
-                        throw std::runtime_error("Argument requires a value");
-                    }
-                    
-                    Token value_token = tokenizer_.next();
-                    if (value_token.type != Token::OPTION_VALUE && value_token.type != Token::POSITIONAL) {
-                        throw std::runtime_error("Argument requires a value");
+                    if (!cursor_.has_next() || !_is_value(cursor_.next())) {
+                        _fail(ParseStatus::MISSING_VALUE, ParseFailure::RAISE_RUNTIME_ERROR, &spec, token.value,
+                              &_format_option_missing_values).expected = -1;
+                        return false;
                     }
-                    values.push_back(value_token.value);
+                    values.push_back(cursor_.current().value);
                 }
                 
-                return values;
+                return true;
             }
             
-            // 引数の保存キーを取得（位置引数は名前、オプション引数は主要名前）
-            std::string _get_storage_key(const std::shared_ptr<Argument>& arg) const {
-                const auto& names = arg->get_names();
-                if (names.empty()) {
-                    return "unnamed";
-                }
-                
-                if (arg->is_positional()) {
-                    return names[0];
-                }
-                
-                // オプション引数の場合、長形式を優先
-                for (const auto& name : names) {
-                    if (name.length() > 2 && name.substr(0, 2) == "--") {
-                        return name.substr(2);  // "--" を除去
-                    }
+            // 失敗を記録（メッセージは組み立てず、断片だけを保存する）
+            ParseFailure& _fail(ParseStatus status, ParseFailure::Raise raise, const ArgumentSpec* spec,
+                                StringView token, std::string (*format)(const ParseFailure&)) {
+                ParseFailure& failure = *failure_;
+                failure.status = status;
+                failure.raise = raise;
+                failure.argument_index = cursor_.argument_index();
+                failure.argument = spec ? spec->argument : std::shared_ptr<Argument>();
+                failure.token.assign(token.data(), token.size());
+                failure.format = format;
+                return failure;
+            }
+            
+            // 失敗メッセージの組み立て（ParseFailure::message() から必要になった時だけ呼ばれる）
+            static std::string _format_text(const ParseFailure& failure) {
+                return failure.text;
+            }
+            
+            static std::string _format_help_requested(const ParseFailure&) {
+                return "Help requested";
+            }
+            
+            static std::string _format_unrecognized(const ParseFailure& failure) {
+                return "unrecognized arguments: " + failure.token;
+            }
+            
+            static std::string _format_unsupported_action(const ParseFailure& failure) {
+                return "Unsupported action: " + failure.text;
+            }
+            
+            static std::string _format_missing_custom_action(const ParseFailure& failure) {
+                return "Custom action specified but no handler provided for " + failure.token;
+            }
+            
+            static std::string _format_custom_action_error(const ParseFailure& failure) {
+                return "Error in custom action for " + failure.token + ": " + failure.text;
+            }
+            
+            static std::string _format_missing_value(const ParseFailure& failure) {
+                return "Argument " + failure.token + " requires a value";
+            }
+            
+            static std::string _format_option_missing_values(const ParseFailure& failure) {
+                std::string reason;
+                if (failure.expected == 0) {
+                    reason = _format_missing_value(failure);
+                } else if (failure.expected == -1) {
+                    reason = "Argument requires a value";
+                } else if (failure.expected == -4) {
+                    reason = "Argument requires at least one value";
+                } else {
+                    reason = "Argument requires " + std::to_string(failure.expected) + " values";
                 }
-                
-                // 長形式がない場合は短形式を使用
-                std::string short_name = names[0];
-                if (short_name.length() >= 2 && short_name[0] == '-') {
-                    return short_name.substr(1);  // "-" を除去
+                return "Error parsing argument " + failure.token + ": " + reason;
+            }
+            
+            static std::string _format_positional_missing_values(const ParseFailure& failure) {
+                return "Error parsing positional argument '" + failure.token + "': Positional argument '" +
+                       failure.token + "' requires " + std::to_string(failure.expected) + " values";
+            }
+            
+            static std::string _format_option_error(const ParseFailure& failure) {
+                return "Error parsing argument " + failure.token + ": " + failure.text;
+            }
+            
+            static std::string _format_positional_error(const ParseFailure& failure) {
+                return "Error parsing positional argument '" + failure.token + "': " + failure.text;
+            }
+            
+            static std::string _format_conversion_error(const ParseFailure& failure) {
+                return failure.argument->definition().conversion_error(failure.number_error, failure.text);
+            }
+            
+            static std::string _format_positional_conversion_error(const ParseFailure& failure) {
+                return "Error parsing positional argument '" + failure.token + "': " + _format_conversion_error(failure);
+            }
+            
+            static std::string _format_invalid_option(const ParseFailure& failure) {
+                return "argument " + failure.token + ": " +
+                       failure.argument->get_validation_error_message(failure.value);
+            }
+            
+            static std::string _format_invalid_positional(const ParseFailure& failure) {
+                return "Error parsing positional argument '" + failure.token + "': " + _format_invalid_option(failure);
+            }
+            
+            static std::string _format_missing_required(const ParseFailure& failure) {
+                return ErrorFormatter::format_multiple_required_error(failure.names);
+            }
+            
+            static std::string _format_missing_positional(const ParseFailure& failure) {
+                std::string message = "the following arguments are required: ";
+                for (size_t i = 0; i < failure.names.size(); ++i) {
+                    if (i > 0) message += ", ";
+                    message += failure.names[i];
                 }
-                
-                return names[0];
+                return message;
             }
         };
     } // namespace detail
     
+    namespace detail {
+        // 選択肢から既定のmetavar（{a,b,c}）を組み立てる
+        // 選択肢がない、表示できない値がある、または使用法が長くなりすぎる場合
+        // （10個を超える、60文字を超える）は空を返し、通常のmetavarを使わせる
+        inline std::string choices_metavar(const ArgumentDefinition& def) {
+            const size_t max_choices = 10;
+            const size_t max_width = 60;
+            if (def.choices.empty() || def.choices.size() > max_choices || !def.choice_index) {
+                return std::string();
+            }
+            std::string metavar = "{";
+            std::string text;
+            for (size_t i = 0; i < def.choices.size(); ++i) {
+                if (!def.choice_index->format(def.choices[i], text)) {
+                    return std::string();
+                }
+                if (i > 0) metavar += ",";
+                metavar += text;
+                if (metavar.size() + 1 > max_width) {
+                    return std::string();
+                }
+            }
+            metavar += "}";
+            return metavar;
+        }
+    }
+    
     // HelpGenerator implementation (after ArgumentParser definition)
     inline std::string detail::HelpGenerator::generate_help(const ArgumentParser& parser) {
         std::ostringstream oss;
@@ -2003,8 +6500,8 @@ namespace argparse {
             oss << names[0];
             
             // metavarまたはnargsに基づいた値表示
-            if (def.action != "store_true" && def.action != "store_false" && def.action != "count" && def.action != "help") {
-                std::string metavar = def.metavar;
+            if (action_takes_value(def.action_kind)) {
+                std::string metavar = def.metavar.empty() ? choices_metavar(def) : def.metavar;
                 if (metavar.empty()) {
                     // デフォルトのmetavar生成
                     std::string base = names[0];
@@ -2046,7 +6543,10 @@ namespace argparse {
         for (const auto& arg : positionals) {
             const auto& def = arg->definition();
             std::string name = arg->get_name();
-            std::string metavar = def.metavar.empty() ? name : def.metavar;
+            std::string metavar = def.metavar.empty() ? choices_metavar(def) : def.metavar;
+            if (metavar.empty()) {
+                metavar = name;
+            }
             
             oss << " ";
             
@@ -2105,10 +6605,17 @@ namespace argparse {
                     if (arg->is_positional()) {
                         // 位置引数の場合
                         std::string name = arg->get_name();
-                        std::string metavar = def.metavar.empty() ? name : def.metavar;
+                        std::string metavar = def.metavar.empty() ? choices_metavar(def) : def.metavar;
+                        if (metavar.empty()) {
+                            metavar = name;
+                        }
                         
                         std::string arg_str = metavar;
-                        oss << std::left << std::setw(20) << arg_str;
+                        if (def.help.empty()) {
+                            oss << arg_str;
+                        } else {
+                            oss << std::left << std::setw(20) << arg_str;
+                        }
                         
                         if (!def.help.empty()) {
                             // ヘルプテキストを折り返し（80文字幅を考慮）
@@ -2152,8 +6659,8 @@ namespace argparse {
                         }
                         
                         // metavarを追加（action次第）
-                        if (def.action != "store_true" && def.action != "store_false" && def.action != "count" && def.action != "help") {
-                            std::string metavar = def.metavar;
+                        if (action_takes_value(def.action_kind)) {
+                            std::string metavar = def.metavar.empty() ? choices_metavar(def) : def.metavar;
                             if (metavar.empty()) {
                                 // デフォルトのmetavar生成
                                 for (const auto& name : sorted_names) {
@@ -2179,8 +6686,10 @@ namespace argparse {
                             }
                         }
                         
-                        // 引数名が長い場合の処理
-                        if (arg_str.length() >= 20) {
+                        // 引数名が長い場合の処理（ヘルプがなければ桁揃えの空白を出さない）
+                        if (def.help.empty()) {
+                            oss << arg_str;
+                        } else if (arg_str.length() >= 20) {
                             oss << arg_str << "\n" << std::string(24, ' ');
                         } else {
                             oss << std::left << std::setw(20) << arg_str;
@@ -2331,7 +6840,7 @@ namespace argparse {
                 const auto& names = arg->get_names();
                 if (!names.empty()) {
                     oss << " " << names[0];
-                    if (arg->definition().action == "store") {
+                    if (arg->definition().action_kind == ActionKind::STORE) {
                         oss << " " << (arg->definition().metavar.empty() ? "VALUE" : arg->definition().metavar);
                     }
                 }
@@ -2368,6 +6877,7 @@ namespace argparse {
         // ArgumentParserにも引数を追加
         if (parser_) {
             parser_->arguments_.push_back(arg);
+            parser_->plan_.reset();
             parser_->argument_map_[name] = arg;
         }
         
@@ -2382,6 +6892,7 @@ namespace argparse {
         // ArgumentParserにも引数を追加
         if (parser_) {
             parser_->arguments_.push_back(arg);
+            parser_->plan_.reset();
             parser_->argument_map_[short_name] = arg;
             parser_->argument_map_[long_name] = arg;
         }
@@ -2396,6 +6907,7 @@ namespace argparse {
         // ArgumentParserにも引数を追加
         if (parser_) {
             parser_->arguments_.push_back(arg);
+            parser_->plan_.reset();
             for (const auto& name : names) {
                 parser_->argument_map_[name] = arg;
             }
@@ -2404,80 +6916,640 @@ namespace argparse {
         return *arg;
     }
     
-    // ArgumentParser parse_args method implementations
-    inline Namespace ArgumentParser::parse_args(int argc, char* argv[], bool throw_on_error) {
-        // Set program name from argv[0] if not already set (default or empty)
-        if ((prog_ == "program" || prog_.empty()) && argc > 0) {
-            prog_ = _extract_prog_name(std::string(argv[0]));
+    namespace detail {
+        // 解析結果のメッセージ（ヘルプ要求ならヘルプ本文、成功時は空）
+        inline std::string parse_message(const ArgumentParser* parser, const ParseFailure& failure) {
+            if (failure.status == ParseStatus::HELP_REQUESTED && parser) {
+                return HelpGenerator::generate_help(*parser);
+            }
+            return failure.message();
         }
         
-        try {
-            detail::Parser parser;
-            return parser.parse(argc, argv, arguments_);
-        } catch (const help_requested&) {
-            // Generate and display help message, then exit (or throw for tests)
-            std::string help_message = detail::HelpGenerator::generate_help(*this);
-            if (throw_on_error) {
-                throw help_requested(help_message);  // Throw help_requested with message for tests
-            } else {
-                std::cout << help_message << std::endl;
+        // parse_args が失敗時に表示するusage付きのメッセージ
+        inline std::string parse_message_with_usage(const ArgumentParser* parser, const ParseFailure& failure) {
+            if (failure.status == ParseStatus::SUCCESS || failure.status == ParseStatus::HELP_REQUESTED || !parser) {
+                return parse_message(parser, failure);
+            }
+            return ErrorFormatter::format_error_with_usage(*parser, failure.message());
+        }
+    }
+    
+    // ParseOutput: 解析時のヘルプ・エラーの出力先（parse_args(args, output) に渡す）
+    // 既定の parse_args(args, false) は std::cout/std::cerr に書き出してプロセスを終了する
+    class ParseOutput {
+    public:
+        virtual ~ParseOutput() {}
+        
+        // Help was requested (-h/--help); text is the full help message
+        virtual void help(const std::string& text) = 0;
+        
+        // Parsing failed; message includes the usage line, as printed by parse_args
+        virtual void error(ParseStatus status, const std::string& message) = 0;
+    };
+    
+    namespace detail {
+        // 従来の parse_args(args, false) の出力先：表示してプロセスを終了する
+        class ExitingOutput : public ParseOutput {
+        public:
+            void help(const std::string& text) override {
+                std::cout << text << std::endl;
                 std::exit(0);
             }
-        } catch (const detail::ArgumentError& e) {
-            if (throw_on_error) {
-                // For tests: convert ArgumentError to std::runtime_error to maintain compatibility
-                throw std::runtime_error(e.what());
-            } else {
-                // Format error with usage and display
-                std::string error_message = detail::ErrorFormatter::format_error_with_usage(*this, e.what());
-                std::cerr << error_message;
+            
+            void error(ParseStatus, const std::string& message) override {
+                std::cerr << message;
                 std::exit(2);
             }
-        } catch (const std::invalid_argument& e) {
-            if (throw_on_error) {
-                throw;  // Re-throw for tests
-            } else {
-                // Handle type conversion and validation errors
-                std::string error_message = detail::ErrorFormatter::format_error_with_usage(*this, e.what());
-                std::cerr << error_message;
-                std::exit(2);
+        };
+    }
+    
+    // ParseResult: 例外を使わない解析の結果（try_parse_args の戻り値）
+    // 成功時は解析結果のNamespaceを、失敗時はエラー種別・引数位置を保持する。
+    // メッセージは message() を呼ぶまで組み立てない
+    class ParseResult {
+        friend class CompiledParser;
+        
+    private:
+        Namespace values_;
+        detail::ParseFailure failure_;
+        const ArgumentParser* parser_;  // ヘルプ・usage の生成用
+        
+    public:
+        enum : size_t { npos = detail::ParseFailure::npos };
+        
+        ParseResult() : parser_(nullptr) {}
+        
+        ParseResult(const ArgumentParser& parser, Namespace&& values, detail::ParseFailure&& failure)
+            : values_(std::move(values)), failure_(std::move(failure)), parser_(&parser) {}
+        
+        // Whether parsing succeeded
+        bool ok() const { return failure_.status == ParseStatus::SUCCESS; }
+        explicit operator bool() const { return ok(); }
+        
+        // Error category (SUCCESS on success)
+        ParseStatus status() const { return failure_.status; }
+        
+        // Position of the offending argument, not counting argv[0] (npos if not tied to one)
+        size_t argument_index() const { return failure_.argument_index; }
+        
+        // Option (as written) or positional key the error refers to (empty if none)
+        const std::string& argument_name() const { return failure_.token; }
+        
+        // Parsed values (only meaningful when ok())
+        const Namespace& values() const { return values_; }
+        Namespace& values() { return values_; }
+        
+        // Error message formatted on demand; the help text for HELP_REQUESTED, empty on success
+        std::string message() const {
+            return detail::parse_message(parser_, failure_);
+        }
+        
+        // Error message with the usage line, as printed by parse_args on failure
+        std::string message_with_usage() const {
+            return detail::parse_message_with_usage(parser_, failure_);
+        }
+        
+        // Low-level failure record
+        const detail::ParseFailure& failure() const { return failure_; }
+    };
+    
+    // ParseContext: 繰り返しの解析で使い回す作業領域（CompiledParser::try_parse_args に渡す）
+    // トークン化と値の一時領域、結果のNamespaceを保持し、前回の解析で確保した領域
+    // （スロット、文字列やリストの容量）を解放せずに次の解析で再利用する。
+    // 同じ形のコマンドラインであれば、2回目以降の解析はヒープ確保を行わない。
+    // values() は次の解析まで有効。1つのスレッドからのみ使うこと
+    class ParseContext {
+        friend class CompiledParser;
+        
+    private:
+        detail::Parser parser_;
+        Namespace values_;
+        detail::ParseFailure failure_;
+        const ArgumentParser* owner_;  // ヘルプ・usage の生成用
+        
+    public:
+        enum : size_t { npos = detail::ParseFailure::npos };
+        
+        ParseContext() : owner_(nullptr) {}
+        
+        ParseContext(const ParseContext&) = delete;
+        ParseContext& operator=(const ParseContext&) = delete;
+        
+        // Whether the last parse succeeded
+        bool ok() const { return failure_.status == ParseStatus::SUCCESS; }
+        explicit operator bool() const { return ok(); }
+        
+        // Error category of the last parse (SUCCESS on success)
+        ParseStatus status() const { return failure_.status; }
+        
+        // Position of the offending argument, not counting argv[0] (npos if not tied to one)
+        size_t argument_index() const { return failure_.argument_index; }
+        
+        // Option (as written) or positional key the error refers to (empty if none)
+        const std::string& argument_name() const { return failure_.token; }
+        
+        // Values of the last parse (only meaningful when ok(); valid until the next parse)
+        const Namespace& values() const { return values_; }
+        Namespace& values() { return values_; }
+        
+        // Error message formatted on demand; the help text for HELP_REQUESTED, empty on success
+        std::string message() const {
+            return detail::parse_message(owner_, failure_);
+        }
+        
+        // Error message with the usage line, as printed by parse_args on failure
+        std::string message_with_usage() const {
+            return detail::parse_message_with_usage(owner_, failure_);
+        }
+        
+        // Low-level failure record
+        const detail::ParseFailure& failure() const { return failure_; }
+        
+    private:
+        // 解析の開始（前回の失敗記録を消し、解析計画を差し替える）
+        detail::Parser& _begin(const ArgumentParser& owner, const std::shared_ptr<const detail::ParsePlan>& plan) {
+            owner_ = &owner;
+            failure_ = detail::ParseFailure();
+            parser_.set_plan(plan);
+            return parser_;
+        }
+    };
+    
+    namespace detail {
+        // WorkRange: ワーカーごとの未処理の要素範囲 [begin, end)
+        // 持ち主は先頭から1件ずつ取り出し、手の空いたワーカーは末尾側の半分を奪う
+        class WorkRange {
+        private:
+            std::mutex mutex_;
+            size_t begin_;
+            size_t end_;
+            
+        public:
+            WorkRange() : begin_(0), end_(0) {}
+            
+            void assign(size_t begin, size_t end) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                begin_ = begin;
+                end_ = end;
+            }
+            
+            bool pop_front(size_t& index) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (begin_ == end_) {
+                    return false;
+                }
+                index = begin_++;
+                return true;
+            }
+            
+            // 残りの後ろ半分（残りが1件ならその1件）を取り出す
+            bool steal_back(size_t& begin, size_t& end) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                size_t remaining = end_ - begin_;
+                if (remaining == 0) {
+                    return false;
+                }
+                begin = end_ - (remaining + 1) / 2;
+                end = end_;
+                end_ = begin;
+                return true;
+            }
+            
+            size_t remaining() {
+                std::lock_guard<std::mutex> lock(mutex_);
+                return end_ - begin_;
+            }
+        };
+        
+        // 0 件の指定はハードウェアのスレッド数とし、要素数とハードウェアのスレッド数の4倍を超えないようにする
+        inline size_t worker_count(size_t requested, size_t items) {
+            const size_t hardware = std::max<size_t>(1, std::thread::hardware_concurrency());
+            if (requested == 0) {
+                requested = hardware;
+            }
+            return std::max<size_t>(1, std::min(std::min(requested, items), hardware * 4));
+        }
+        
+        // count 件の要素を workers 個のスレッドで処理する（呼び出し元のスレッドもワーカー0として働く）
+        // 要素は均等に分割して割り当て、自分の範囲を処理し終えたワーカーは残りの最も多い範囲から奪う。
+        // task(worker, index) が送出した最初の例外は、全スレッドの終了後に呼び出し元へ再送出する。
+        // スレッドを作れなかった場合は起動済みのワーカーだけで続ける（未起動の範囲も奪って処理される）
+        template<typename Task>
+        void run_work_stealing(size_t count, size_t workers, Task& task) {
+            if (workers <= 1) {
+                for (size_t index = 0; index < count; ++index) {
+                    task(0, index);
+                }
+                return;
+            }
+            
+            std::unique_ptr<WorkRange[]> ranges(new WorkRange[workers]);
+            for (size_t worker = 0; worker < workers; ++worker) {
+                ranges[worker].assign(count * worker / workers, count * (worker + 1) / workers);
+            }
+            
+            std::atomic<bool> stopped(false);
+            std::mutex error_mutex;
+            std::exception_ptr error;
+            
+            auto steal = [&](size_t thief) {
+                size_t victim = thief;
+                size_t most = 0;
+                for (size_t offset = 1; offset < workers; ++offset) {
+                    size_t candidate = (thief + offset) % workers;
+                    size_t remaining = ranges[candidate].remaining();
+                    if (remaining > most) {
+                        most = remaining;
+                        victim = candidate;
+                    }
+                }
+                size_t begin = 0;
+                size_t end = 0;
+                if (victim == thief || !ranges[victim].steal_back(begin, end)) {
+                    return most > 0;  // 取り合いに負けた場合は探し直す
+                }
+                ranges[thief].assign(begin, end);
+                return true;
+            };
+            
+            auto work = [&](size_t worker) {
+                try {
+                    size_t index = 0;
+                    do {
+                        while (!stopped.load(std::memory_order_relaxed) && ranges[worker].pop_front(index)) {
+                            task(worker, index);
+                        }
+                    } while (!stopped.load(std::memory_order_relaxed) && steal(worker));
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(error_mutex);
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                    stopped.store(true);
+                }
+            };
+            
+            std::vector<std::thread> threads;
+            threads.reserve(workers - 1);
+            try {
+                for (size_t worker = 1; worker < workers; ++worker) {
+                    threads.emplace_back(work, worker);
+                }
+            } catch (const std::system_error&) {
+                // スレッド数の上限やメモリ不足：起動できた分だけで処理する
+            }
+            work(0);
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            if (error) {
+                std::rethrow_exception(error);
             }
         }
     }
     
-    inline Namespace ArgumentParser::parse_args(const std::vector<std::string>& args, bool throw_on_error) {
-        try {
-            detail::Parser parser;
-            return parser.parse(args, arguments_);
-        } catch (const help_requested&) {
-            // Generate and display help message, then exit (or throw for tests)
-            std::string help_message = detail::HelpGenerator::generate_help(*this);
-            if (throw_on_error) {
-                throw help_requested(help_message);  // Throw help_requested with message for tests
-            } else {
-                std::cout << help_message << std::endl;
-                std::exit(0);
+    // CompiledParser: 引数定義を凍結した再利用可能なパーサー
+    // ArgumentParser::compile() で生成し、解析計画を以降の全解析で共有する。
+    // ヘルプ・エラーメッセージの生成に元のArgumentParserを参照するため、元より長く生存させないこと
+    class CompiledParser {
+    private:
+        const ArgumentParser* parser_;
+        std::shared_ptr<const detail::ParsePlan> plan_;
+        
+    public:
+        CompiledParser(const ArgumentParser& parser, const std::shared_ptr<const detail::ParsePlan>& plan)
+            : parser_(&parser), plan_(plan) {}
+        
+        // Parse command line arguments (argv[0] is skipped, argv is not copied)
+        Namespace parse_args(int argc, char* argv[], bool throw_on_error = true) const {
+            return _parse_with_handling(try_parse_args(argc, argv), throw_on_error);
+        }
+        
+        // Parse from string vector
+        Namespace parse_args(const std::vector<std::string>& args, bool throw_on_error = true) const {
+            return _parse_with_handling(try_parse_args(args), throw_on_error);
+        }
+        
+        // Parse without throwing (argv[0] is skipped, argv is not copied)
+        ParseResult try_parse_args(int argc, char* argv[]) const {
+            detail::Parser parser(plan_);
+            Namespace values;
+            detail::ParseFailure failure;
+            parser.try_parse(argc, argv, values, failure);
+            return ParseResult(*parser_, std::move(values), std::move(failure));
+        }
+        
+        // Parse from string vector without throwing
+        ParseResult try_parse_args(const std::vector<std::string>& args) const {
+            detail::Parser parser(plan_);
+            Namespace values;
+            detail::ParseFailure failure;
+            parser.try_parse(args, values, failure);
+            return ParseResult(*parser_, std::move(values), std::move(failure));
+        }
+        
+        // Parse and report help and errors to output instead of throwing or exiting
+        // (reentrant: any number of threads may parse with one CompiledParser at once)
+        ParseResult parse_args(int argc, char* argv[], ParseOutput& output) const {
+            ParseResult result = try_parse_args(argc, argv);
+            _report(result, output);
+            return result;
+        }
+        
+        ParseResult parse_args(const std::vector<std::string>& args, ParseOutput& output) const {
+            ParseResult result = try_parse_args(args);
+            _report(result, output);
+            return result;
+        }
+        
+        // Parse without throwing into a reusable context (argv[0] is skipped, argv is not copied);
+        // storage allocated by earlier parses with the same context is reused
+        bool try_parse_args(int argc, char* argv[], ParseContext& context) const {
+            return context._begin(*parser_, plan_).try_parse(argc, argv, context.values_, context.failure_);
+        }
+        
+        bool try_parse_args(const std::vector<std::string>& args, ParseContext& context) const {
+            return context._begin(*parser_, plan_).try_parse(args, context.values_, context.failure_);
+        }
+        
+        // Batch parsing: many argument vectors against this plan without exceptions
+        // (the tokenizer and value buffers are shared by all items of the batch)
+        
+        // Parse each argument vector in [first, last) and keep every result, in input order
+        std::vector<ParseResult> parse_batch(const std::vector<std::string>* first,
+                                             const std::vector<std::string>* last) const {
+            std::vector<ParseResult> results;
+            results.reserve(static_cast<size_t>(last - first));
+            detail::Parser parser(plan_);
+            for (; first != last; ++first) {
+                results.emplace_back();
+                ParseResult& result = results.back();
+                result.parser_ = parser_;
+                parser.try_parse(*first, result.values_, result.failure_);
             }
-        } catch (const detail::ArgumentError& e) {
-            if (throw_on_error) {
-                // For tests: convert ArgumentError to std::runtime_error to maintain compatibility
-                throw std::runtime_error(e.what());
-            } else {
-                // Format error with usage and display
-                std::string error_message = detail::ErrorFormatter::format_error_with_usage(*this, e.what());
-                std::cerr << error_message;
-                std::exit(2);
+            return results;
+        }
+        
+        std::vector<ParseResult> parse_batch(const std::vector<std::vector<std::string>>& batch) const {
+            return parse_batch(batch.data(), batch.data() + batch.size());
+        }
+        
+        // Parse each argument vector in [first, last) into one reusable context and call
+        // visitor(index, context) after each item; returns the number of items that failed
+        template<typename Visitor>
+        size_t parse_batch(const std::vector<std::string>* first, const std::vector<std::string>* last,
+                           ParseContext& context, Visitor visitor) const {
+            size_t failed = 0;
+            for (size_t index = 0; first != last; ++first, ++index) {
+                if (!try_parse_args(*first, context)) {
+                    ++failed;
+                }
+                visitor(index, context);
             }
-        } catch (const std::invalid_argument& e) {
-            if (throw_on_error) {
-                throw;  // Re-throw for tests
-            } else {
-                // Handle type conversion and validation errors
-                std::string error_message = detail::ErrorFormatter::format_error_with_usage(*this, e.what());
-                std::cerr << error_message;
-                std::exit(2);
+            return failed;
+        }
+        
+        template<typename Visitor>
+        size_t parse_batch(const std::vector<std::vector<std::string>>& batch, ParseContext& context,
+                           Visitor visitor) const {
+            return parse_batch(batch.data(), batch.data() + batch.size(), context, visitor);
+        }
+        
+        // Parallel batch parsing: the items are shared among worker threads by work stealing,
+        // so a few very long argument vectors do not stall the others. Each worker owns its
+        // tokenizer and value buffers; threads = 0 uses the hardware thread count
+        
+        // Parse each argument vector in [first, last) in parallel and keep every result, in input order
+        std::vector<ParseResult> parse_batch_parallel(const std::vector<std::string>* first,
+                                                      const std::vector<std::string>* last,
+                                                      size_t threads = 0) const {
+            const size_t count = static_cast<size_t>(last - first);
+            std::vector<ParseResult> results(count);
+            const size_t workers = detail::worker_count(threads, count);
+            std::vector<detail::Parser> parsers;
+            parsers.reserve(workers);
+            for (size_t worker = 0; worker < workers; ++worker) {
+                parsers.emplace_back(plan_);
+            }
+            auto task = [&](size_t worker, size_t index) {
+                ParseResult& result = results[index];
+                result.parser_ = parser_;
+                parsers[worker].try_parse(first[index], result.values_, result.failure_);
+            };
+            detail::run_work_stealing(count, workers, task);
+            return results;
+        }
+        
+        std::vector<ParseResult> parse_batch_parallel(const std::vector<std::vector<std::string>>& batch,
+                                                      size_t threads = 0) const {
+            return parse_batch_parallel(batch.data(), batch.data() + batch.size(), threads);
+        }
+        
+        // Parse each argument vector in [first, last) in parallel, each worker into its own reusable
+        // context, and call visitor(index, context) after each item. The visitor is called from the
+        // worker threads concurrently, in no particular order. Returns the number of items that failed
+        template<typename Visitor>
+        size_t parse_batch_parallel(const std::vector<std::string>* first, const std::vector<std::string>* last,
+                                    size_t threads, Visitor visitor) const {
+            const size_t count = static_cast<size_t>(last - first);
+            const size_t workers = detail::worker_count(threads, count);
+            std::unique_ptr<ParseContext[]> contexts(new ParseContext[workers]);
+            std::atomic<size_t> failed(0);
+            auto task = [&](size_t worker, size_t index) {
+                ParseContext& context = contexts[worker];
+                if (!try_parse_args(first[index], context)) {
+                    failed.fetch_add(1, std::memory_order_relaxed);
+                }
+                visitor(index, static_cast<const ParseContext&>(context));
+            };
+            detail::run_work_stealing(count, workers, task);
+            return failed.load();
+        }
+        
+        template<typename Visitor>
+        size_t parse_batch_parallel(const std::vector<std::vector<std::string>>& batch, size_t threads,
+                                    Visitor visitor) const {
+            return parse_batch_parallel(batch.data(), batch.data() + batch.size(), threads, visitor);
+        }
+        
+        // Parse and store values of bind() arguments into the members of target
+        // (arguments that were not given and have no default leave their member unchanged)
+        template<typename Owner>
+        void parse_into(int argc, char* argv[], Owner& target, bool throw_on_error = true) const {
+            Namespace values = parse_args(argc, argv, throw_on_error);
+            detail::store_bound_values(*plan_, values, target);
+        }
+        
+        template<typename Owner>
+        void parse_into(const std::vector<std::string>& args, Owner& target, bool throw_on_error = true) const {
+            Namespace values = parse_args(args, throw_on_error);
+            detail::store_bound_values(*plan_, values, target);
+        }
+        
+        // Parse into a value-initialized Owner
+        template<typename Owner>
+        Owner parse_into(int argc, char* argv[]) const {
+            Owner target = Owner();
+            parse_into(argc, argv, target);
+            return target;
+        }
+        
+        template<typename Owner>
+        Owner parse_into(const std::vector<std::string>& args) const {
+            Owner target = Owner();
+            parse_into(args, target);
+            return target;
+        }
+        
+        // Parse without throwing and store bound values into target on success;
+        // values() of the result keeps only the arguments that are not bound.
+        // A value that does not fit its member is reported as ParseStatus::BINDING_FAILED
+        template<typename Owner>
+        ParseResult try_parse_into(const std::vector<std::string>& args, Owner& target) const {
+            ParseResult result = try_parse_args(args);
+            if (result.ok()) {
+                detail::store_bound_values(*plan_, result.values(), target, result.failure_);
+            }
+            return result;
+        }
+        
+        // Access to the frozen parse plan
+        const detail::ParsePlan& plan() const { return *plan_; }
+        
+        // Resolve the Namespace slot of a storage key once, for use with Namespace::get_slot
+        size_t slot(const std::string& name) const {
+            return plan_->schema()->slot(detail::StringView(name));
+        }
+        
+        // Parser this plan was compiled from
+        const ArgumentParser& parser() const { return *parser_; }
+        
+    private:
+        // Translate a failed result (print and exit, or throw for tests)
+        Namespace _parse_with_handling(ParseResult&& result, bool throw_on_error) const;
+        
+        // Report a failed result to output (nothing on success)
+        static void _report(const ParseResult& result, ParseOutput& output) {
+            if (result.status() == ParseStatus::HELP_REQUESTED) {
+                output.help(result.message());
+            } else if (!result.ok()) {
+                output.error(result.status(), result.message_with_usage());
+            }
+        }
+    };
+    
+    inline Namespace CompiledParser::_parse_with_handling(ParseResult&& result, bool throw_on_error) const {
+        if (result.ok()) {
+            return std::move(result.values());
+        }
+        
+        switch (result.failure().raise) {
+            case detail::ParseFailure::RAISE_HELP:
+                if (throw_on_error) {
+                    throw help_requested(result.message());  // Throw help_requested with message for tests
+                }
+                break;
+                
+            case detail::ParseFailure::RAISE_ARGUMENT_ERROR:
+            case detail::ParseFailure::RAISE_INVALID_ARGUMENT:
+                if (throw_on_error) {
+                    // For tests: ArgumentError is reported as std::runtime_error to maintain compatibility
+                    if (result.failure().raise == detail::ParseFailure::RAISE_INVALID_ARGUMENT) {
+                        throw std::invalid_argument(result.message());
+                    }
+                    throw std::runtime_error(result.message());
+                }
+                break;
+                
+            case detail::ParseFailure::RAISE_RUNTIME_ERROR:
+                throw std::runtime_error(result.message());
+        }
+        
+        // Display help or the error with usage, then exit
+        detail::ExitingOutput output;
+        _report(result, output);
+        throw std::runtime_error(result.message());
+    }
+    
+    // ArgumentParser compile / parse_args method implementations
+    inline CompiledParser ArgumentParser::compile() const {
+        // 複数のスレッドから同時に呼ばれても安全なように、キャッシュはアトミックに読み書きする
+        // （同時に構築された場合は最初に格納された計画を全員が使う）
+        std::shared_ptr<const detail::ParsePlan> plan = std::atomic_load(&plan_);
+        if (!plan) {
+            std::shared_ptr<const detail::ParsePlan> built =
+                std::make_shared<detail::ParsePlan>(arguments_, lazy_conversion_, fromfile_prefix_chars_);
+            if (std::atomic_compare_exchange_strong(&plan_, &plan, built)) {
+                plan = built;
             }
         }
+        return CompiledParser(*this, plan);
+    }
+    
+    inline Namespace ArgumentParser::parse_args(int argc, char* argv[], bool throw_on_error) {
+        // Set program name from argv[0] if not already set (default or empty)
+        if ((prog_ == "program" || prog_.empty()) && argc > 0) {
+            prog_ = _extract_prog_name(std::string(argv[0]));
+        }
+        
+        return compile().parse_args(argc, argv, throw_on_error);
+    }
+    
+    inline Namespace ArgumentParser::parse_args(const std::vector<std::string>& args, bool throw_on_error) {
+        return compile().parse_args(args, throw_on_error);
+    }
+    
+    inline ParseResult ArgumentParser::try_parse_args(int argc, char* argv[]) {
+        // Set program name from argv[0] if not already set (default or empty)
+        if ((prog_ == "program" || prog_.empty()) && argc > 0) {
+            prog_ = _extract_prog_name(std::string(argv[0]));
+        }
+        
+        return compile().try_parse_args(argc, argv);
+    }
+    
+    inline ParseResult ArgumentParser::try_parse_args(const std::vector<std::string>& args) {
+        return compile().try_parse_args(args);
+    }
+    
+    inline ParseResult ArgumentParser::parse_args(int argc, char* argv[], ParseOutput& output) const {
+        return compile().parse_args(argc, argv, output);
+    }
+    
+    inline ParseResult ArgumentParser::parse_args(const std::vector<std::string>& args, ParseOutput& output) const {
+        return compile().parse_args(args, output);
+    }
+    
+    template<typename Owner>
+    void ArgumentParser::parse_into(int argc, char* argv[], Owner& target, bool throw_on_error) {
+        if ((prog_ == "program" || prog_.empty()) && argc > 0) {
+            prog_ = _extract_prog_name(std::string(argv[0]));
+        }
+        compile().parse_into(argc, argv, target, throw_on_error);
+    }
+    
+    template<typename Owner>
+    void ArgumentParser::parse_into(const std::vector<std::string>& args, Owner& target, bool throw_on_error) {
+        compile().parse_into(args, target, throw_on_error);
+    }
+    
+    template<typename Owner>
+    Owner ArgumentParser::parse_into(int argc, char* argv[]) {
+        Owner target = Owner();
+        parse_into(argc, argv, target);
+        return target;
+    }
+    
+    template<typename Owner>
+    Owner ArgumentParser::parse_into(const std::vector<std::string>& args) {
+        Owner target = Owner();
+        parse_into(args, target);
+        return target;
+    }
+    
+    template<typename Owner>
+    ParseResult ArgumentParser::try_parse_into(const std::vector<std::string>& args, Owner& target) {
+        return compile().try_parse_into(args, target);
     }
     
 } // namespace argparse
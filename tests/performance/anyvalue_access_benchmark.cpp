@@ -0,0 +1,102 @@
+// AnyValue の型付き取得の計測：dynamic_cast による従来方式と型タグ比較の比較
+//
+// 従来方式は仮想基底クラスを持つHolder<T>をdynamic_castで取り出していた。
+// 比較のため、その実装をこのファイル内に再現している。
+
+#include <string>
+#include <vector>
+#include "../../include/argparse/argparse.hpp"
+#include "benchmark_util.hpp"
+
+namespace legacy {
+
+class BaseHolder {
+public:
+    virtual ~BaseHolder() {}
+    virtual const std::type_info& type() const = 0;
+};
+
+template<typename T>
+class Holder : public BaseHolder {
+public:
+    explicit Holder(const T& value) : value_(value) {}
+    virtual const std::type_info& type() const override { return typeid(T); }
+    const T& get() const { return value_; }
+
+private:
+    T value_;
+};
+
+template<typename T>
+const T& get(const BaseHolder* holder) {
+    const Holder<T>* typed = dynamic_cast<const Holder<T>*>(holder);
+    if (!typed) {
+        throw std::runtime_error(std::string("Type mismatch: ") + holder->type().name());
+    }
+    return typed->get();
+}
+
+} // namespace legacy
+
+int main() {
+    const size_t count = 64;
+    const size_t rounds = 20000;
+
+    std::vector<legacy::BaseHolder*> holders;
+    std::vector<argparse::detail::AnyValue> values;
+    for (size_t i = 0; i < count; ++i) {
+        if (i % 2 == 0) {
+            holders.push_back(new legacy::Holder<int>(static_cast<int>(i)));
+            values.push_back(argparse::detail::AnyValue(static_cast<int>(i)));
+        } else {
+            holders.push_back(new legacy::Holder<bool>(i % 3 == 0));
+            values.push_back(argparse::detail::AnyValue(i % 3 == 0));
+        }
+    }
+
+    double legacy_ns = bench::measure_ns(rounds, [&]() {
+        long sum = 0;
+        for (size_t i = 0; i < count; i += 2) {
+            sum += legacy::get<int>(holders[i]);
+            sum += legacy::get<bool>(holders[i + 1]);
+        }
+        bench::do_not_optimize(sum);
+    }) / static_cast<double>(count);
+
+    double get_ns = bench::measure_ns(rounds, [&]() {
+        long sum = 0;
+        for (size_t i = 0; i < count; i += 2) {
+            sum += values[i].get<int>();
+            sum += values[i + 1].get<bool>();
+        }
+        bench::do_not_optimize(sum);
+    }) / static_cast<double>(count);
+
+    double try_get_ns = bench::measure_ns(rounds, [&]() {
+        long sum = 0;
+        for (size_t i = 0; i < count; i += 2) {
+            sum += *values[i].try_get<int>();
+            sum += *values[i + 1].try_get<bool>();
+        }
+        bench::do_not_optimize(sum);
+    }) / static_cast<double>(count);
+
+    // 型不一致時：従来方式は例外、try_getはnullptr
+    double miss_ns = bench::measure_ns(rounds, [&]() {
+        size_t misses = 0;
+        for (size_t i = 0; i < count; ++i) {
+            misses += values[i].try_get<double>() == nullptr;
+        }
+        bench::do_not_optimize(misses);
+    }) / static_cast<double>(count);
+
+    bench::report("dynamic_cast get<T>", legacy_ns);
+    bench::report("AnyValue::get<T> (type tag)", get_ns);
+    bench::report("AnyValue::try_get<T> (type tag)", try_get_ns);
+    bench::report("AnyValue::try_get<T> mismatch", miss_ns);
+
+    for (legacy::BaseHolder* holder : holders) {
+        delete holder;
+    }
+    return 0;
+}
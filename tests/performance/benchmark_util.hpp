@@ -0,0 +1,48 @@
+#pragma once
+
+// ベンチマーク共通ユーティリティ（計測と結果表示）
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+namespace bench {
+
+// 最適化による計算の除去を防ぐためのシンク
+// GCC/Clangではコンパイラバリアで値を参照したことにする（アドレスを保持しないため、ローカル変数を渡してもよい）
+template<typename T>
+inline void do_not_optimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "g"(&value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+    sink = nullptr;
+#endif
+}
+
+// fnをiterations回実行し、1回あたりの平均時間（ナノ秒）を返す
+template<typename Fn>
+inline double measure_ns(size_t iterations, Fn fn) {
+    // ウォームアップ
+    for (size_t i = 0; i < iterations / 10 + 1; ++i) {
+        fn();
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+        fn();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double total = static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    return total / static_cast<double>(iterations);
+}
+
+// 結果を1行で表示
+inline void report(const std::string& name, double ns_per_op) {
+    std::printf("%-48s %14.1f ns/op\n", name.c_str(), ns_per_op);
+}
+
+} // namespace bench
@@ -0,0 +1,107 @@
+// 構造体への直接書き込みの計測：Namespace::get<T>(name) による参照と bind() したメンバの参照の比較
+//
+// 150 個のフィールド（整数・浮動小数点数・文字列を50個ずつ）を持つ設定を解析し、
+// ホットパスで全フィールドを繰り返し読む場合を想定する。
+
+#include <string>
+#include <vector>
+#include "../../include/argparse/argparse.hpp"
+#include "benchmark_util.hpp"
+
+namespace {
+
+#define FOR_EACH_INDEX(M) \
+    M(0) M(1) M(2) M(3) M(4) M(5) M(6) M(7) M(8) M(9) M(10) M(11) M(12) M(13) M(14) M(15) M(16) \
+    M(17) M(18) M(19) M(20) M(21) M(22) M(23) M(24) M(25) M(26) M(27) M(28) M(29) M(30) M(31) M(32) \
+    M(33) M(34) M(35) M(36) M(37) M(38) M(39) M(40) M(41) M(42) M(43) M(44) M(45) M(46) M(47) M(48) \
+    M(49)
+
+struct Config {
+#define DECLARE_FIELDS(i) int number##i = 0; double real##i = 0; std::string name##i;
+    FOR_EACH_INDEX(DECLARE_FIELDS)
+#undef DECLARE_FIELDS
+};
+
+void define_options(argparse::ArgumentParser& parser, bool bind) {
+#define ADD_OPTIONS(i) \
+    { \
+        argparse::Argument& number = parser.add_argument("--number" #i); \
+        argparse::Argument& real = parser.add_argument("--real" #i); \
+        argparse::Argument& name = parser.add_argument("--name" #i); \
+        if (bind) { \
+            number.bind(&Config::number##i); \
+            real.bind(&Config::real##i); \
+            name.bind(&Config::name##i); \
+        } else { \
+            number.type<int>(); \
+            real.type<double>(); \
+        } \
+    }
+    FOR_EACH_INDEX(ADD_OPTIONS)
+#undef ADD_OPTIONS
+}
+
+} // namespace
+
+int main() {
+    const size_t rounds = 2000;
+    
+    std::vector<std::string> args;
+    std::vector<std::string> numbers;
+    std::vector<std::string> reals;
+    std::vector<std::string> names;
+    for (int i = 0; i < 50; ++i) {
+        std::string index = std::to_string(i);
+        args.insert(args.end(), {"--number" + index, "42", "--real" + index, "2.5", "--name" + index, "service"});
+        numbers.push_back("number" + index);
+        reals.push_back("real" + index);
+        names.push_back("name" + index);
+    }
+    
+    argparse::ArgumentParser named("bench");
+    define_options(named, false);
+    argparse::CompiledParser named_compiled = named.compile();
+    
+    argparse::ArgumentParser bound("bench");
+    define_options(bound, true);
+    argparse::CompiledParser bound_compiled = bound.compile();
+    
+    // Namespace::get<T>(name)：読むたびにキーの検索と値の複写が起きる
+    argparse::Namespace ns = named_compiled.parse_args(args);
+    double get_ns = bench::measure_ns(rounds, [&]() {
+        double total = 0;
+        for (size_t i = 0; i < 50; ++i) {
+            total += ns.get<int>(numbers[i]);
+            total += ns.get<double>(reals[i]);
+            total += static_cast<double>(ns.get<std::string>(names[i]).size());
+        }
+        bench::do_not_optimize(total);
+    });
+    
+    // bind()：解析時に一度だけメンバへ書き込み、以降は普通のメンバアクセス
+    Config config = bound_compiled.parse_into<Config>(args);
+    double member_ns = bench::measure_ns(rounds, [&]() {
+        bench::do_not_optimize(config);  // 各回でメンバを読み直させる
+        double total = 0;
+#define READ_FIELDS(i) total += config.number##i + config.real##i + static_cast<double>(config.name##i.size());
+        FOR_EACH_INDEX(READ_FIELDS)
+#undef READ_FIELDS
+        bench::do_not_optimize(total);
+    });
+    
+    double parse_ns = bench::measure_ns(rounds / 4, [&]() {
+        argparse::Namespace values = named_compiled.parse_args(args);
+        bench::do_not_optimize(values);
+    });
+    double parse_into_ns = bench::measure_ns(rounds / 4, [&]() {
+        Config target;
+        bound_compiled.parse_into(args, target);
+        bench::do_not_optimize(target);
+    });
+    
+    bench::report("read 150 fields: Namespace::get<T>(name)", get_ns);
+    bench::report("read 150 fields: bound struct members", member_ns);
+    bench::report("parse 150 options: parse_args", parse_ns);
+    bench::report("parse 150 options: parse_into", parse_into_ns);
+    return 0;
+}
@@ -0,0 +1,49 @@
+// choices の検証の計測：AnyValue::equals による線形探索と検索表の比較
+//
+// 5000 個の文字列の選択肢（地域コード等を想定）に対して、含まれる値と含まれない値を検証する。
+
+#include <string>
+#include <vector>
+#include "../../include/argparse/argparse.hpp"
+#include "benchmark_util.hpp"
+
+int main() {
+    const size_t count = 5000;
+    const size_t rounds = 2000;
+    
+    std::vector<std::string> regions;
+    for (size_t i = 0; i < count; ++i) {
+        regions.push_back("region-" + std::to_string(i));
+    }
+    
+    argparse::Argument indexed("--region");
+    indexed.choices(regions);
+    
+    // 従来の線形探索（検索表なしで choices だけを設定した場合と同じ経路）
+    argparse::Argument linear("--region");
+    for (const auto& region : regions) {
+        linear.definition().choices.push_back(argparse::detail::AnyValue(region));
+    }
+    
+    argparse::detail::AnyValue hit(std::string("region-3750"));
+    argparse::detail::AnyValue miss(std::string("region-9999"));
+    
+    double linear_hit_ns = bench::measure_ns(rounds, [&]() {
+        bench::do_not_optimize(linear.validate_value(hit));
+    });
+    double indexed_hit_ns = bench::measure_ns(rounds, [&]() {
+        bench::do_not_optimize(indexed.validate_value(hit));
+    });
+    double linear_miss_ns = bench::measure_ns(rounds, [&]() {
+        bench::do_not_optimize(linear.validate_value(miss));
+    });
+    double indexed_miss_ns = bench::measure_ns(rounds, [&]() {
+        bench::do_not_optimize(indexed.validate_value(miss));
+    });
+    
+    bench::report("linear equals, 5000 choices (hit)", linear_hit_ns);
+    bench::report("hashed index, 5000 choices (hit)", indexed_hit_ns);
+    bench::report("linear equals, 5000 choices (miss)", linear_miss_ns);
+    bench::report("hashed index, 5000 choices (miss)", indexed_miss_ns);
+    return 0;
+}
@@ -0,0 +1,49 @@
+// 解析計画（ParsePlan）の再利用による1回あたりの解析セットアップコストの計測
+//
+// 200以上のオプションを持つパーサーで、毎回引数定義から解析計画を構築する経路と
+// compile() 済みのCompiledParserを再利用する経路を比較する。
+
+#include <string>
+#include <vector>
+#include "../../include/argparse/argparse.hpp"
+#include "benchmark_util.hpp"
+
+int main() {
+    const int option_count = 250;
+    const size_t iterations = 20000;
+
+    argparse::ArgumentParser parser("bench", "compile benchmark");
+    for (int i = 0; i < option_count; ++i) {
+        parser.add_argument("--option-" + std::to_string(i)).help("option " + std::to_string(i));
+    }
+    parser.add_argument("input");
+
+    std::vector<std::string> args = {"--option-7", "a", "--option-120", "b", "file.txt"};
+
+    // 解析計画の構築のみ（従来は毎回の parse_args で発生していたコスト）
+    double setup_ns = bench::measure_ns(iterations, [&]() {
+        argparse::detail::ParsePlan plan(parser.get_arguments());
+        bench::do_not_optimize(plan);
+    });
+
+    // 毎回解析計画を構築して解析
+    double rebuild_ns = bench::measure_ns(iterations, [&]() {
+        argparse::detail::Parser internal_parser;
+        argparse::Namespace ns = internal_parser.parse(args, parser.get_arguments());
+        bench::do_not_optimize(ns);
+    });
+
+    // compile() 済みの解析計画を再利用して解析
+    argparse::CompiledParser compiled = parser.compile();
+    double compiled_ns = bench::measure_ns(iterations, [&]() {
+        argparse::Namespace ns = compiled.parse_args(args);
+        bench::do_not_optimize(ns);
+    });
+
+    std::printf("options: %d, iterations: %zu\n", option_count, iterations);
+    bench::report("plan build (per-parse setup, old path)", setup_ns);
+    bench::report("parse with plan rebuilt every call", rebuild_ns);
+    bench::report("parse with CompiledParser", compiled_ns);
+    bench::report("setup cost saved per parse", rebuild_ns - compiled_ns);
+    return 0;
+}
@@ -0,0 +1,56 @@
+// 大量の値を取る nargs="*" 引数の解析コスト計測
+//
+// 全トークンを保持するTokenizerと、逐次分類するTokenCursorでの走査、
+// およびParser全体での解析時間を比較する。
+
+#include <string>
+#include <vector>
+#include "../../include/argparse/argparse.hpp"
+#include "benchmark_util.hpp"
+
+int main() {
+    const size_t value_count = 200000;
+    const size_t iterations = 20;
+
+    std::vector<std::string> args;
+    args.reserve(value_count + 1);
+    args.push_back("--files");
+    for (size_t i = 0; i < value_count; ++i) {
+        args.push_back("path/to/file_" + std::to_string(i) + ".txt");
+    }
+
+    // 全トークンを構築してから走査
+    double tokenizer_ns = bench::measure_ns(iterations, [&]() {
+        argparse::detail::Tokenizer tokenizer;
+        tokenizer.tokenize(args);
+        size_t total = 0;
+        while (tokenizer.has_next()) {
+            total += tokenizer.next().value.size();
+        }
+        bench::do_not_optimize(total);
+    });
+
+    // 逐次分類しながら走査
+    double cursor_ns = bench::measure_ns(iterations, [&]() {
+        argparse::detail::TokenCursor cursor{argparse::detail::ArgumentSource(args)};
+        size_t total = 0;
+        while (cursor.has_next()) {
+            total += cursor.next().value.size();
+        }
+        bench::do_not_optimize(total);
+    });
+
+    argparse::ArgumentParser parser("bench", "cursor benchmark");
+    parser.add_argument("--files").nargs("*");
+    argparse::CompiledParser compiled = parser.compile();
+    double parse_ns = bench::measure_ns(iterations, [&]() {
+        argparse::Namespace ns = compiled.parse_args(args);
+        bench::do_not_optimize(ns);
+    });
+
+    std::printf("values: %zu, iterations: %zu\n", value_count, iterations);
+    bench::report("Tokenizer (materialized tokens)", tokenizer_ns);
+    bench::report("TokenCursor (streaming)", cursor_ns);
+    bench::report("parse_args with nargs=\"*\"", parse_ns);
+    return 0;
+}
@@ -0,0 +1,84 @@
+// 列挙値の選択肢の計測：文字列の選択肢＋アプリ側の文字列比較と、名前 → 列挙値の表の比較
+//
+// 従来はchoices<std::string>で検証した後、アプリケーションが文字列比較の連鎖で列挙値に変換していた。
+
+#include <string>
+#include <vector>
+#include "../../include/argparse/argparse.hpp"
+#include "benchmark_util.hpp"
+
+namespace {
+
+enum class Renderer { SIMPLE, FANCY, CAPS, PLAIN, MARKDOWN, HTML, JSON, YAML };
+
+const argparse::EnumChoice<Renderer> RENDERERS[] = {
+    {"simple", Renderer::SIMPLE},
+    {"fancy", Renderer::FANCY},
+    {"caps", Renderer::CAPS},
+    {"plain", Renderer::PLAIN},
+    {"markdown", Renderer::MARKDOWN},
+    {"html", Renderer::HTML},
+    {"json", Renderer::JSON},
+    {"yaml", Renderer::YAML},
+};
+
+Renderer renderer_from_name(const std::string& name) {
+    if (name == "simple") return Renderer::SIMPLE;
+    if (name == "fancy") return Renderer::FANCY;
+    if (name == "caps") return Renderer::CAPS;
+    if (name == "plain") return Renderer::PLAIN;
+    if (name == "markdown") return Renderer::MARKDOWN;
+    if (name == "html") return Renderer::HTML;
+    if (name == "json") return Renderer::JSON;
+    return Renderer::YAML;
+}
+
+} // namespace
+
+int main() {
+    const size_t rounds = 20000;
+    
+    argparse::ArgumentParser string_parser("bench");
+    string_parser.add_argument("--renderer").choices(std::vector<std::string>{
+        "simple", "fancy", "caps", "plain", "markdown", "html", "json", "yaml"});
+    argparse::CompiledParser string_compiled = string_parser.compile();
+    
+    argparse::ArgumentParser enum_parser("bench");
+    enum_parser.add_argument("--renderer").choices(RENDERERS);
+    argparse::CompiledParser enum_compiled = enum_parser.compile();
+    
+    std::vector<std::string> args = {"--renderer", "json"};
+    
+    double string_ns = bench::measure_ns(rounds, [&]() {
+        argparse::Namespace result = string_compiled.parse_args(args);
+        bench::do_not_optimize(renderer_from_name(result.get<std::string>("renderer")));
+    });
+    double enum_ns = bench::measure_ns(rounds, [&]() {
+        argparse::Namespace result = enum_compiled.parse_args(args);
+        bench::do_not_optimize(result.get<Renderer>("renderer"));
+    });
+    
+    // 値1つ分の変換と検証だけを比較する
+    argparse::Argument string_arg("--renderer");
+    string_arg.choices(std::vector<std::string>{"simple", "fancy", "caps", "plain", "markdown", "html", "json", "yaml"});
+    argparse::Argument enum_arg("--renderer");
+    enum_arg.choices(RENDERERS);
+    const std::string text = "yaml";
+    
+    double string_value_ns = bench::measure_ns(rounds, [&]() {
+        argparse::detail::AnyValue value = string_arg.convert_value(text);
+        bool valid = string_arg.validate_value(value);
+        bench::do_not_optimize(valid ? renderer_from_name(value.get<std::string>()) : Renderer::SIMPLE);
+    });
+    double enum_value_ns = bench::measure_ns(rounds, [&]() {
+        argparse::detail::AnyValue value = enum_arg.convert_value(text);
+        bool valid = enum_arg.validate_value(value);
+        bench::do_not_optimize(valid ? value.get<Renderer>() : Renderer::SIMPLE);
+    });
+    
+    bench::report("parse: string choices + string compares", string_ns);
+    bench::report("parse: enum choices table", enum_ns);
+    bench::report("value: string choices + string compares", string_value_ns);
+    bench::report("value: enum choices table", enum_value_ns);
+    return 0;
+}
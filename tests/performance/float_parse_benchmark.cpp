@@ -0,0 +1,93 @@
+// 浮動小数点数の変換の計測：std::stod による従来の変換器と parse_float の比較
+//
+// 1M 個の数値文字列（短い小数、指数表記、17桁の往復表現）を変換する。
+
+#include <cstdio>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "../../include/argparse/argparse.hpp"
+#include "benchmark_util.hpp"
+
+namespace legacy {
+
+// 従来の float_converter と同じ処理（前後の空白を除去してから std::stod）
+inline double stod_convert(const std::string& value) {
+    size_t start = value.find_first_not_of(" \t\n\r");
+    if (start == std::string::npos) {
+        throw std::invalid_argument("invalid float value: '" + value + "'");
+    }
+    size_t end = value.find_last_not_of(" \t\n\r");
+    std::string trimmed = value.substr(start, end - start + 1);
+    size_t pos;
+    double result = std::stod(trimmed, &pos);
+    if (pos != trimmed.length()) {
+        throw std::invalid_argument("invalid float value: '" + value + "'");
+    }
+    return result;
+}
+
+} // namespace legacy
+
+int main() {
+    const size_t count = 1000000;
+    
+    std::mt19937_64 rng(12345);
+    std::uniform_real_distribution<double> distribution(-1e6, 1e6);
+    std::vector<std::string> inputs;
+    inputs.reserve(count);
+    char buffer[64];
+    for (size_t i = 0; i < count; ++i) {
+        double value = distribution(rng);
+        switch (i % 3) {
+            case 0: std::snprintf(buffer, sizeof(buffer), "%.3f", value); break;
+            case 1: std::snprintf(buffer, sizeof(buffer), "%.6e", value * 1e-20); break;
+            default: std::snprintf(buffer, sizeof(buffer), "%.17g", value); break;
+        }
+        inputs.push_back(buffer);
+    }
+    
+    double stod_ns = bench::measure_ns(1, [&]() {
+        double sum = 0;
+        for (const auto& input : inputs) {
+            sum += legacy::stod_convert(input);
+        }
+        bench::do_not_optimize(sum);
+    }) / static_cast<double>(count);
+    
+    double parse_double_ns = bench::measure_ns(1, [&]() {
+        double sum = 0;
+        for (const auto& input : inputs) {
+            double value = 0;
+            argparse::detail::parse_float(argparse::detail::StringView(input), value);
+            sum += value;
+        }
+        bench::do_not_optimize(sum);
+    }) / static_cast<double>(count);
+    
+    double parse_float_ns = bench::measure_ns(1, [&]() {
+        float sum = 0;
+        for (const auto& input : inputs) {
+            float value = 0;
+            argparse::detail::parse_float(argparse::detail::StringView(input), value);
+            sum += value;
+        }
+        bench::do_not_optimize(sum);
+    }) / static_cast<double>(count);
+    
+    auto converter = argparse::detail::TypeConverter::get_converter<float>();
+    double converter_ns = bench::measure_ns(1, [&]() {
+        float sum = 0;
+        for (const auto& input : inputs) {
+            sum += converter(input).get<float>();
+        }
+        bench::do_not_optimize(sum);
+    }) / static_cast<double>(count);
+    
+    bench::report("std::stod (legacy float_converter)", stod_ns);
+    bench::report("parse_float<double>", parse_double_ns);
+    bench::report("parse_float<float>", parse_float_ns);
+    bench::report("get_converter<float>() (AnyValue)", converter_ns);
+    return 0;
+}
@@ -0,0 +1,64 @@
+// 遅延変換モードの計測：多数のオプションを定義し、その一部だけを参照する場合
+//
+// 400 個のオプション（整数・浮動小数点数・選択肢付き文字列、すべて既定値あり）を定義し、
+// 40 個を指定して 20 個だけを参照する。即時変換と遅延変換で解析＋参照の時間を比較する。
+
+#include <string>
+#include <vector>
+#include "../../include/argparse/argparse.hpp"
+#include "benchmark_util.hpp"
+
+namespace {
+
+void define_options(argparse::ArgumentParser& parser) {
+    std::vector<std::string> modes;
+    for (int i = 0; i < 16; ++i) {
+        modes.push_back("mode" + std::to_string(i));
+    }
+    for (int i = 0; i < 400; ++i) {
+        std::string name = "--option-" + std::to_string(i);
+        switch (i % 3) {
+            case 0: parser.add_argument(name).type<int>().default_value(i); break;
+            case 1: parser.add_argument(name).type<double>().default_value(i * 0.5); break;
+            default: parser.add_argument(name).choices(modes).default_value(std::string("mode0")); break;
+        }
+    }
+}
+
+double measure(bool lazy, const std::vector<std::string>& args, const std::vector<std::string>& reads) {
+    argparse::ArgumentParser parser("bench");
+    define_options(parser);
+    parser.lazy_conversion(lazy);
+    argparse::CompiledParser compiled = parser.compile();
+    
+    return bench::measure_ns(2000, [&]() {
+        argparse::Namespace ns = compiled.parse_args(args);
+        size_t total = 0;
+        for (const auto& key : reads) {
+            total += ns.get_raw(key).empty() ? 0 : 1;
+        }
+        bench::do_not_optimize(total);
+    });
+}
+
+} // namespace
+
+int main() {
+    std::vector<std::string> args;
+    for (int i = 0; i < 400; i += 10) {
+        args.push_back("--option-" + std::to_string(i));
+        switch (i % 3) {
+            case 0: args.push_back(std::to_string(i * 7)); break;
+            case 1: args.push_back("3.25"); break;
+            default: args.push_back("mode7"); break;
+        }
+    }
+    std::vector<std::string> reads;
+    for (int i = 0; i < 400; i += 20) {
+        reads.push_back("option-" + std::to_string(i));
+    }
+    
+    bench::report("eager: parse 40 of 400 options, read 20", measure(false, args, reads));
+    bench::report("lazy:  parse 40 of 400 options, read 20", measure(true, args, reads));
+    return 0;
+}
@@ -0,0 +1,57 @@
+// 複数値引数（nargs "+"）の変換の計測：要素ごとの AnyValue 経由と一括変換の比較
+//
+// 数値ツールで数千個の浮動小数点数をコマンドラインから受け取る場合を想定し、
+// type<double>().nargs("+") の引数に 4096 個の値を渡して解析する。
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "../../include/argparse/argparse.hpp"
+#include "benchmark_util.hpp"
+
+int main() {
+    const size_t count = 4096;
+    const size_t rounds = 200;
+    
+    std::vector<std::string> texts;
+    char buffer[32];
+    for (size_t i = 0; i < count; ++i) {
+        std::snprintf(buffer, sizeof(buffer), "%.6f", static_cast<double>(i) * 0.125 + 0.001);
+        texts.push_back(buffer);
+    }
+    
+    // 要素ごとに変換器を呼び、AnyValue を経由して std::vector<double> に追加する方式
+    argparse::detail::Converter converter = argparse::detail::TypeConverter::get_converter<double>();
+    double per_element_ns = bench::measure_ns(rounds, [&]() {
+        argparse::detail::AnyValue list;
+        for (const auto& text : texts) {
+            argparse::detail::append_typed_value<double>(list, converter(text));
+        }
+        bench::do_not_optimize(list);
+    }) / static_cast<double>(count);
+    
+    // 一括変換（連続領域へ直接書き込む）
+    double batched_ns = bench::measure_ns(rounds, [&]() {
+        argparse::detail::AnyValue list;
+        size_t failed = 0;
+        argparse::detail::convert_list<double>(texts.data(), texts.size(), list, failed);
+        bench::do_not_optimize(list);
+    }) / static_cast<double>(count);
+    
+    // パーサー全体（トークン化・収集・変換）
+    argparse::ArgumentParser parser("bench");
+    parser.add_argument("--values").type<double>().nargs("+");
+    argparse::CompiledParser compiled = parser.compile();
+    std::vector<std::string> args;
+    args.push_back("--values");
+    args.insert(args.end(), texts.begin(), texts.end());
+    double parse_ns = bench::measure_ns(rounds, [&]() {
+        argparse::Namespace ns = compiled.parse_args(args);
+        bench::do_not_optimize(ns);
+    }) / static_cast<double>(count);
+    
+    bench::report("per-element AnyValue + append", per_element_ns);
+    bench::report("convert_list<double>", batched_ns);
+    bench::report("parse_args --values x4096 (per value)", parse_ns);
+    return 0;
+}
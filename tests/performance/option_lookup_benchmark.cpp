@@ -0,0 +1,55 @@
+// オプション名検索の計測：std::map と OptionTable（完全ハッシュ、hash-and-displace）の比較
+//
+// 10/100/1000/5000個のオプション名に対し、定義済みの名前を順に検索する。
+
+#include <map>
+#include <string>
+#include <vector>
+#include "../../include/argparse/argparse.hpp"
+#include "benchmark_util.hpp"
+
+int main() {
+    const size_t sizes[] = {10, 100, 1000, 5000};
+    const size_t lookups = 200000;
+
+    for (size_t n : sizes) {
+        std::vector<std::string> names;
+        std::vector<std::pair<std::string, size_t>> items;
+        std::map<std::string, size_t> map;
+        for (size_t i = 0; i < n; ++i) {
+            std::string name = "--generated-option-" + std::to_string(i);
+            names.push_back(name);
+            items.push_back(std::make_pair(name, i));
+            map[name] = i;
+        }
+
+        double build_ns = bench::measure_ns(5, [&]() {
+            argparse::detail::OptionTable table(items);
+            bench::do_not_optimize(table);
+        });
+        argparse::detail::OptionTable table(items);
+
+        // 検索順は名前を飛び飛びに辿る
+        double map_ns = bench::measure_ns(1, [&]() {
+            size_t sum = 0;
+            for (size_t i = 0; i < lookups; ++i) {
+                sum += map.find(names[(i * 7919) % n])->second;
+            }
+            bench::do_not_optimize(sum);
+        }) / static_cast<double>(lookups);
+
+        double table_ns = bench::measure_ns(1, [&]() {
+            size_t sum = 0;
+            for (size_t i = 0; i < lookups; ++i) {
+                sum += table.find(argparse::detail::StringView(names[(i * 7919) % n]));
+            }
+            bench::do_not_optimize(sum);
+        }) / static_cast<double>(lookups);
+
+        std::printf("options: %zu\n", n);
+        bench::report("  std::map find", map_ns);
+        bench::report("  OptionTable find", table_ns);
+        bench::report("  OptionTable build", build_ns);
+    }
+    return 0;
+}
@@ -0,0 +1,93 @@
+// 並列バッチ解析のスレッド数によるスケーリングの計測
+//
+// 大半は短い引数列で、一部に5万個のファイル引数を持つジョブが偏って並ぶ入力を、
+// 1〜32スレッドの parse_batch_parallel（ワークスティーリング）で解析する。
+// 比較として、要素を均等に静的分割して各スレッドが自分の範囲だけを処理する方式も計測する。
+// 要求スレッド数はハードウェアのスレッド数の4倍で頭打ちになるため、実際のワーカー数を併記し、
+// 静的分割も同じワーカー数で比べる。
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../../include/argparse/argparse.hpp"
+#include "benchmark_util.hpp"
+
+namespace {
+
+// 静的分割（ワークスティーリングなし）
+size_t parse_static_partition(const argparse::CompiledParser& compiled,
+                              const std::vector<std::vector<std::string>>& jobs, size_t threads) {
+    std::vector<size_t> failed(threads, 0);
+    std::vector<std::thread> pool;
+    for (size_t worker = 0; worker < threads; ++worker) {
+        pool.emplace_back([&, worker]() {
+            argparse::ParseContext context;
+            size_t begin = jobs.size() * worker / threads;
+            size_t end = jobs.size() * (worker + 1) / threads;
+            for (size_t i = begin; i < end; ++i) {
+                if (!compiled.try_parse_args(jobs[i], context)) {
+                    ++failed[worker];
+                }
+            }
+        });
+    }
+    for (auto& thread : pool) {
+        thread.join();
+    }
+    size_t total = 0;
+    for (size_t count : failed) {
+        total += count;
+    }
+    return total;
+}
+
+} // namespace
+
+int main() {
+    const size_t job_count = 20000;
+    const size_t rounds = 3;
+
+    argparse::ArgumentParser parser("job");
+    parser.add_argument("--priority").type<int>().default_value(0);
+    parser.add_argument("--queue").choices(std::vector<std::string>{"batch", "interactive"});
+    parser.add_argument("--retries").type<int>().default_value(3);
+    parser.add_argument("files").nargs("+");
+
+    // 先頭付近に重いジョブを集中させる（静的分割では最初のスレッドに偏る）
+    std::vector<std::vector<std::string>> jobs;
+    jobs.reserve(job_count);
+    for (size_t i = 0; i < job_count; ++i) {
+        std::vector<std::string> job = {"--priority", std::to_string(i % 10), "--queue", "batch"};
+        size_t files = (i < job_count / 8 && i % 250 == 0) ? 50000 : 4;
+        for (size_t j = 0; j < files; ++j) {
+            job.push_back("/data/" + std::to_string(j) + ".dat");
+        }
+        jobs.push_back(job);
+    }
+
+    argparse::CompiledParser compiled = parser.compile();
+
+    std::printf("jobs: %zu (every 250th of the first 1/8 has 50000 files), hardware threads: %u\n",
+                job_count, std::thread::hardware_concurrency());
+    double baseline_ns = 0;
+    for (size_t threads : {1, 2, 4, 8, 16, 32}) {
+        const size_t workers = argparse::detail::worker_count(threads, job_count);
+        double stealing_ns = bench::measure_ns(rounds, [&]() {
+            size_t failed = compiled.parse_batch_parallel(jobs, threads,
+                                                          [](size_t, const argparse::ParseContext&) {});
+            bench::do_not_optimize(failed);
+        }) / static_cast<double>(job_count);
+        double static_ns = bench::measure_ns(rounds, [&]() {
+            size_t failed = parse_static_partition(compiled, jobs, workers);
+            bench::do_not_optimize(failed);
+        }) / static_cast<double>(job_count);
+        if (threads == 1) {
+            baseline_ns = stealing_ns;
+        }
+
+        std::printf("threads %2zu (workers %2zu): work stealing %10.1f ns/job (x%.2f), static partition %10.1f ns/job\n",
+                    threads, workers, stealing_ns, baseline_ns / stealing_ns, static_ns);
+    }
+    return 0;
+}
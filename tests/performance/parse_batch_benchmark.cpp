@@ -0,0 +1,89 @@
+// 保存済みの引数列を大量に検証する場合のスループット（jobs/sec）の計測
+//
+// 1割が不正な入力を含むジョブ群を、parse_args を1件ずつ呼ぶ（失敗は例外で受ける）経路と、
+// parse_batch で結果を保持する経路、ParseContext を使い回して要素ごとに処理する経路で比較する。
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "../../include/argparse/argparse.hpp"
+#include "benchmark_util.hpp"
+
+namespace {
+
+void report_throughput(const std::string& name, double ns_per_job) {
+    std::printf("%-48s %14.1f ns/job %12.0f jobs/sec\n", name.c_str(), ns_per_job, 1e9 / ns_per_job);
+}
+
+} // namespace
+
+int main() {
+    const size_t job_count = 10000;
+    const size_t rounds = 20;
+
+    argparse::ArgumentParser parser("job");
+    parser.add_argument("--priority").type<int>().default_value(0);
+    parser.add_argument("--queue").choices(std::vector<std::string>{"batch", "interactive"});
+    parser.add_argument("--memory").type<argparse::ByteSize>();
+    parser.add_argument("--retries").type<int>().default_value(3);
+    parser.add_argument("--verbose").action("store_true");
+    parser.add_argument("inputs").nargs("+");
+
+    std::vector<std::vector<std::string>> jobs;
+    jobs.reserve(job_count);
+    for (size_t i = 0; i < job_count; ++i) {
+        std::vector<std::string> job = {"--priority", std::to_string(i % 10), "--queue", "batch",
+                                        "--memory", "512MiB", "--retries", "5"};
+        if (i % 10 == 0) {
+            job[1] = "urgent";  // 不正な値
+        }
+        if (i % 3 == 0) {
+            job.push_back("--verbose");
+        }
+        for (size_t j = 0; j < 4; ++j) {
+            job.push_back("/data/jobs/" + std::to_string(i) + "/input" + std::to_string(j) + ".dat");
+        }
+        jobs.push_back(job);
+    }
+
+    argparse::CompiledParser compiled = parser.compile();
+
+    // parse_args を1件ずつ呼ぶ（失敗は例外）
+    double loop_ns = bench::measure_ns(rounds, [&]() {
+        size_t failed = 0;
+        for (const auto& job : jobs) {
+            try {
+                argparse::Namespace ns = compiled.parse_args(job);
+                bench::do_not_optimize(ns);
+            } catch (const std::exception&) {
+                ++failed;
+            }
+        }
+        bench::do_not_optimize(failed);
+    }) / static_cast<double>(job_count);
+
+    // 全件の結果を保持する
+    double results_ns = bench::measure_ns(rounds, [&]() {
+        std::vector<argparse::ParseResult> results = compiled.parse_batch(jobs);
+        bench::do_not_optimize(results);
+    }) / static_cast<double>(job_count);
+
+    // 作業領域を使い回し、要素ごとに処理する
+    argparse::ParseContext context;
+    double visitor_ns = bench::measure_ns(rounds, [&]() {
+        long long total = 0;
+        size_t failed = compiled.parse_batch(jobs, context, [&](size_t, const argparse::ParseContext& item) {
+            if (item.ok()) {
+                total += item.values().get<int>("priority");
+            }
+        });
+        bench::do_not_optimize(total);
+        bench::do_not_optimize(failed);
+    }) / static_cast<double>(job_count);
+
+    std::printf("jobs: %zu (10%% invalid), rounds: %zu\n", job_count, rounds);
+    report_throughput("parse_args loop (exceptions)", loop_ns);
+    report_throughput("parse_batch (results kept)", results_ns);
+    report_throughput("parse_batch (reused ParseContext)", visitor_ns);
+    return 0;
+}
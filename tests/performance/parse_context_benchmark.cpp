@@ -0,0 +1,58 @@
+// ParseContext の再利用による1回あたりの解析コストの計測
+//
+// 30個のオプションを持つ典型的なコマンドラインで、解析ごとに Namespace と一時領域を
+// 確保する try_parse_args と、作業領域を使い回す try_parse_args(args, context) を比較する。
+
+#include <string>
+#include <vector>
+#include "../../include/argparse/argparse.hpp"
+#include "benchmark_util.hpp"
+
+int main() {
+    const size_t iterations = 200000;
+
+    argparse::ArgumentParser parser("bench");
+    for (int i = 0; i < 10; ++i) {
+        parser.add_argument("--count" + std::to_string(i)).type<int>();
+        parser.add_argument("--name" + std::to_string(i));
+    }
+    for (int i = 0; i < 5; ++i) {
+        parser.add_argument("--flag" + std::to_string(i)).action("store_true");
+    }
+    parser.add_argument("-v", "--verbose").action("count");
+    parser.add_argument("--sizes").type<int>().nargs("+");
+    parser.add_argument("--ratio").type<double>().default_value(0.5);
+    parser.add_argument("--mode").choices(std::vector<std::string>{"fast", "slow"});
+    parser.add_argument("input");
+
+    std::vector<std::string> args;
+    for (int i = 0; i < 10; ++i) {
+        args.push_back("--count" + std::to_string(i));
+        args.push_back(std::to_string(i * 100));
+        args.push_back("--name" + std::to_string(i) + "=/var/lib/service/data/file" + std::to_string(i) + ".bin");
+    }
+    for (int i = 0; i < 5; ++i) {
+        args.push_back("--flag" + std::to_string(i));
+    }
+    args.insert(args.end(), {"-vv", "--sizes", "1", "2", "3", "--ratio", "0.25", "--mode", "fast", "input.txt"});
+
+    argparse::CompiledParser compiled = parser.compile();
+
+    // 解析ごとに結果と一時領域を確保する
+    double fresh_ns = bench::measure_ns(iterations, [&]() {
+        argparse::ParseResult result = compiled.try_parse_args(args);
+        bench::do_not_optimize(result);
+    });
+
+    // 作業領域を再利用する
+    argparse::ParseContext context;
+    double reused_ns = bench::measure_ns(iterations, [&]() {
+        bool ok = compiled.try_parse_args(args, context);
+        bench::do_not_optimize(ok);
+    });
+
+    std::printf("arguments: %zu, iterations: %zu\n", args.size(), iterations);
+    bench::report("try_parse_args (fresh Namespace)", fresh_ns);
+    bench::report("try_parse_args (reused ParseContext)", reused_ns);
+    return 0;
+}
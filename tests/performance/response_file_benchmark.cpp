@@ -0,0 +1,93 @@
+// 100万個の引数を持つ応答ファイルの解析の計測
+//
+// ファイルを読み込んで std::vector<std::string> を組み立ててから parse_args(vector) に渡す従来の方法と、
+// fromfile_prefix_chars("@") でファイルをマップしてその場でトークン化する方法を比較する。
+// 最大常駐メモリ（ru_maxrss）は単調増加のため、応答ファイルの計測を先に行う。
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <sys/resource.h>
+#include "../../include/argparse/argparse.hpp"
+#include "benchmark_util.hpp"
+
+namespace {
+
+long peak_rss_kib() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+// 従来の方法：ファイル全体を読み込み、空白で区切って文字列の配列にする
+std::vector<std::string> read_arguments(const std::string& path) {
+    std::ifstream in(path.c_str(), std::ios::binary);
+    std::ostringstream content;
+    content << in.rdbuf();
+    std::string text = content.str();
+
+    std::vector<std::string> args;
+    std::istringstream words(text);
+    std::string word;
+    while (words >> word) {
+        args.push_back(word);
+    }
+    return args;
+}
+
+} // namespace
+
+int main() {
+    const size_t entry_count = 1000000;
+    const size_t rounds = 3;
+    const std::string path = "/tmp/argparse_response_benchmark.rsp";
+
+    {
+        std::ofstream out(path.c_str(), std::ios::binary);
+        out << "--jobs 16 --output 'build output/app'\n";
+        for (size_t i = 0; i < entry_count; ++i) {
+            out << "src/module" << i / 1000 << "/file" << i << ".cpp\n";
+        }
+    }
+
+    argparse::ArgumentParser parser("build");
+    parser.fromfile_prefix_chars("@");
+    parser.add_argument("--jobs").type<int>();
+    parser.add_argument("--output");
+    parser.add_argument("sources").nargs("*");
+    argparse::CompiledParser compiled = parser.compile();
+
+    long rss_before = peak_rss_kib();
+
+    // 応答ファイルを直接展開する（結果の領域は ParseContext で使い回す）
+    argparse::ParseContext context;
+    const std::vector<std::string> response_args = {"@" + path};
+    double response_ns = bench::measure_ns(rounds, [&]() {
+        bool ok = compiled.try_parse_args(response_args, context);
+        bench::do_not_optimize(ok);
+    });
+    if (!context.ok() || context.values().get<std::vector<std::string>>("sources").size() != entry_count) {
+        std::printf("unexpected result: %s\n", context.message().c_str());
+        return 1;
+    }
+    long rss_response = peak_rss_kib();
+
+    // 読み込んで文字列の配列を作ってから解析する
+    double vector_ns = bench::measure_ns(rounds, [&]() {
+        std::vector<std::string> args = read_arguments(path);
+        bool ok = compiled.try_parse_args(args, context);
+        bench::do_not_optimize(ok);
+    });
+    long rss_vector = peak_rss_kib();
+
+    std::printf("entries: %zu, rounds: %zu\n", entry_count, rounds);
+    bench::report("read into vector<string> + parse", vector_ns / entry_count);
+    bench::report("@file (mapped, tokenized in place)", response_ns / entry_count);
+    std::printf("peak RSS growth: @file %ld KiB, then vector<string> path +%ld KiB\n",
+                rss_response - rss_before, rss_vector - rss_response);
+
+    std::remove(path.c_str());
+    return 0;
+}
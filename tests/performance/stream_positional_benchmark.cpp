@@ -0,0 +1,86 @@
+// 100万個の位置引数を受け取る場合の、リストに集める方法と逐次受け渡し（stream()）の比較
+//
+// 応答ファイルに書かれたパスを nargs("*") の位置引数で受け取り、各パスの長さを合計する。
+// 最大常駐メモリ（ru_maxrss）は単調増加のため、逐次受け渡しの計測を先に行う。
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <sys/resource.h>
+#include "../../include/argparse/argparse.hpp"
+#include "benchmark_util.hpp"
+
+namespace {
+
+long peak_rss_kib() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+} // namespace
+
+int main() {
+    const size_t entry_count = 1000000;
+    const size_t rounds = 3;
+    const std::string path = "/tmp/argparse_stream_benchmark.rsp";
+
+    {
+        std::ofstream out(path.c_str(), std::ios::binary);
+        for (size_t i = 0; i < entry_count; ++i) {
+            out << "/data/archive/2024/shard" << i / 1000 << "/object" << i << ".bin\n";
+        }
+    }
+    const std::vector<std::string> args = {"@" + path};
+
+    size_t total_length = 0;
+    argparse::ArgumentParser streaming("stream");
+    streaming.fromfile_prefix_chars("@");
+    streaming.add_argument("paths").nargs("*").stream<std::string>([&](const std::string& value) {
+        total_length += value.size();
+    });
+    argparse::CompiledParser streaming_compiled = streaming.compile();
+
+    argparse::ArgumentParser collecting("collect");
+    collecting.fromfile_prefix_chars("@");
+    collecting.add_argument("paths").nargs("*");
+    argparse::CompiledParser collecting_compiled = collecting.compile();
+
+    long rss_before = peak_rss_kib();
+
+    // 逐次受け渡し
+    argparse::ParseContext stream_context;
+    double stream_ns = bench::measure_ns(rounds, [&]() {
+        total_length = 0;
+        bool ok = streaming_compiled.try_parse_args(args, stream_context);
+        bench::do_not_optimize(ok);
+    });
+    size_t streamed_length = total_length;
+    long rss_stream = peak_rss_kib();
+
+    // リストに集めてから処理する
+    size_t collected_length = 0;
+    double collect_ns = bench::measure_ns(rounds, [&]() {
+        argparse::ParseResult result = collecting_compiled.try_parse_args(args);
+        collected_length = 0;
+        for (const auto& value : result.values().get<std::vector<std::string>>("paths")) {
+            collected_length += value.size();
+        }
+    });
+    long rss_collect = peak_rss_kib();
+
+    if (streamed_length != collected_length) {
+        std::printf("mismatch: %zu vs %zu\n", streamed_length, collected_length);
+        return 1;
+    }
+
+    std::printf("values: %zu, rounds: %zu\n", entry_count, rounds);
+    bench::report("nargs(\"*\") collected into vector<string>", collect_ns / entry_count);
+    bench::report("nargs(\"*\").stream<std::string>()", stream_ns / entry_count);
+    std::printf("peak RSS growth: stream %ld KiB, then collected +%ld KiB\n",
+                rss_stream - rss_before, rss_collect - rss_stream);
+
+    std::remove(path.c_str());
+    return 0;
+}
@@ -0,0 +1,90 @@
+// 単位付きの値の変換の計測：converter<T>() による典型的な自作変換器と組み込みの変換器の比較
+//
+// 自作変換器は std::stod と文字列の接尾辞比較で実装し、CustomConversion（try/catch付き）を経由する。
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include "../../include/argparse/argparse.hpp"
+#include "benchmark_util.hpp"
+
+namespace {
+
+uint64_t handwritten_byte_size(const std::string& text) {
+    size_t end = 0;
+    double number = std::stod(text, &end);
+    std::string suffix = text.substr(end);
+    double multiplier = 1;
+    if (suffix == "KiB") multiplier = 1024.0;
+    else if (suffix == "MiB") multiplier = 1024.0 * 1024;
+    else if (suffix == "GiB") multiplier = 1024.0 * 1024 * 1024;
+    else if (suffix == "kB") multiplier = 1e3;
+    else if (suffix == "MB") multiplier = 1e6;
+    else if (suffix == "GB") multiplier = 1e9;
+    else if (!suffix.empty() && suffix != "B") throw std::invalid_argument("bad unit");
+    return static_cast<uint64_t>(number * multiplier);
+}
+
+std::chrono::milliseconds handwritten_duration(const std::string& text) {
+    size_t end = 0;
+    double number = std::stod(text, &end);
+    std::string suffix = text.substr(end);
+    if (suffix == "ms") return std::chrono::milliseconds(static_cast<long long>(number));
+    if (suffix == "s") return std::chrono::milliseconds(static_cast<long long>(number * 1000));
+    if (suffix == "m") return std::chrono::milliseconds(static_cast<long long>(number * 60000));
+    throw std::invalid_argument("bad unit");
+}
+
+double handwritten_rate(const std::string& text) {
+    size_t end = 0;
+    double number = std::stod(text, &end);
+    std::string suffix = text.substr(end);
+    if (suffix == "k") return number * 1e3;
+    if (suffix == "M") return number * 1e6;
+    return number;
+}
+
+} // namespace
+
+int main() {
+    const size_t rounds = 20000;
+    const std::vector<std::string> sizes = {"64MiB", "1.5GB", "4096", "512KiB"};
+    const std::vector<std::string> durations = {"250ms", "30s", "1.5s", "5m"};
+    const std::vector<std::string> rates = {"1.5k", "250", "10M", "0.5k"};
+    
+    using argparse::detail::TypeConverter;
+    argparse::detail::Converter custom_size = TypeConverter::create_custom_converter<uint64_t>(&handwritten_byte_size);
+    argparse::detail::Converter custom_duration =
+        TypeConverter::create_custom_converter<std::chrono::milliseconds>(&handwritten_duration);
+    argparse::detail::Converter custom_rate = TypeConverter::create_custom_converter<double>(&handwritten_rate);
+    argparse::detail::Converter builtin_size = TypeConverter::byte_size_converter();
+    argparse::detail::Converter builtin_duration = TypeConverter::duration_converter<std::chrono::milliseconds>();
+    argparse::detail::Converter builtin_rate = TypeConverter::rate_converter();
+    
+    auto measure = [&](const argparse::detail::Converter& converter, const std::vector<std::string>& inputs) {
+        return bench::measure_ns(rounds, [&]() {
+            for (const auto& input : inputs) {
+                argparse::detail::AnyValue value = converter(input);
+                bench::do_not_optimize(value);
+            }
+        }) / static_cast<double>(inputs.size());
+    };
+    
+    bench::report("byte size: converter<T> (stod + suffix)", measure(custom_size, sizes));
+    bench::report("byte size: type<ByteSize>()", measure(builtin_size, sizes));
+    bench::report("duration: converter<T> (stod + suffix)", measure(custom_duration, durations));
+    bench::report("duration: type<milliseconds>()", measure(builtin_duration, durations));
+    bench::report("rate: converter<T> (stod + suffix)", measure(custom_rate, rates));
+    bench::report("rate: type<Rate>()", measure(builtin_rate, rates));
+    
+    // 範囲外の値：自作変換器は丸めて黙って受け付けるが、組み込みは例外で報告する
+    double overflow_ns = bench::measure_ns(rounds, [&]() {
+        try {
+            builtin_size(std::string("16EiB"));
+        } catch (const std::invalid_argument& e) {
+            bench::do_not_optimize(e);
+        }
+    });
+    bench::report("byte size: out of range (reported)", overflow_ns);
+    return 0;
+}
@@ -99,6 +99,58 @@ TEST_F(ActionTest, AppendActionSingleTest) {
     EXPECT_EQ(files[0], "single.txt");
 }
 
+// Test append action with a typed converter
+TEST_F(ActionTest, AppendTypedTest) {
+    parser.add_argument("--port", "-p").type<int>().action("append");
+    
+    auto ns = parser.parse_args(std::vector<std::string>{"--port", "80", "-p", "443"});
+    
+    const std::vector<int>& ports = ns.get_raw("port").get<std::vector<int>>();
+    ASSERT_EQ(ports.size(), 2);
+    EXPECT_EQ(ports[0], 80);
+    EXPECT_EQ(ports[1], 443);
+    
+    EXPECT_THROW(parser.parse_args(std::vector<std::string>{"--port", "x"}), std::invalid_argument);
+}
+
+// Test append action repeated many times accumulates every value
+TEST_F(ActionTest, AppendManyTest) {
+    parser.add_argument("--input").action("append");
+    
+    std::vector<std::string> args;
+    for (int i = 0; i < 5000; ++i) {
+        args.push_back("--input");
+        args.push_back("in" + std::to_string(i));
+    }
+    
+    auto ns = parser.parse_args(args);
+    const std::vector<std::string>* inputs = ns.try_get<std::vector<std::string>>("input");
+    ASSERT_NE(inputs, nullptr);
+    ASSERT_EQ(inputs->size(), 5000);
+    EXPECT_EQ((*inputs)[4999], "in4999");
+}
+
+// Test extend action
+TEST_F(ActionTest, ExtendActionTest) {
+    parser.add_argument("--values").type<double>().nargs("+").action("extend");
+    parser.add_argument("--names").action("extend").nargs("*");
+    
+    auto ns = parser.parse_args(std::vector<std::string>{
+        "--values", "1.5", "2.5", "--names", "a", "--values", "3", "--names", "b", "c"});
+    
+    auto values = ns.get<std::vector<double>>("values");
+    ASSERT_EQ(values.size(), 3);
+    EXPECT_DOUBLE_EQ(values[0], 1.5);
+    EXPECT_DOUBLE_EQ(values[2], 3.0);
+    
+    auto names = ns.get<std::vector<std::string>>("names");
+    ASSERT_EQ(names.size(), 3);
+    EXPECT_EQ(names[2], "c");
+    
+    EXPECT_EQ(argparse::detail::resolve_action("extend"), argparse::detail::ActionKind::EXTEND);
+    EXPECT_THROW(parser.parse_args(std::vector<std::string>{"--values"}), std::runtime_error);
+}
+
 // Test custom action
 TEST_F(ActionTest, CustomActionTest) {
     // Custom action that accumulates string lengths
@@ -200,4 +252,41 @@ TEST_F(ActionTest, BooleanActionsNoValueTest) {
     std::vector<std::string> args = {"--flag1", "--flag2"};
     
     EXPECT_NO_THROW(auto ns = parser.parse_args(args));
-}
\ No newline at end of file
+}
+// Test action strings are resolved to ActionKind at definition time
+TEST_F(ActionTest, ActionKindResolutionTest) {
+    using argparse::detail::ActionKind;
+    
+    auto& store = parser.add_argument("--store");
+    auto& flag = parser.add_argument("--flag").action("store_true");
+    auto& off = parser.add_argument("--off").action("store_false");
+    auto& count = parser.add_argument("--count").action("count");
+    auto& append = parser.add_argument("--append").action("append");
+    auto& custom = parser.add_argument("--custom").custom_action(
+        [](const argparse::detail::AnyValue& current, const std::string&) { return current; });
+    
+    EXPECT_EQ(store.definition().action_kind, ActionKind::STORE);
+    EXPECT_EQ(flag.definition().action_kind, ActionKind::STORE_TRUE);
+    EXPECT_EQ(off.definition().action_kind, ActionKind::STORE_FALSE);
+    EXPECT_EQ(count.definition().action_kind, ActionKind::COUNT);
+    EXPECT_EQ(append.definition().action_kind, ActionKind::APPEND);
+    EXPECT_EQ(custom.definition().action_kind, ActionKind::CUSTOM);
+    EXPECT_EQ(parser.get_argument("--help")->definition().action_kind, ActionKind::HELP);
+    
+    // The string API keeps reporting the original action name
+    EXPECT_EQ(count.definition().action, "count");
+    
+    // Redefining the action updates the resolved kind
+    count.action("store");
+    EXPECT_EQ(count.definition().action_kind, ActionKind::STORE);
+}
+
+// Test unknown action is reported when the option is used
+TEST_F(ActionTest, UnknownActionTest) {
+    parser.add_argument("--weird").action("no_such_action");
+    
+    EXPECT_EQ(parser.get_argument("--weird")->definition().action_kind,
+              argparse::detail::ActionKind::UNKNOWN);
+    EXPECT_NO_THROW(parser.parse_args(std::vector<std::string>{}));
+    EXPECT_THROW(parser.parse_args(std::vector<std::string>{"--weird"}), std::runtime_error);
+}
@@ -228,4 +228,76 @@ TEST_F(AnyValueTest, NoMemoryLeaks) {
     value = 3.14;
     value.reset();
     // すべて適切にクリーンアップされるはず
-}
\ No newline at end of file
+}
+
+// 小さい値はインラインバッファに格納されることのテスト
+TEST_F(AnyValueTest, SmallValuesAreStoredInline) {
+    EXPECT_TRUE(AnyValue(42).is_inline());
+    EXPECT_TRUE(AnyValue(3.14).is_inline());
+    EXPECT_TRUE(AnyValue(true).is_inline());
+    EXPECT_TRUE(AnyValue(std::string("short")).is_inline());
+    EXPECT_FALSE(AnyValue().is_inline());
+    
+    // バッファに収まらない型はヒープに置かれる
+    typedef std::map<std::string, int> Table;
+    Table table;
+    table["a"] = 1;
+    table["b"] = 2;
+    AnyValue large(table);
+    EXPECT_FALSE(large.is_inline());
+    EXPECT_EQ(large.get<Table>().size(), 2);
+    
+    AnyValue copy(large);
+    EXPECT_FALSE(copy.is_inline());
+    copy.get<Table>()["c"] = 3;
+    EXPECT_EQ(large.get<Table>().size(), 2);
+}
+
+// インライン格納された文字列のムーブとコピーのテスト
+TEST_F(AnyValueTest, InlineStringMoveAndCopy) {
+    AnyValue original(std::string("a string longer than the small string buffer"));
+    AnyValue copy(original);
+    AnyValue moved(std::move(original));
+    
+    EXPECT_TRUE(original.empty());
+    EXPECT_EQ(moved.get<std::string>(), "a string longer than the small string buffer");
+    EXPECT_EQ(copy.get<std::string>(), moved.get<std::string>());
+    
+    // 自身の値からの再代入
+    moved = moved.get<std::string>();
+    EXPECT_EQ(moved.get<std::string>(), copy.get<std::string>());
+}
+
+// ムーブがnoexceptであり、vectorの再確保でコピーされないことのテスト
+TEST_F(AnyValueTest, NoexceptMove) {
+    EXPECT_TRUE(std::is_nothrow_move_constructible<AnyValue>::value);
+    EXPECT_TRUE(std::is_nothrow_move_assignable<AnyValue>::value);
+    
+    std::vector<AnyValue> values;
+    for (int i = 0; i < 100; ++i) {
+        values.push_back(AnyValue(std::string(40, static_cast<char>('a' + i % 26))));
+    }
+    EXPECT_EQ(values[99].get<std::string>(), std::string(40, static_cast<char>('a' + 99 % 26)));
+}
+
+// try_getが例外を投げずにポインタを返すことのテスト
+TEST_F(AnyValueTest, TryGet) {
+    AnyValue value(42);
+    ASSERT_NE(value.try_get<int>(), nullptr);
+    EXPECT_EQ(*value.try_get<int>(), 42);
+    EXPECT_EQ(value.try_get<double>(), nullptr);
+    EXPECT_EQ(value.try_get<std::string>(), nullptr);
+    
+    // 書き込み可能なポインタ
+    *value.try_get<int>() = 7;
+    EXPECT_EQ(value.get<int>(), 7);
+    
+    const AnyValue empty;
+    EXPECT_EQ(empty.try_get<int>(), nullptr);
+    
+    // ヒープに置かれる型でも同じように取得できる
+    const AnyValue list(std::vector<int>{1, 2, 3});
+    ASSERT_NE(list.try_get<std::vector<int>>(), nullptr);
+    EXPECT_EQ(list.try_get<std::vector<int>>()->size(), 3);
+    EXPECT_EQ(list.try_get<std::vector<long>>(), nullptr);
+}
@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdint>
+#include "../../include/argparse/argparse.hpp"
+
+using namespace argparse;
+
+namespace {
+
+enum class Mode { FAST, SAFE };
+
+const EnumChoice<Mode> MODE_CHOICES[] = {
+    {"fast", Mode::FAST},
+    {"safe", Mode::SAFE},
+};
+
+struct Config {
+    uint16_t port = 80;
+    std::string host = "localhost";
+    bool verbose = false;
+    std::vector<std::string> inputs;
+    std::vector<int> weights;
+    ByteSize buffer;
+    std::chrono::milliseconds timeout{0};
+    Mode mode = Mode::SAFE;
+    int level = 0;
+};
+
+struct OtherConfig {
+    int port = 0;
+};
+
+} // namespace
+
+class BindTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+    }
+    
+    void TearDown() override {
+    }
+};
+
+// 構造体のメンバへ直接書き込むテスト
+TEST_F(BindTest, ParseIntoStruct) {
+    ArgumentParser parser("test");
+    parser.add_argument("--port").bind(&Config::port);
+    parser.add_argument("--host").bind(&Config::host);
+    parser.add_argument("--verbose").action("store_true").bind(&Config::verbose);
+    parser.add_argument("inputs").nargs("+").bind(&Config::inputs);
+    parser.add_argument("--weight").action("append").bind(&Config::weights);
+    parser.add_argument("--buffer").bind(&Config::buffer);
+    parser.add_argument("--timeout").bind(&Config::timeout);
+    parser.add_argument("--mode").choices(MODE_CHOICES).bind(&Config::mode);
+    
+    Config config = parser.parse_into<Config>(std::vector<std::string>{
+        "--port", "8080", "--host", "example.com", "--verbose", "--weight", "3", "--weight=5",
+        "--buffer", "64MiB", "--timeout", "1.5s", "--mode", "fast", "a.txt", "b.txt"});
+    
+    EXPECT_EQ(config.port, 8080);
+    EXPECT_EQ(config.host, "example.com");
+    EXPECT_TRUE(config.verbose);
+    EXPECT_EQ(config.inputs, (std::vector<std::string>{"a.txt", "b.txt"}));
+    EXPECT_EQ(config.weights, (std::vector<int>{3, 5}));
+    EXPECT_EQ(config.buffer.bytes, 64u * 1024 * 1024);
+    EXPECT_EQ(config.timeout, std::chrono::milliseconds(1500));
+    EXPECT_EQ(config.mode, Mode::FAST);
+}
+
+// 既定値・未指定の引数のテスト
+TEST_F(BindTest, DefaultsAndMissingValues) {
+    ArgumentParser parser("test");
+    parser.add_argument("--port").default_value(9000).bind(&Config::port);
+    parser.add_argument("--host").bind(&Config::host);
+    parser.add_argument("--verbose").action("store_true").bind(&Config::verbose);
+    
+    Config config;
+    config.host = "preset";
+    parser.parse_into(std::vector<std::string>{}, config);
+    
+    // int の既定値は範囲内なら uint16_t のメンバへ変換される
+    EXPECT_EQ(config.port, 9000);
+    // 未指定で既定値のない引数はメンバを変更しない
+    EXPECT_EQ(config.host, "preset");
+    EXPECT_FALSE(config.verbose);
+}
+
+// 束縛していない引数は Namespace に残ることのテスト
+TEST_F(BindTest, TryParseIntoKeepsUnboundValues) {
+    ArgumentParser parser("test");
+    parser.add_argument("--port").bind(&Config::port);
+    parser.add_argument("--name");
+    
+    Config config;
+    ParseResult result = parser.try_parse_into(std::vector<std::string>{"--port", "443", "--name", "svc"}, config);
+    ASSERT_TRUE(result.ok());
+    EXPECT_EQ(config.port, 443);
+    EXPECT_EQ(result.values().get<std::string>("name"), "svc");
+    EXPECT_FALSE(result.values().has("port"));
+    
+    ParseResult failed = parser.try_parse_into(std::vector<std::string>{"--port", "http"}, config);
+    EXPECT_FALSE(failed.ok());
+    EXPECT_EQ(failed.status(), ParseStatus::INVALID_VALUE);
+    EXPECT_EQ(config.port, 443);
+}
+
+// 範囲外の値・型の合わないメンバのテスト
+TEST_F(BindTest, RangeAndTypeErrors) {
+    ArgumentParser parser("test");
+    parser.add_argument("--port").bind(&Config::port);
+    EXPECT_THROW(parser.parse_into<Config>(std::vector<std::string>{"--port", "70000"}), std::invalid_argument);
+    
+    // 他の構造体のメンバに束縛した引数
+    EXPECT_THROW(parser.parse_into<OtherConfig>(std::vector<std::string>{"--port", "1"}), std::invalid_argument);
+    
+    // 既定値がメンバの型に収まらない
+    ArgumentParser defaults("test");
+    defaults.add_argument("--port").default_value(-1).bind(&Config::port);
+    EXPECT_THROW(defaults.parse_into<Config>(std::vector<std::string>{}), std::invalid_argument);
+    
+    // try_parse_into は例外ではなく結果として報告する
+    Config config;
+    ParseResult mismatch = defaults.try_parse_into(std::vector<std::string>{}, config);
+    EXPECT_EQ(mismatch.status(), ParseStatus::BINDING_FAILED);
+    EXPECT_EQ(mismatch.argument_name(), "port");
+    EXPECT_EQ(mismatch.message(), "argument --port: parsed value does not match the type of the bound member");
+    
+    OtherConfig other;
+    ParseResult owner = parser.try_parse_into(std::vector<std::string>{"--port", "1"}, other);
+    EXPECT_EQ(owner.status(), ParseStatus::BINDING_FAILED);
+    EXPECT_EQ(owner.message(), "argument --port: bound to a member of another struct type");
+}
+
+// 値が0個の nargs "*" も要素型の空のリストとして書き込まれることのテスト
+TEST_F(BindTest, EmptyListIntoMember) {
+    ArgumentParser parser("test");
+    parser.add_argument("--weights").nargs("*").bind(&Config::weights).choices(std::vector<int>{1, 2, 3});
+    parser.add_argument("--inputs").nargs("*").bind(&Config::inputs);
+    
+    Config config;
+    config.weights = {9};
+    config.inputs = {"stale"};
+    parser.parse_into(std::vector<std::string>{"--weights", "--inputs"}, config);
+    EXPECT_TRUE(config.weights.empty());
+    EXPECT_TRUE(config.inputs.empty());
+    
+    config.weights = {9};
+    ParseResult result = parser.try_parse_into(std::vector<std::string>{"--weights"}, config);
+    EXPECT_TRUE(result.ok()) << result.message();
+    EXPECT_TRUE(config.weights.empty());
+}
+
+// 遅延変換モード・CompiledParser のテスト
+TEST_F(BindTest, LazyModeAndCompiledParser) {
+    ArgumentParser parser("test");
+    parser.add_argument("--level").type<int>().bind(&Config::level);
+    parser.add_argument("--host").bind(&Config::host);
+    parser.lazy_conversion();
+    
+    CompiledParser compiled = parser.compile();
+    for (int i = 0; i < 3; ++i) {
+        Config config = compiled.parse_into<Config>(std::vector<std::string>{"--level", std::to_string(i), "--host", "h"});
+        EXPECT_EQ(config.level, i);
+        EXPECT_EQ(config.host, "h");
+    }
+    EXPECT_THROW(compiled.parse_into<Config>(std::vector<std::string>{"--level", "x"}), std::invalid_argument);
+}
@@ -153,4 +153,183 @@ TEST_F(ChoicesTest, DetailedErrorMessage) {
         EXPECT_NE(error_msg.find("'medium'"), std::string::npos);
         EXPECT_NE(error_msg.find("'high'"), std::string::npos);
     }
-}
\ No newline at end of file
+}
+
+namespace {
+
+// 順序付け可能だがハッシュできない型
+struct Version {
+    int major;
+    int minor;
+    
+    bool operator<(const Version& other) const {
+        return major != other.major ? major < other.major : minor < other.minor;
+    }
+};
+
+// 等値比較だけができる型
+struct Tag {
+    std::string name;
+    
+    bool operator==(const Tag& other) const { return name == other.name; }
+};
+
+enum class Style { SIMPLE, FANCY, CAPS };
+
+const EnumChoice<Style> STYLE_CHOICES[] = {
+    {"simple", Style::SIMPLE},
+    {"fancy", Style::FANCY},
+    {"caps", Style::CAPS},
+};
+
+} // namespace
+
+// 数千個の選択肢での検証のテスト
+TEST_F(ChoicesTest, LargeChoiceList) {
+    std::vector<std::string> regions;
+    for (int i = 0; i < 5000; ++i) {
+        regions.push_back("region-" + std::to_string(i));
+    }
+    
+    ArgumentParser parser("test_program");
+    parser.add_argument("--region").choices(regions);
+    
+    auto ns = parser.parse_args(std::vector<std::string>{"--region", "region-4999"});
+    EXPECT_EQ(ns.get<std::string>("region"), "region-4999");
+    
+    ParseResult result = parser.try_parse_args(std::vector<std::string>{"--region", "region-5000"});
+    EXPECT_EQ(result.status(), ParseStatus::INVALID_CHOICE);
+    EXPECT_NE(result.message().find("invalid choice: 'region-5000'"), std::string::npos);
+    EXPECT_NE(result.message().find("'region-0', 'region-1'"), std::string::npos);
+}
+
+// ハッシュできない型・等値比較だけの型の選択肢のテスト
+TEST_F(ChoicesTest, OrderedAndEqualityOnlyChoices) {
+    Argument version_arg("--version");
+    version_arg.choices(std::vector<Version>{{2, 0}, {1, 4}, {1, 2}});
+    EXPECT_TRUE(version_arg.validate_value(detail::AnyValue(Version{1, 4})));
+    EXPECT_FALSE(version_arg.validate_value(detail::AnyValue(Version{1, 3})));
+    
+    // 表示できない型は "?" として列挙される
+    std::string message = version_arg.get_validation_error_message(detail::AnyValue(Version{3, 0}));
+    EXPECT_EQ(message, "invalid choice: (value) (choose from '?', '?', '?')");
+    
+    Argument tag_arg("--tag");
+    tag_arg.choices(std::vector<Tag>{{"alpha"}, {"beta"}});
+    EXPECT_TRUE(tag_arg.validate_value(detail::AnyValue(Tag{"beta"})));
+    EXPECT_FALSE(tag_arg.validate_value(detail::AnyValue(Tag{"gamma"})));
+}
+
+// 型の異なる値は選択肢に含まれないことのテスト
+TEST_F(ChoicesTest, MismatchedTypeIsNotAChoice) {
+    Argument arg("--size");
+    arg.choices(std::vector<long>{1, 2, 3});
+    EXPECT_TRUE(arg.validate_value(detail::AnyValue(2L)));
+    EXPECT_FALSE(arg.validate_value(detail::AnyValue(2)));
+    EXPECT_EQ(arg.get_validation_error_message(detail::AnyValue(7L)),
+              "invalid choice: '7' (choose from '1', '2', '3')");
+}
+
+// 名前 → 列挙値の表による選択肢のテスト
+TEST_F(ChoicesTest, EnumChoicesStoreEnumValue) {
+    ArgumentParser parser("test");
+    parser.add_argument("--style").choices(STYLE_CHOICES).default_value(Style::SIMPLE);
+    parser.add_argument("--extra").choices(STYLE_CHOICES).action("append");
+    
+    auto args = parser.parse_args(std::vector<std::string>{"--style", "caps", "--extra", "fancy", "--extra=simple"});
+    EXPECT_EQ(args.get<Style>("style"), Style::CAPS);
+    EXPECT_EQ(args.get<std::vector<Style>>("extra"), (std::vector<Style>{Style::FANCY, Style::SIMPLE}));
+    
+    auto defaults = parser.parse_args(std::vector<std::string>{});
+    EXPECT_EQ(defaults.get<Style>("style"), Style::SIMPLE);
+}
+
+// 未知の名前は選択肢の名前を列挙したエラーになることのテスト
+TEST_F(ChoicesTest, EnumChoicesInvalidName) {
+    ArgumentParser parser("test");
+    parser.add_argument("--style").choices(STYLE_CHOICES);
+    
+    ParseResult result = parser.try_parse_args(std::vector<std::string>{"--style", "Fancy"});
+    ASSERT_FALSE(result.ok());
+    EXPECT_EQ(result.status(), ParseStatus::INVALID_CHOICE);
+    EXPECT_NE(result.message().find("invalid choice: 'Fancy' (choose from 'simple', 'fancy', 'caps')"),
+              std::string::npos);
+    
+    Argument arg("--style");
+    arg.choices(STYLE_CHOICES);
+    EXPECT_TRUE(arg.validate_value(detail::AnyValue(Style::CAPS)));
+    EXPECT_FALSE(arg.validate_value(detail::AnyValue(static_cast<Style>(7))));
+    EXPECT_FALSE(arg.validate_value(detail::AnyValue(std::string("caps"))));
+}
+
+// ヘルプに選択肢の名前が表示されることのテスト
+TEST_F(ChoicesTest, ChoicesShownInHelp) {
+    ArgumentParser parser("test");
+    parser.add_argument("--style").choices(STYLE_CHOICES).help("Output style");
+    parser.add_argument("mode").choices(std::vector<std::string>{"fast", "slow"});
+    parser.add_argument("--level").choices(STYLE_CHOICES).metavar("LEVEL");
+    
+    std::string help;
+    try {
+        parser.parse_args(std::vector<std::string>{"--help"});
+        FAIL() << "Should have thrown help_requested exception";
+    } catch (const help_requested& e) {
+        help = e.message();
+    }
+    EXPECT_NE(help.find("[--style {simple,fancy,caps}]"), std::string::npos);
+    EXPECT_NE(help.find("--style {simple,fancy,caps}"), std::string::npos);
+    EXPECT_NE(help.find(" {fast,slow}"), std::string::npos);
+    EXPECT_NE(help.find("[--level LEVEL]"), std::string::npos);
+}
+
+// 選択肢が多い・長い場合はヘルプに一覧を展開せず通常のmetavarを使うことのテスト
+TEST_F(ChoicesTest, LargeChoicesUsePlainMetavarInHelp) {
+    std::vector<std::string> regions;
+    for (int i = 0; i < 5000; ++i) {
+        regions.push_back("region-" + std::to_string(i));
+    }
+    ArgumentParser parser("test");
+    parser.add_argument("--region").choices(regions).help("Deployment region");
+    parser.add_argument("zone").choices(std::vector<std::string>{
+        "north-america-east", "north-america-west", "europe-central", "asia-pacific-south"});
+    
+    std::string help;
+    try {
+        parser.parse_args(std::vector<std::string>{"--help"});
+        FAIL() << "Should have thrown help_requested exception";
+    } catch (const help_requested& e) {
+        help = e.message();
+    }
+    EXPECT_NE(help.find("[--region REGION]"), std::string::npos) << help;
+    EXPECT_NE(help.find("--region REGION     Deployment region"), std::string::npos);
+    EXPECT_NE(help.find(" zone"), std::string::npos);
+    EXPECT_EQ(help.find("region-4999"), std::string::npos);
+    EXPECT_EQ(help.find("{north-america-east"), std::string::npos);
+    EXPECT_LT(help.find('\n'), 80u);
+}
+
+// 浮動小数点数・bool の選択肢がヘルプに簡潔な形で表示されることのテスト
+TEST_F(ChoicesTest, FloatingAndBoolChoicesShownCompactly) {
+    ArgumentParser parser("test");
+    parser.add_argument("--ratio").type<double>().choices(std::vector<double>{0.5, 1.25});
+    parser.add_argument("--flag").type<bool>().choices(std::vector<bool>{true, false});
+    
+    std::string help;
+    try {
+        parser.parse_args(std::vector<std::string>{"--help"});
+        FAIL() << "Should have thrown help_requested exception";
+    } catch (const help_requested& e) {
+        help = e.message();
+    }
+    EXPECT_NE(help.find("[--ratio {0.5,1.25}]"), std::string::npos) << help;
+    EXPECT_NE(help.find("--ratio {0.5,1.25}\n"), std::string::npos) << help;
+    EXPECT_NE(help.find("[--flag {true,false}]"), std::string::npos) << help;
+    EXPECT_EQ(help.find("0.500000"), std::string::npos);
+    EXPECT_EQ(help.find(" \n"), std::string::npos) << help;
+    
+    Argument arg("--ratio");
+    arg.choices(std::vector<double>{0.5, 1.25});
+    std::string error_msg = arg.get_validation_error_message(detail::AnyValue(2.0));
+    EXPECT_NE(error_msg.find("'0.5'"), std::string::npos) << error_msg;
+    EXPECT_NE(error_msg.find("'1.25'"), std::string::npos) << error_msg;
+}
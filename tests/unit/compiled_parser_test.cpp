@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include "../../include/argparse/argparse.hpp"
+
+class CompiledParserTest : public ::testing::Test {
+protected:
+    argparse::ArgumentParser parser;
+
+    void SetUp() override {
+        parser = argparse::ArgumentParser("test_prog", "Test program");
+    }
+};
+
+// compile() した結果で繰り返し解析できることのテスト
+TEST_F(CompiledParserTest, ReuseAcrossParses) {
+    parser.add_argument("input");
+    parser.add_argument("--count", "-c").type<int>().default_value(1);
+    parser.add_argument("--verbose", "-v").action("store_true");
+
+    argparse::CompiledParser compiled = parser.compile();
+
+    auto ns1 = compiled.parse_args(std::vector<std::string>{"a.txt", "-c", "3", "-v"});
+    EXPECT_EQ(ns1.get<std::string>("input"), "a.txt");
+    EXPECT_EQ(ns1.get<int>("count"), 3);
+    EXPECT_TRUE(ns1.get<bool>("verbose"));
+
+    // 前回の解析状態が残らないこと
+    auto ns2 = compiled.parse_args(std::vector<std::string>{"b.txt"});
+    EXPECT_EQ(ns2.get<std::string>("input"), "b.txt");
+    EXPECT_EQ(ns2.get<int>("count"), 1);
+    EXPECT_FALSE(ns2.get<bool>("verbose"));
+}
+
+// 解析計画の内容（保存キー、位置引数の順序、オプション検索）のテスト
+TEST_F(CompiledParserTest, PlanContents) {
+    parser.add_argument("source");
+    parser.add_argument("-o", "--output");
+    parser.add_argument("-q");
+    parser.add_argument("dest");
+
+    argparse::CompiledParser compiled = parser.compile();
+    const argparse::detail::ParsePlan& plan = compiled.plan();
+
+    ASSERT_EQ(plan.positional_count(), 2);
+    EXPECT_EQ(plan.positional(0).key, "source");
+    EXPECT_EQ(plan.positional(1).key, "dest");
+
+    const argparse::detail::ArgumentSpec* output = plan.find_option("-o");
+    ASSERT_NE(output, nullptr);
+    EXPECT_EQ(output, plan.find_option("--output"));
+    EXPECT_EQ(output->key, "output");
+
+    const argparse::detail::ArgumentSpec* quiet = plan.find_option("-q");
+    ASSERT_NE(quiet, nullptr);
+    EXPECT_EQ(quiet->key, "q");
+
+    EXPECT_EQ(plan.find_option("--missing"), nullptr);
+}
+
+// parse_argsが解析計画をキャッシュして再利用することのテスト
+TEST_F(CompiledParserTest, ParseArgsCachesPlan) {
+    parser.add_argument("--name");
+
+    const argparse::detail::ParsePlan* first = &parser.compile().plan();
+    parser.parse_args(std::vector<std::string>{"--name", "x"});
+    EXPECT_EQ(first, &parser.compile().plan());
+}
+
+// 引数追加後は新しい解析計画が構築されることのテスト
+TEST_F(CompiledParserTest, AddArgumentInvalidatesPlan) {
+    parser.add_argument("--name");
+    argparse::CompiledParser before = parser.compile();
+
+    parser.add_argument("--extra");
+    auto ns = parser.parse_args(std::vector<std::string>{"--extra", "1"});
+    EXPECT_EQ(ns.get<std::string>("extra"), "1");
+
+    // 凍結済みのパーサーは追加前の定義のまま
+    EXPECT_THROW(before.parse_args(std::vector<std::string>{"--extra", "1"}), std::runtime_error);
+
+    // グループ経由の追加でも破棄される
+    auto& group = parser.add_argument_group("extra options");
+    group.add_argument("--grouped");
+    auto ns2 = parser.parse_args(std::vector<std::string>{"--grouped", "g"});
+    EXPECT_EQ(ns2.get<std::string>("grouped"), "g");
+}
+
+// ヘルプとエラー処理がArgumentParser::parse_argsと同じであることのテスト
+TEST_F(CompiledParserTest, HelpAndErrors) {
+    parser.add_argument("--count").type<int>();
+    argparse::CompiledParser compiled = parser.compile();
+
+    try {
+        compiled.parse_args(std::vector<std::string>{"--help"});
+        FAIL() << "help_requested was not thrown";
+    } catch (const argparse::help_requested& e) {
+        EXPECT_NE(std::string(e.what()).find("usage: test_prog"), std::string::npos);
+    }
+
+    EXPECT_THROW(compiled.parse_args(std::vector<std::string>{"--unknown"}), std::runtime_error);
+    EXPECT_THROW(compiled.parse_args(std::vector<std::string>{"--count", "abc"}), std::invalid_argument);
+}
@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include "../../include/argparse/argparse.hpp"
+
+using namespace argparse;
+
+namespace {
+
+// 報告された内容を記録するだけの出力先
+class RecordingOutput : public ParseOutput {
+public:
+    std::vector<std::string> helps;
+    std::vector<std::string> errors;
+    std::vector<ParseStatus> statuses;
+    
+    void help(const std::string& text) override {
+        helps.push_back(text);
+    }
+    
+    void error(ParseStatus status, const std::string& message) override {
+        statuses.push_back(status);
+        errors.push_back(message);
+    }
+};
+
+void add_server_arguments(ArgumentParser& parser) {
+    parser.add_argument("--port").type<int>().default_value(8080);
+    parser.add_argument("--mode").choices(std::vector<std::string>{"read", "write"});
+    parser.add_argument("--tag").action("append");
+    parser.add_argument("-v", "--verbose").action("count");
+    parser.add_argument("paths").nargs("+");
+}
+
+} // namespace
+
+class ConcurrentParseTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+    }
+    
+    void TearDown() override {
+    }
+};
+
+// ヘルプ・エラーが出力先に報告され、プロセスは終了しないことのテスト
+TEST_F(ConcurrentParseTest, OutputReceivesHelpAndErrors) {
+    ArgumentParser parser("server", "Request server");
+    add_server_arguments(parser);
+    const ArgumentParser& shared = parser;
+    RecordingOutput output;
+    
+    ParseResult ok = shared.parse_args(std::vector<std::string>{"--port", "9000", "a"}, output);
+    ASSERT_TRUE(ok.ok());
+    EXPECT_EQ(ok.values().get<int>("port"), 9000);
+    EXPECT_TRUE(output.helps.empty());
+    EXPECT_TRUE(output.errors.empty());
+    
+    ParseResult help = shared.parse_args(std::vector<std::string>{"--help"}, output);
+    EXPECT_EQ(help.status(), ParseStatus::HELP_REQUESTED);
+    ASSERT_EQ(output.helps.size(), 1u);
+    EXPECT_NE(output.helps[0].find("Request server"), std::string::npos);
+    
+    ParseResult bad = shared.parse_args(std::vector<std::string>{"--mode", "delete", "a"}, output);
+    EXPECT_EQ(bad.status(), ParseStatus::INVALID_CHOICE);
+    ASSERT_EQ(output.errors.size(), 1u);
+    EXPECT_EQ(output.statuses[0], ParseStatus::INVALID_CHOICE);
+    EXPECT_EQ(output.errors[0], bad.message_with_usage());
+    EXPECT_NE(output.errors[0].find("usage: server"), std::string::npos);
+    
+    // 実行時エラー（値の不足）も例外ではなく出力先に報告される
+    ParseResult missing = shared.parse_args(std::vector<std::string>{"a", "--port"}, output);
+    EXPECT_EQ(missing.status(), ParseStatus::MISSING_VALUE);
+    EXPECT_EQ(output.errors.size(), 2u);
+}
+
+// argv[0] はプログラム名として使われず、パーサーは変更されないことのテスト
+TEST_F(ConcurrentParseTest, ArgvDoesNotChangeProgramName) {
+    ArgumentParser parser;
+    add_server_arguments(parser);
+    RecordingOutput output;
+    
+    char* argv[] = {const_cast<char*>("/usr/bin/tool"), const_cast<char*>("--mode"), const_cast<char*>("x"),
+                    const_cast<char*>("a")};
+    ParseResult result = static_cast<const ArgumentParser&>(parser).parse_args(4, argv, output);
+    EXPECT_EQ(result.status(), ParseStatus::INVALID_CHOICE);
+    EXPECT_EQ(parser.prog(), "program");
+    ASSERT_EQ(output.errors.size(), 1u);
+    EXPECT_NE(output.errors[0].find("usage: program"), std::string::npos);
+}
+
+// 16スレッドから同じパーサーで同時に解析するテスト（計画の初回構築も競合させる）
+TEST_F(ConcurrentParseTest, SixteenThreadsShareOneParser) {
+    ArgumentParser parser("server", "Request server");
+    add_server_arguments(parser);
+    const ArgumentParser& shared = parser;
+    
+    const int thread_count = 16;
+    const int iterations = 300;
+    std::atomic<int> mismatches(0);
+    std::atomic<bool> start(false);
+    
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&, t]() {
+            while (!start.load()) {
+                std::this_thread::yield();
+            }
+            RecordingOutput output;
+            for (int i = 0; i < iterations; ++i) {
+                int port = t * 1000 + i;
+                std::vector<std::string> args = {"--port", std::to_string(port), "-vv", "--tag", "t" + std::to_string(t),
+                                                 "path" + std::to_string(i)};
+                switch (i % 4) {
+                    case 0:
+                    case 1: {
+                        ParseResult result = shared.parse_args(args, output);
+                        if (!result.ok() || result.values().get<int>("port") != port ||
+                            result.values().get<int>("verbose") != 2 ||
+                            result.values().get<std::vector<std::string>>("tag") !=
+                                std::vector<std::string>{"t" + std::to_string(t)}) {
+                            ++mismatches;
+                        }
+                        break;
+                    }
+                    case 2: {
+                        args[1] = "port" + std::to_string(t);
+                        ParseResult result = shared.parse_args(args, output);
+                        if (result.status() != ParseStatus::INVALID_VALUE ||
+                            output.errors.back().find("'port" + std::to_string(t) + "'") == std::string::npos) {
+                            ++mismatches;
+                        }
+                        break;
+                    }
+                    default: {
+                        ParseResult result = shared.parse_args(std::vector<std::string>{"-h"}, output);
+                        if (result.status() != ParseStatus::HELP_REQUESTED ||
+                            output.helps.back().find("usage: server") == std::string::npos) {
+                            ++mismatches;
+                        }
+                        break;
+                    }
+                }
+            }
+            if (output.errors.size() != static_cast<size_t>(iterations / 4) ||
+                output.helps.size() != static_cast<size_t>(iterations / 4)) {
+                ++mismatches;
+            }
+        });
+    }
+    start.store(true);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    
+    EXPECT_EQ(mismatches.load(), 0);
+    EXPECT_EQ(parser.prog(), "server");
+}
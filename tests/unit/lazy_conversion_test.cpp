@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+#include "../../include/argparse/argparse.hpp"
+
+class LazyConversionTest : public ::testing::Test {
+protected:
+    argparse::ArgumentParser parser;
+
+    void SetUp() override {
+        parser = argparse::ArgumentParser("test_prog", "Test program");
+        parser.lazy_conversion();
+    }
+};
+
+// 値が参照時に変換されてキャッシュされることのテスト
+TEST_F(LazyConversionTest, ConvertsOnFirstAccess) {
+    parser.add_argument("input").type<double>();
+    parser.add_argument("--count", "-c").type<int>();
+    parser.add_argument("--name");
+
+    auto ns = parser.parse_args(std::vector<std::string>{"2.5", "-c", "7", "--name", "x"});
+    EXPECT_TRUE(ns.is_pending("count"));
+    EXPECT_TRUE(ns.is_pending("input"));
+    EXPECT_TRUE(ns.has("count"));
+
+    EXPECT_EQ(ns.get<int>("count"), 7);
+    EXPECT_FALSE(ns.is_pending("count"));
+    EXPECT_EQ(ns.get<int>("count"), 7);
+    EXPECT_EQ(ns.get<double>("input"), 2.5);
+    EXPECT_EQ(ns.get<std::string>("name"), "x");
+}
+
+// 既定値が参照されるまで複写されないことのテスト
+TEST_F(LazyConversionTest, DefaultsAreDeferred) {
+    parser.add_argument("--level").type<int>().default_value(3);
+    parser.add_argument("--mode").default_value(std::string("fast"));
+    parser.add_argument("--flag").action("store_true");
+
+    auto ns = parser.parse_args(std::vector<std::string>{"--mode", "slow"});
+    EXPECT_TRUE(ns.has("level"));
+    EXPECT_TRUE(ns.is_pending("level"));
+    EXPECT_EQ(ns.get<int>("level"), 3);
+    EXPECT_EQ(ns.get<std::string>("mode"), "slow");
+    EXPECT_FALSE(ns.get<bool>("flag"));
+    EXPECT_EQ(ns.size(), 3u);
+}
+
+// 変換エラーと選択肢の違反が参照時とvalidate()で報告されることのテスト
+TEST_F(LazyConversionTest, ErrorsSurfaceOnAccessAndValidate) {
+    parser.add_argument("--count").type<int>();
+    parser.add_argument("--mode").choices(std::vector<std::string>{"fast", "slow"});
+    parser.add_argument("--unused").type<int>();
+
+    // 解析自体は成功する
+    argparse::ParseResult result = parser.try_parse_args(
+        std::vector<std::string>{"--count", "abc", "--mode", "medium", "--unused", "1"});
+    ASSERT_TRUE(result.ok());
+    const argparse::Namespace& ns = result.values();
+
+    try {
+        ns.validate();
+        FAIL() << "validate() accepted an invalid value";
+    } catch (const std::invalid_argument& e) {
+        EXPECT_EQ(std::string(e.what()), "argument --count: invalid int value: 'abc'");
+    }
+    EXPECT_THROW(ns.get<int>("count"), std::invalid_argument);
+    EXPECT_TRUE(ns.is_pending("count"));
+
+    try {
+        ns.get<std::string>("mode");
+        FAIL() << "invalid choice was accepted";
+    } catch (const std::invalid_argument& e) {
+        EXPECT_NE(std::string(e.what()).find("invalid choice: 'medium'"), std::string::npos);
+    }
+    EXPECT_EQ(ns.get<int>("unused"), 1);
+}
+
+// 遅延変換モードでも蓄積系アクションと必須チェックは従来どおり動くことのテスト
+TEST_F(LazyConversionTest, OtherActionsAreUnchanged) {
+    parser.add_argument("--tag").action("append");
+    parser.add_argument("--verbose", "-v").action("count");
+    parser.add_argument("--sizes").type<int>().nargs("+");
+    parser.add_argument("--required").required(true);
+
+    auto ns = parser.parse_args(std::vector<std::string>{
+        "--tag", "a", "--tag", "b", "-v", "-v", "--sizes", "1", "2", "--required", "r"});
+    EXPECT_EQ(ns.get<std::vector<std::string>>("tag"), std::vector<std::string>({"a", "b"}));
+    EXPECT_EQ(ns.get<int>("verbose"), 2);
+    EXPECT_EQ(ns.get<std::vector<int>>("sizes"), std::vector<int>({1, 2}));
+
+    EXPECT_THROW(parser.parse_args(std::vector<std::string>{}), std::runtime_error);
+}
+
+// 遅延変換のNamespaceをコピーしても独立して変換されることのテスト
+TEST_F(LazyConversionTest, CopiesConvertIndependently) {
+    parser.add_argument("--count").type<int>();
+    auto ns = parser.parse_args(std::vector<std::string>{"--count", "4"});
+
+    argparse::Namespace copy = ns;
+    EXPECT_EQ(copy.get<int>("count"), 4);
+    EXPECT_TRUE(ns.is_pending("count"));
+    EXPECT_FALSE(copy.is_pending("count"));
+}
+
+// resolve()の後は未変換の値も遅延された既定値も残らないことのテスト
+TEST_F(LazyConversionTest, ResolveConvertsEverything) {
+    parser.add_argument("--count").type<int>();
+    parser.add_argument("--level").type<int>().default_value(3);
+    auto ns = parser.parse_args(std::vector<std::string>{"--count", "4"});
+
+    ns.resolve();
+    EXPECT_FALSE(ns.is_pending("count"));
+    EXPECT_FALSE(ns.is_pending("level"));
+    EXPECT_EQ(ns.get<int>("count"), 4);
+    EXPECT_EQ(ns.get<int>("level"), 3);
+
+    auto invalid = parser.parse_args(std::vector<std::string>{"--count", "x"});
+    EXPECT_THROW(invalid.resolve(), std::invalid_argument);
+    EXPECT_TRUE(invalid.is_pending("count"));
+}
+
+// 既定は従来どおり即時変換であることのテスト
+TEST(LazyConversionModeTest, DisabledByDefault) {
+    argparse::ArgumentParser parser("test_prog");
+    EXPECT_FALSE(parser.lazy_conversion_enabled());
+    parser.add_argument("--count").type<int>();
+    EXPECT_THROW(parser.parse_args(std::vector<std::string>{"--count", "abc"}), std::invalid_argument);
+
+    parser.lazy_conversion();
+    EXPECT_TRUE(parser.compile().plan().lazy());
+    EXPECT_NO_THROW(parser.parse_args(std::vector<std::string>{"--count", "abc"}));
+}
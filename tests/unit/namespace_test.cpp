@@ -187,4 +187,94 @@ TEST_F(NamespaceTest, RawValueAccess) {
     argparse::detail::AnyValue move_value(777);
     ns.set_raw("move_raw_value", std::move(move_value));
     EXPECT_EQ(ns.get<int>("move_raw_value"), 777);
-}
\ No newline at end of file
+}
+// スキーマ付きNamespaceのスロットアクセスのテスト
+TEST(SlotNamespaceTest, SlotAccess) {
+    auto schema = std::make_shared<argparse::detail::NamespaceSchema>(
+        std::vector<std::string>{"port", "host", "verbose"});
+    argparse::Namespace slotted(schema);
+    
+    EXPECT_TRUE(slotted.empty());
+    EXPECT_EQ(slotted.slot_count(), 3);
+    
+    size_t port = slotted.slot("port");
+    ASSERT_EQ(port, 0);
+    EXPECT_EQ(slotted.slot("missing"), argparse::Namespace::npos);
+    
+    // スロット経由の書き込みは名前経由で読める
+    slotted.set_slot(port, 8080);
+    EXPECT_TRUE(slotted.has("port"));
+    EXPECT_EQ(slotted.get<int>("port"), 8080);
+    EXPECT_EQ(slotted.get_slot<int>(port), 8080);
+    
+    // 名前経由の書き込みはスロットに入る
+    slotted.set("host", std::string("localhost"));
+    EXPECT_TRUE(slotted.has_slot(slotted.slot("host")));
+    EXPECT_FALSE(slotted.has_slot(slotted.slot("verbose")));
+    EXPECT_THROW(slotted.get_slot<bool>(slotted.slot("verbose")), std::runtime_error);
+    
+    // スキーマ外のキーも扱える
+    slotted.set("extra", 1.5);
+    EXPECT_DOUBLE_EQ(slotted.get<double>("extra"), 1.5);
+    EXPECT_EQ(slotted.size(), 3);
+    
+    std::vector<std::string> keys = slotted.keys();
+    ASSERT_EQ(keys.size(), 3);
+    EXPECT_EQ(keys[0], "port");
+    EXPECT_EQ(keys[1], "host");
+    EXPECT_EQ(keys[2], "extra");
+}
+
+// スキーマ付きNamespaceの削除・クリア・コピーのテスト
+TEST(SlotNamespaceTest, RemoveClearCopy) {
+    auto schema = std::make_shared<argparse::detail::NamespaceSchema>(std::vector<std::string>{"a", "b"});
+    argparse::Namespace slotted(schema);
+    slotted.set("a", 1);
+    slotted.set("b", 2);
+    
+    argparse::Namespace copy = slotted;
+    EXPECT_TRUE(slotted.remove("a"));
+    EXPECT_FALSE(slotted.remove("a"));
+    EXPECT_FALSE(slotted.has("a"));
+    EXPECT_EQ(slotted.size(), 1);
+    
+    // コピーは独立している
+    EXPECT_EQ(copy.get<int>("a"), 1);
+    EXPECT_EQ(copy.size(), 2);
+    
+    argparse::Namespace moved = std::move(copy);
+    EXPECT_EQ(moved.get<int>("b"), 2);
+    
+    moved.clear();
+    EXPECT_TRUE(moved.empty());
+    EXPECT_FALSE(moved.has("b"));
+}
+
+// パーサーが返すNamespaceはスロットで読めることのテスト
+TEST(SlotNamespaceTest, ParserResultSlots) {
+    argparse::ArgumentParser parser("test_prog");
+    parser.add_argument("--port").type<int>().default_value(80);
+    parser.add_argument("-v", "--verbose").action("store_true");
+    
+    argparse::CompiledParser compiled = parser.compile();
+    size_t port = compiled.slot("port");
+    size_t verbose = compiled.slot("verbose");
+    ASSERT_NE(port, argparse::Namespace::npos);
+    ASSERT_NE(verbose, argparse::Namespace::npos);
+    
+    auto result = compiled.parse_args(std::vector<std::string>{"--port", "8080"});
+    EXPECT_EQ(result.get_slot<int>(port), 8080);
+    EXPECT_FALSE(result.get_slot<bool>(verbose));
+    EXPECT_EQ(result.get<int>("port"), 8080);
+}
+
+// Namespace::try_getのテスト
+TEST_F(NamespaceTest, TryGet) {
+    ns.set("count", 3);
+    
+    const int* count = ns.try_get<int>("count");
+    ASSERT_NE(count, nullptr);
+    EXPECT_EQ(*count, 3);
+    EXPECT_EQ(ns.try_get<std::string>("count"), nullptr);
+    EXPECT_EQ(ns.try_get<int>("missing"), nullptr);
+}
@@ -18,11 +18,11 @@ TEST_F(NargsTest, FixedNumberNargsTest) {
     
     auto ns = parser.parse_args(args);
     
-    auto coords = ns.get<std::vector<std::string>>("coords");
+    auto coords = ns.get<std::vector<int>>("coords");
     EXPECT_EQ(coords.size(), 3);
-    EXPECT_EQ(coords[0], "1");
-    EXPECT_EQ(coords[1], "2");
-    EXPECT_EQ(coords[2], "3");
+    EXPECT_EQ(coords[0], 1);
+    EXPECT_EQ(coords[1], 2);
+    EXPECT_EQ(coords[2], 3);
 }
 
 // Test fixed number nargs error
@@ -198,11 +198,80 @@ TEST_F(NargsTest, NargsTypeConversionTest) {
     
     auto ns = parser.parse_args(args);
     
-    auto numbers = ns.get<std::vector<std::string>>("numbers");
+    // 複数値は type<T>() に合わせた std::vector<T> として格納される
+    auto numbers = ns.get<std::vector<int>>("numbers");
     EXPECT_EQ(numbers.size(), 3);
-    // Note: In our implementation, nargs results are stored as string vectors
-    // Type conversion would need additional handling for vector types
-    EXPECT_EQ(numbers[0], "1");
-    EXPECT_EQ(numbers[1], "2");
-    EXPECT_EQ(numbers[2], "3");
-}
\ No newline at end of file
+    EXPECT_EQ(numbers[0], 1);
+    EXPECT_EQ(numbers[1], 2);
+    EXPECT_EQ(numbers[2], 3);
+}
+
+// Test typed "+" / "*" / positional lists
+TEST_F(NargsTest, TypedListNargsTest) {
+    parser.add_argument("weights").type<double>().nargs("+");
+    parser.add_argument("--flags").type<bool>().nargs("*");
+    parser.add_argument("--ids").type<uint16_t>().nargs("*");
+    
+    auto ns = parser.parse_args(std::vector<std::string>{"0.5", "1e3", "2", "--flags", "yes", "off", "--ids"});
+    
+    const auto& weights = ns.get<std::vector<double>>("weights");
+    ASSERT_EQ(weights.size(), 3);
+    EXPECT_EQ(weights[0], 0.5);
+    EXPECT_EQ(weights[1], 1000.0);
+    EXPECT_EQ(weights[2], 2.0);
+    
+    EXPECT_EQ(ns.get<std::vector<bool>>("flags"), std::vector<bool>({true, false}));
+    EXPECT_TRUE(ns.get<std::vector<uint16_t>>("ids").empty());
+}
+
+// Test conversion errors and choices within typed lists
+TEST_F(NargsTest, TypedListNargsErrorTest) {
+    parser.add_argument("--sizes").type<int>().nargs("+");
+    parser.add_argument("--levels").type<int>().nargs(2).choices(std::vector<int>{1, 2, 3});
+    
+    argparse::ParseResult bad = parser.try_parse_args(std::vector<std::string>{"--sizes", "1", "x", "3"});
+    EXPECT_EQ(bad.status(), argparse::ParseStatus::INVALID_VALUE);
+    EXPECT_NE(bad.message().find("invalid int value: 'x'"), std::string::npos);
+    
+    argparse::ParseResult choice = parser.try_parse_args(std::vector<std::string>{"--levels", "1", "4"});
+    EXPECT_EQ(choice.status(), argparse::ParseStatus::INVALID_CHOICE);
+    
+    auto ns = parser.parse_args(std::vector<std::string>{"--levels", "3", "2"});
+    EXPECT_EQ(ns.get<std::vector<int>>("levels"), std::vector<int>({3, 2}));
+}
+
+// Test custom converters with multi-value nargs
+TEST_F(NargsTest, CustomConverterListNargsTest) {
+    parser.add_argument("--lengths").nargs("+").converter<size_t>([](const std::string& value) {
+        return value.size();
+    });
+    
+    auto ns = parser.parse_args(std::vector<std::string>{"--lengths", "a", "abc"});
+    EXPECT_EQ(ns.get<std::vector<size_t>>("lengths"), std::vector<size_t>({1, 3}));
+}
+enum class Level { LOW, HIGH };
+
+const argparse::EnumChoice<Level> LEVEL_CHOICES[] = {
+    {"low", Level::LOW},
+    {"high", Level::HIGH},
+};
+
+// Test that an empty "*" list keeps the element type when values are converted one by one
+TEST_F(NargsTest, EmptyListKeepsElementType) {
+    parser.add_argument("--xs").type<int>().nargs("*").choices(std::vector<int>{1, 2});
+    parser.add_argument("--lengths").nargs("*").converter<size_t>([](const std::string& value) {
+        return value.size();
+    });
+    parser.add_argument("--levels").nargs("*").choices(LEVEL_CHOICES);
+    parser.add_argument("--names").nargs("*");
+    
+    auto ns = parser.parse_args(std::vector<std::string>{"--xs", "--lengths", "--levels", "--names"});
+    EXPECT_TRUE(ns.get<std::vector<int>>("xs").empty());
+    EXPECT_TRUE(ns.get<std::vector<size_t>>("lengths").empty());
+    EXPECT_TRUE(ns.get<std::vector<Level>>("levels").empty());
+    EXPECT_TRUE(ns.get<std::vector<std::string>>("names").empty());
+    
+    ns = parser.parse_args(std::vector<std::string>{"--xs", "1", "--levels", "high"});
+    EXPECT_EQ(ns.get<std::vector<int>>("xs"), std::vector<int>({1}));
+    EXPECT_EQ(ns.get<std::vector<Level>>("levels"), std::vector<Level>({Level::HIGH}));
+}
@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+#include "../../include/argparse/argparse.hpp"
+
+#include <string>
+#include <vector>
+
+using argparse::detail::OptionTable;
+using argparse::detail::StringView;
+
+// 基本的な検索のテスト
+TEST(OptionTableTest, FindsEveryName) {
+    std::vector<std::pair<std::string, size_t>> items = {
+        {"--verbose", 0}, {"-v", 0}, {"--output", 1}, {"-o", 1}, {"--count", 2}
+    };
+    OptionTable table(items);
+    
+    EXPECT_EQ(table.size(), 5);
+    EXPECT_EQ(table.find("--verbose"), 0);
+    EXPECT_EQ(table.find("-v"), 0);
+    EXPECT_EQ(table.find("--output"), 1);
+    EXPECT_EQ(table.find("-o"), 1);
+    EXPECT_EQ(table.find("--count"), 2);
+}
+
+// 存在しない名前・前方一致・空文字列のテスト
+TEST(OptionTableTest, RejectsUnknownNames) {
+    std::vector<std::pair<std::string, size_t>> items = {{"--verbose", 0}, {"-v", 1}};
+    OptionTable table(items);
+    
+    EXPECT_EQ(table.find("--verb"), OptionTable::npos);
+    EXPECT_EQ(table.find("--verbose2"), OptionTable::npos);
+    EXPECT_EQ(table.find("-x"), OptionTable::npos);
+    EXPECT_EQ(table.find(""), OptionTable::npos);
+    
+    OptionTable empty;
+    EXPECT_EQ(empty.find("--verbose"), OptionTable::npos);
+}
+
+// 重複した名前は後の値で上書きされることのテスト
+TEST(OptionTableTest, LaterDuplicateWins) {
+    std::vector<std::pair<std::string, size_t>> items = {{"--name", 0}, {"--name", 3}};
+    OptionTable table(items);
+    
+    EXPECT_EQ(table.size(), 1);
+    EXPECT_EQ(table.find("--name"), 3);
+}
+
+// 大量の名前でも全て一意に検索できることのテスト
+TEST(OptionTableTest, ScalesToThousandsOfNames) {
+    std::vector<std::pair<std::string, size_t>> items;
+    for (size_t i = 0; i < 5000; ++i) {
+        items.push_back(std::make_pair("--generated-option-" + std::to_string(i), i));
+    }
+    OptionTable table(items);
+    
+    for (size_t i = 0; i < items.size(); ++i) {
+        ASSERT_EQ(table.find(StringView(items[i].first)), i);
+    }
+    EXPECT_EQ(table.find("--generated-option-5000"), OptionTable::npos);
+}
+
+// 配置できない場合は名前順の表の二分探索に切り替わることのテスト
+TEST(OptionTableTest, FallsBackToSortedTable) {
+    std::vector<std::pair<std::string, size_t>> items = {
+        {"--verbose", 0}, {"-v", 0}, {"--output", 1}, {"-o", 1}, {"--count", 2}, {"", 3}
+    };
+    for (size_t i = 0; i < 100; ++i) {
+        items.push_back(std::make_pair("--generated-option-" + std::to_string(i), i + 10));
+    }
+    OptionTable hashed(items);
+    OptionTable sorted(items, 0);
+    
+    EXPECT_TRUE(hashed.hashed());
+    EXPECT_FALSE(sorted.hashed());
+    EXPECT_EQ(sorted.size(), hashed.size());
+    for (const auto& item : items) {
+        EXPECT_EQ(sorted.find(StringView(item.first)), item.second) << item.first;
+    }
+    EXPECT_EQ(sorted.find("--verb"), OptionTable::npos);
+    EXPECT_EQ(sorted.find("--verbose2"), OptionTable::npos);
+    EXPECT_EQ(sorted.find("-"), OptionTable::npos);
+    EXPECT_EQ(sorted.find("~"), OptionTable::npos);
+}
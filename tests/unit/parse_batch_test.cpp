@@ -0,0 +1,189 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include "../../include/argparse/argparse.hpp"
+
+using namespace argparse;
+
+class ParseBatchTest : public ::testing::Test {
+protected:
+    ArgumentParser parser;
+    
+    void SetUp() override {
+        parser = ArgumentParser("job", "Job submission");
+        parser.add_argument("--priority").type<int>().default_value(0);
+        parser.add_argument("--queue").choices(std::vector<std::string>{"batch", "interactive"});
+        parser.add_argument("inputs").nargs("+");
+    }
+    
+    std::vector<std::vector<std::string>> jobs() const {
+        return {
+            {"--priority", "3", "a.txt", "b.txt"},
+            {"--priority", "high", "c.txt"},
+            {"--queue", "interactive", "d.txt"},
+            {"--queue", "gpu", "e.txt"},
+            {"--help"},
+            {},
+        };
+    }
+};
+
+// 各要素の結果が入力順に返り、失敗しても例外を送出しないことのテスト
+TEST_F(ParseBatchTest, ResultsPerItem) {
+    CompiledParser compiled = parser.compile();
+    std::vector<ParseResult> results = compiled.parse_batch(jobs());
+    
+    ASSERT_EQ(results.size(), 6u);
+    ASSERT_TRUE(results[0].ok());
+    EXPECT_EQ(results[0].values().get<int>("priority"), 3);
+    EXPECT_EQ(results[0].values().get<std::vector<std::string>>("inputs"),
+              (std::vector<std::string>{"a.txt", "b.txt"}));
+    
+    EXPECT_EQ(results[1].status(), ParseStatus::INVALID_VALUE);
+    EXPECT_EQ(results[1].argument_index(), 1u);
+    EXPECT_NE(results[1].message().find("invalid int value: 'high'"), std::string::npos);
+    
+    ASSERT_TRUE(results[2].ok());
+    EXPECT_EQ(results[2].values().get<int>("priority"), 0);
+    EXPECT_EQ(results[2].values().get<std::string>("queue"), "interactive");
+    
+    EXPECT_EQ(results[3].status(), ParseStatus::INVALID_CHOICE);
+    EXPECT_EQ(results[4].status(), ParseStatus::HELP_REQUESTED);
+    EXPECT_NE(results[4].message().find("Job submission"), std::string::npos);
+    EXPECT_EQ(results[5].status(), ParseStatus::MISSING_REQUIRED);
+    
+    // 単独の try_parse_args と同じ結果になる
+    std::vector<std::vector<std::string>> items = jobs();
+    for (size_t i = 0; i < items.size(); ++i) {
+        ParseResult single = compiled.try_parse_args(items[i]);
+        EXPECT_EQ(results[i].status(), single.status()) << i;
+        EXPECT_EQ(results[i].message(), single.message()) << i;
+    }
+}
+
+// 作業領域を使い回して要素ごとに呼び出す形式のテスト
+TEST_F(ParseBatchTest, VisitorWithContext) {
+    CompiledParser compiled = parser.compile();
+    std::vector<std::vector<std::string>> items = jobs();
+    
+    ParseContext context;
+    std::vector<ParseStatus> statuses;
+    int total_priority = 0;
+    size_t failed = compiled.parse_batch(items, context, [&](size_t index, const ParseContext& item) {
+        EXPECT_EQ(index, statuses.size());
+        statuses.push_back(item.status());
+        if (item.ok()) {
+            total_priority += item.values().get<int>("priority");
+        }
+    });
+    
+    EXPECT_EQ(failed, 4u);
+    EXPECT_EQ(statuses, (std::vector<ParseStatus>{ParseStatus::SUCCESS, ParseStatus::INVALID_VALUE,
+                                                  ParseStatus::SUCCESS, ParseStatus::INVALID_CHOICE,
+                                                  ParseStatus::HELP_REQUESTED, ParseStatus::MISSING_REQUIRED}));
+    EXPECT_EQ(total_priority, 3);
+    
+    // 範囲の一部だけを解析する
+    statuses.clear();
+    failed = compiled.parse_batch(items.data() + 2, items.data() + 3, context,
+                                  [&](size_t, const ParseContext& item) { statuses.push_back(item.status()); });
+    EXPECT_EQ(failed, 0u);
+    EXPECT_EQ(statuses, (std::vector<ParseStatus>{ParseStatus::SUCCESS}));
+}
+
+// 空のバッチのテスト
+TEST_F(ParseBatchTest, EmptyBatch) {
+    CompiledParser compiled = parser.compile();
+    EXPECT_TRUE(compiled.parse_batch(std::vector<std::vector<std::string>>()).empty());
+    
+    ParseContext context;
+    size_t calls = 0;
+    EXPECT_EQ(compiled.parse_batch(std::vector<std::vector<std::string>>(), context,
+                                   [&](size_t, const ParseContext&) { ++calls; }), 0u);
+    EXPECT_EQ(calls, 0u);
+}
+
+// 並列解析の結果が逐次解析と一致することのテスト（要素ごとの引数の数に大きな偏りがある場合）
+TEST_F(ParseBatchTest, ParallelMatchesSequential) {
+    CompiledParser compiled = parser.compile();
+    std::vector<std::vector<std::string>> items;
+    for (size_t i = 0; i < 500; ++i) {
+        std::vector<std::string> item = {"--priority", i % 7 == 0 ? "bad" : std::to_string(i)};
+        size_t files = i % 100 == 0 ? 5000 : 2;
+        for (size_t j = 0; j < files; ++j) {
+            item.push_back("file" + std::to_string(j));
+        }
+        items.push_back(item);
+    }
+    
+    std::vector<ParseResult> expected = compiled.parse_batch(items);
+    for (size_t threads : {1u, 2u, 3u, 8u, 0u}) {
+        std::vector<ParseResult> results = compiled.parse_batch_parallel(items, threads);
+        ASSERT_EQ(results.size(), items.size());
+        for (size_t i = 0; i < items.size(); ++i) {
+            ASSERT_EQ(results[i].status(), expected[i].status()) << threads << " threads, item " << i;
+            if (results[i].ok()) {
+                EXPECT_EQ(results[i].values().get<int>("priority"), static_cast<int>(i));
+                EXPECT_EQ(results[i].values().get<std::vector<std::string>>("inputs").size(),
+                          i % 100 == 0 ? 5000u : 2u);
+            } else {
+                EXPECT_EQ(results[i].message(), expected[i].message());
+            }
+        }
+    }
+}
+
+// 並列解析で各要素がちょうど1回ずつ処理されることのテスト
+TEST_F(ParseBatchTest, ParallelVisitorVisitsEachItemOnce) {
+    CompiledParser compiled = parser.compile();
+    std::vector<std::vector<std::string>> items;
+    for (size_t i = 0; i < 1000; ++i) {
+        items.push_back({"--priority", i % 10 == 0 ? "bad" : "1", "input" + std::to_string(i)});
+    }
+    
+    std::vector<std::atomic<int>> visits(items.size());
+    std::atomic<int> total(0);
+    size_t failed = compiled.parse_batch_parallel(items, 4, [&](size_t index, const ParseContext& context) {
+        visits[index].fetch_add(1);
+        if (context.ok()) {
+            total.fetch_add(context.values().get<int>("priority"));
+        }
+    });
+    
+    EXPECT_EQ(failed, 100u);
+    EXPECT_EQ(total.load(), 900);
+    for (size_t i = 0; i < visits.size(); ++i) {
+        EXPECT_EQ(visits[i].load(), 1) << i;
+    }
+    
+    EXPECT_TRUE(compiled.parse_batch_parallel(std::vector<std::vector<std::string>>(), 4).empty());
+}
+
+// 呼び出し側の関数が送出した例外は呼び出し元に伝わることのテスト
+TEST_F(ParseBatchTest, ParallelVisitorException) {
+    CompiledParser compiled = parser.compile();
+    std::vector<std::vector<std::string>> items(200, std::vector<std::string>{"input"});
+    EXPECT_THROW(compiled.parse_batch_parallel(items, 4, [](size_t index, const ParseContext&) {
+        if (index == 150) {
+            throw std::runtime_error("stop");
+        }
+    }), std::runtime_error);
+}
+
+// ワーカー数が要素数とハードウェアのスレッド数に応じて制限されることのテスト
+TEST_F(ParseBatchTest, WorkerCountIsCapped) {
+    const size_t hardware = std::max<size_t>(1, std::thread::hardware_concurrency());
+    EXPECT_EQ(detail::worker_count(0, 1000), std::min<size_t>(hardware, 1000));
+    EXPECT_EQ(detail::worker_count(8, 3), 3u);
+    EXPECT_EQ(detail::worker_count(4, 0), 1u);
+    EXPECT_EQ(detail::worker_count(1000, 1000), std::min<size_t>(hardware * 4, 1000));
+    
+    // 上限を超える指定でも結果は変わらない
+    CompiledParser compiled = parser.compile();
+    std::vector<std::vector<std::string>> items(1000, std::vector<std::string>{"--priority", "2", "input"});
+    std::vector<ParseResult> results = compiled.parse_batch_parallel(items, 1000);
+    ASSERT_EQ(results.size(), items.size());
+    for (const auto& result : results) {
+        EXPECT_EQ(result.values().get<int>("priority"), 2);
+    }
+}
@@ -0,0 +1,214 @@
+#include <gtest/gtest.h>
+#include "../../include/argparse/argparse.hpp"
+#include "test_util.hpp"
+
+using namespace argparse;
+using test_util::count_allocations;
+
+namespace {
+
+// 典型的な30オプションのコマンドライン
+void add_typical_arguments(ArgumentParser& parser) {
+    for (int i = 0; i < 10; ++i) {
+        parser.add_argument("--count" + std::to_string(i)).type<int>();
+        parser.add_argument("--name" + std::to_string(i));
+    }
+    for (int i = 0; i < 5; ++i) {
+        parser.add_argument("--flag" + std::to_string(i)).action("store_true");
+    }
+    parser.add_argument("-v", "--verbose").action("count");
+    parser.add_argument("--sizes").type<int>().nargs("+");
+    parser.add_argument("--ratio").type<double>().default_value(0.5);
+    parser.add_argument("--mode").choices(std::vector<std::string>{"fast", "slow"});
+    parser.add_argument("input");
+}
+
+std::vector<std::string> typical_command_line() {
+    std::vector<std::string> args;
+    for (int i = 0; i < 10; ++i) {
+        args.push_back("--count" + std::to_string(i));
+        args.push_back(std::to_string(i * 100));
+        // 長い値（SSOに収まらない）も含める
+        args.push_back("--name" + std::to_string(i) + "=/var/lib/service/data/file" + std::to_string(i) + ".bin");
+    }
+    for (int i = 0; i < 5; ++i) {
+        args.push_back("--flag" + std::to_string(i));
+    }
+    args.push_back("-vv");
+    args.push_back("--sizes");
+    args.push_back("1");
+    args.push_back("2");
+    args.push_back("3");
+    args.push_back("--ratio");
+    args.push_back("0.25");
+    args.push_back("--mode");
+    args.push_back("fast");
+    args.push_back("input.txt");
+    return args;
+}
+
+} // namespace
+
+class ParseContextTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+    }
+    
+    void TearDown() override {
+    }
+};
+
+// 再利用した作業領域での解析はヒープ確保を行わないことのテスト
+TEST_F(ParseContextTest, ReusedContextDoesNotAllocate) {
+    ArgumentParser parser("test");
+    add_typical_arguments(parser);
+    CompiledParser compiled = parser.compile();
+    std::vector<std::string> args = typical_command_line();
+    
+    ParseContext context;
+    ASSERT_TRUE(compiled.try_parse_args(args, context)) << context.message();
+    
+    size_t allocations = count_allocations([&]() {
+        for (int round = 0; round < 100; ++round) {
+            compiled.try_parse_args(args, context);
+        }
+    });
+    EXPECT_EQ(allocations, 0u);
+    
+    ASSERT_TRUE(context.ok());
+    const Namespace& values = context.values();
+    EXPECT_EQ(values.get<int>("count9"), 900);
+    EXPECT_EQ(values.get<std::string>("name3"), "/var/lib/service/data/file3.bin");
+    EXPECT_TRUE(values.get<bool>("flag4"));
+    EXPECT_EQ(values.get<int>("verbose"), 2);
+    EXPECT_EQ(values.get<std::vector<int>>("sizes"), (std::vector<int>{1, 2, 3}));
+    EXPECT_DOUBLE_EQ(values.get<double>("ratio"), 0.25);
+    EXPECT_EQ(values.get<std::string>("mode"), "fast");
+    EXPECT_EQ(values.get<std::string>("input"), "input.txt");
+}
+
+// argv版も同様に確保を行わないことのテスト
+TEST_F(ParseContextTest, ReusedContextWithArgvDoesNotAllocate) {
+    ArgumentParser parser("test");
+    add_typical_arguments(parser);
+    CompiledParser compiled = parser.compile();
+    std::vector<std::string> args = typical_command_line();
+    args.insert(args.begin(), "test");
+    std::vector<char*> argv;
+    for (auto& arg : args) {
+        argv.push_back(&arg[0]);
+    }
+    
+    ParseContext context;
+    ASSERT_TRUE(compiled.try_parse_args(static_cast<int>(argv.size()), argv.data(), context));
+    
+    size_t allocations = count_allocations([&]() {
+        compiled.try_parse_args(static_cast<int>(argv.size()), argv.data(), context);
+    });
+    EXPECT_EQ(allocations, 0u);
+    EXPECT_EQ(context.values().get<int>("count1"), 100);
+}
+
+// 前回の解析の値が次の解析に残らないことのテスト
+TEST_F(ParseContextTest, PreviousValuesDoNotLeak) {
+    ArgumentParser parser("test");
+    parser.add_argument("--name");
+    parser.add_argument("--items").nargs("*");
+    parser.add_argument("--add").type<int>().action("append");
+    parser.add_argument("--level").type<int>().default_value(1);
+    CompiledParser compiled = parser.compile();
+    
+    ParseContext context;
+    ASSERT_TRUE(compiled.try_parse_args(std::vector<std::string>{
+        "--name", "a-rather-long-name-value", "--items", "x", "y", "z", "--add", "1", "--add", "2", "--level", "5"},
+        context));
+    EXPECT_EQ(context.values().get<std::vector<std::string>>("items"), (std::vector<std::string>{"x", "y", "z"}));
+    
+    ASSERT_TRUE(compiled.try_parse_args(std::vector<std::string>{"--items", "w", "--add", "3"}, context));
+    const Namespace& values = context.values();
+    EXPECT_FALSE(values.has("name"));
+    EXPECT_EQ(values.get<std::vector<std::string>>("items"), (std::vector<std::string>{"w"}));
+    EXPECT_EQ(values.get<std::vector<int>>("add"), (std::vector<int>{3}));
+    EXPECT_EQ(values.get<int>("level"), 1);
+    EXPECT_EQ(values.size(), 3u);
+    
+    ASSERT_TRUE(compiled.try_parse_args(std::vector<std::string>{"--name", "b"}, context));
+    EXPECT_EQ(context.values().get<std::string>("name"), "b");
+    EXPECT_FALSE(context.values().has("items"));
+    EXPECT_FALSE(context.values().has("add"));
+}
+
+// 失敗の後も同じ作業領域で解析を続けられることのテスト
+TEST_F(ParseContextTest, FailureThenSuccess) {
+    ArgumentParser parser("test");
+    parser.add_argument("--port").type<int>();
+    parser.add_argument("input");
+    CompiledParser compiled = parser.compile();
+    
+    ParseContext context;
+    EXPECT_FALSE(compiled.try_parse_args(std::vector<std::string>{"--port", "http", "in"}, context));
+    EXPECT_EQ(context.status(), ParseStatus::INVALID_VALUE);
+    EXPECT_EQ(context.argument_name(), "--port");
+    EXPECT_NE(context.message().find("invalid int value: 'http'"), std::string::npos);
+    
+    EXPECT_FALSE(compiled.try_parse_args(std::vector<std::string>{"--port", "80"}, context));
+    EXPECT_EQ(context.status(), ParseStatus::MISSING_REQUIRED);
+    EXPECT_NE(context.message_with_usage().find("usage:"), std::string::npos);
+    
+    ASSERT_TRUE(compiled.try_parse_args(std::vector<std::string>{"--port", "80", "in"}, context));
+    EXPECT_EQ(context.status(), ParseStatus::SUCCESS);
+    EXPECT_TRUE(context.message().empty());
+    EXPECT_EQ(context.values().get<int>("port"), 80);
+}
+
+// 別のパーサーと同じ作業領域を使い回せることのテスト
+TEST_F(ParseContextTest, ContextSharedBetweenParsers) {
+    ArgumentParser first("first");
+    first.add_argument("--alpha").type<int>();
+    ArgumentParser second("second");
+    second.add_argument("--beta");
+    second.add_argument("--gamma").action("store_true");
+    CompiledParser first_compiled = first.compile();
+    CompiledParser second_compiled = second.compile();
+    
+    ParseContext context;
+    ASSERT_TRUE(first_compiled.try_parse_args(std::vector<std::string>{"--alpha", "7"}, context));
+    EXPECT_EQ(context.values().get<int>("alpha"), 7);
+    
+    ASSERT_TRUE(second_compiled.try_parse_args(std::vector<std::string>{"--beta", "b"}, context));
+    EXPECT_FALSE(context.values().has("alpha"));
+    EXPECT_EQ(context.values().get<std::string>("beta"), "b");
+    EXPECT_FALSE(context.values().get<bool>("gamma"));
+}
+
+// 遅延変換モードでも再利用できることのテスト
+TEST_F(ParseContextTest, LazyConversion) {
+    ArgumentParser parser("test");
+    parser.lazy_conversion();
+    parser.add_argument("--count").type<int>();
+    parser.add_argument("--label").default_value(std::string("default-label-value"));
+    CompiledParser compiled = parser.compile();
+    
+    ParseContext context;
+    ASSERT_TRUE(compiled.try_parse_args(std::vector<std::string>{"--count", "3", "--label", "x"}, context));
+    EXPECT_EQ(context.values().get<int>("count"), 3);
+    
+    ASSERT_TRUE(compiled.try_parse_args(std::vector<std::string>{"--count", "oops"}, context));
+    EXPECT_EQ(context.values().get<std::string>("label"), "default-label-value");
+    EXPECT_THROW(context.values().validate(), std::invalid_argument);
+}
+
+// 同じ型の値の代入は確保済みの領域を再利用することのテスト
+TEST_F(ParseContextTest, AnyValueAssignmentReusesStorage) {
+    detail::AnyValue target(std::string(64, 'a'));
+    detail::AnyValue source(std::string(32, 'b'));
+    size_t allocations = count_allocations([&]() {
+        target = source;
+    });
+    EXPECT_EQ(allocations, 0u);
+    EXPECT_EQ(target.get<std::string>(), std::string(32, 'b'));
+    
+    // 型が異なれば置き換わる
+    target = detail::AnyValue(5);
+    EXPECT_EQ(target.get<int>(), 5);
+}
@@ -4,7 +4,7 @@
 class ParserTest : public ::testing::Test {
 protected:
     void SetUp() override {
-        parser = std::make_unique<argparse::ArgumentParser>("test_parser", "Parser test program");
+        parser = std::unique_ptr<argparse::ArgumentParser>(new argparse::ArgumentParser("test_parser", "Parser test program"));
     }
 
     void TearDown() override {
@@ -107,7 +107,7 @@ TEST_F(ParserTest, TypeConversion) {
     auto result = parser->parse_args(args);
     
     EXPECT_EQ(result.get<int>("int"), 123);
-    EXPECT_DOUBLE_EQ(result.get<double>("float"), 3.14);
+    EXPECT_FLOAT_EQ(result.get<float>("float"), 3.14f);
     EXPECT_TRUE(result.get<bool>("bool"));
 }
 
@@ -0,0 +1,265 @@
+#include <gtest/gtest.h>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include "../../include/argparse/argparse.hpp"
+#include "test_util.hpp"
+
+using namespace argparse;
+
+class ResponseFileTest : public test_util::TempFileTest {
+protected:
+    ResponseFileTest() : TempFileTest("argparse_response_") {}
+    
+    static std::string read_file(const std::string& path) {
+        std::ifstream in(path.c_str(), std::ios::binary);
+        std::ostringstream content;
+        content << in.rdbuf();
+        return content.str();
+    }
+};
+
+// 既定では展開せず、"@" で始まる引数はそのまま位置引数になることのテスト
+TEST_F(ResponseFileTest, DisabledByDefault) {
+    ArgumentParser parser("test");
+    parser.add_argument("input");
+    
+    Namespace result = parser.parse_args(std::vector<std::string>{"@missing.txt"});
+    EXPECT_EQ(result.get<std::string>("input"), "@missing.txt");
+}
+
+// ファイル内の引数がその位置に展開されることのテスト
+TEST_F(ResponseFileTest, ExpandsInPlace) {
+    std::string path = write_file("basic.rsp", "--level 3\n--name service\n  first.txt\tsecond.txt\r\n");
+    ArgumentParser parser("test");
+    parser.fromfile_prefix_chars("@");
+    parser.add_argument("--level").type<int>();
+    parser.add_argument("--name");
+    parser.add_argument("--tag");
+    parser.add_argument("files").nargs("*");
+    
+    Namespace result = parser.parse_args(std::vector<std::string>{"--tag", "x", "@" + path, "last.txt"});
+    EXPECT_EQ(result.get<int>("level"), 3);
+    EXPECT_EQ(result.get<std::string>("name"), "service");
+    EXPECT_EQ(result.get<std::string>("tag"), "x");
+    EXPECT_EQ(result.get<std::vector<std::string>>("files"),
+              (std::vector<std::string>{"first.txt", "second.txt", "last.txt"}));
+}
+
+// シェル風の引用符・エスケープの処理のテスト（元のファイルは変更されない）
+TEST_F(ResponseFileTest, ShellLikeQuoting) {
+    std::string content =
+        "'single quoted \\n value' \"double \\\"quoted\\\" \\\\ value\" back\\ slash\n"
+        "mixed'part'\"s\" \"\" '' plain\n";
+    std::string path = write_file("quoting.rsp", content);
+    ArgumentParser parser("test");
+    parser.fromfile_prefix_chars("@");
+    parser.add_argument("values").nargs("*");
+    
+    Namespace result = parser.parse_args(std::vector<std::string>{"@" + path});
+    EXPECT_EQ(result.get<std::vector<std::string>>("values"),
+              (std::vector<std::string>{"single quoted \\n value", "double \"quoted\" \\ value", "back slash",
+                                        "mixedparts", "", "", "plain"}));
+    EXPECT_EQ(read_file(path), content);
+}
+
+// ファイル内の "--option=value" やオプションの値がファイルをまたぐ場合のテスト
+TEST_F(ResponseFileTest, OptionsAcrossFiles) {
+    std::string first = write_file("first.rsp", "--mode=\"fast mode\" --count");
+    std::string second = write_file("second.rsp", "5");
+    ArgumentParser parser("test");
+    parser.fromfile_prefix_chars("@");
+    parser.add_argument("--mode");
+    parser.add_argument("--count").type<int>();
+    
+    Namespace result = parser.parse_args(std::vector<std::string>{"@" + first, "@" + second});
+    EXPECT_EQ(result.get<std::string>("mode"), "fast mode");
+    EXPECT_EQ(result.get<int>("count"), 5);
+}
+
+// 入れ子の応答ファイルと複数の接頭辞文字のテスト
+TEST_F(ResponseFileTest, NestedFiles) {
+    std::string inner = write_file("inner.rsp", "b c");
+    std::string empty = write_file("empty.rsp", "");
+    std::string outer = write_file("outer.rsp", "a +" + inner + " @" + empty + " d");
+    ArgumentParser parser("test");
+    parser.fromfile_prefix_chars("@+");
+    parser.add_argument("items").nargs("+");
+    
+    Namespace result = parser.parse_args(std::vector<std::string>{"@" + outer, "e", "@" + empty});
+    EXPECT_EQ(result.get<std::vector<std::string>>("items"),
+              (std::vector<std::string>{"a", "b", "c", "d", "e"}));
+    
+    // 空のファイルだけの場合は引数がないのと同じ
+    ParseResult missing = parser.compile().try_parse_args(std::vector<std::string>{"@" + empty});
+    EXPECT_EQ(missing.status(), ParseStatus::MISSING_REQUIRED);
+}
+
+// 同じファイルは順に何度でも使えるが、自分自身を含むファイルはエラーになることのテスト
+TEST_F(ResponseFileTest, CycleDetection) {
+    std::string leaf = write_file("leaf.rsp", "x");
+    ArgumentParser parser("test");
+    parser.fromfile_prefix_chars("@");
+    parser.add_argument("items").nargs("*");
+    
+    Namespace repeated = parser.parse_args(std::vector<std::string>{"@" + leaf, "@" + leaf});
+    EXPECT_EQ(repeated.get<std::vector<std::string>>("items"), (std::vector<std::string>{"x", "x"}));
+    
+    std::string a_path = ::testing::TempDir() + "argparse_response_a.rsp";
+    std::string b_path = write_file("b.rsp", "b @" + a_path);
+    write_file("a.rsp", "a @" + b_path);
+    
+    ParseResult result = parser.compile().try_parse_args(std::vector<std::string>{"first", "@" + a_path});
+    EXPECT_EQ(result.status(), ParseStatus::RESPONSE_FILE_ERROR);
+    EXPECT_EQ(result.argument_index(), 1u);
+    EXPECT_NE(result.message().find("includes itself"), std::string::npos);
+    
+    EXPECT_THROW(parser.parse_args(std::vector<std::string>{"@" + a_path}), std::runtime_error);
+}
+
+// 読めないファイル・閉じていない引用符のテスト
+TEST_F(ResponseFileTest, Errors) {
+    ArgumentParser parser("test");
+    parser.fromfile_prefix_chars("@");
+    parser.add_argument("--name");
+    parser.add_argument("items").nargs("*");
+    CompiledParser compiled = parser.compile();
+    
+    std::string missing = ::testing::TempDir() + "argparse_response_does_not_exist.rsp";
+    ParseResult not_found = compiled.try_parse_args(std::vector<std::string>{"--name", "n", "@" + missing});
+    EXPECT_EQ(not_found.status(), ParseStatus::RESPONSE_FILE_ERROR);
+    EXPECT_EQ(not_found.argument_index(), 2u);
+    EXPECT_NE(not_found.message().find("cannot read response file '" + missing + "'"), std::string::npos);
+    
+    std::string unterminated = write_file("unterminated.rsp", "ok \"never closed");
+    ParseResult quote = compiled.try_parse_args(std::vector<std::string>{"@" + unterminated});
+    EXPECT_EQ(quote.status(), ParseStatus::RESPONSE_FILE_ERROR);
+    EXPECT_NE(quote.message().find("unterminated quote"), std::string::npos);
+    
+    // 失敗の後も同じ作業領域で解析を続けられる
+    std::string good = write_file("good.rsp", "--name value");
+    ParseContext context;
+    EXPECT_FALSE(compiled.try_parse_args(std::vector<std::string>{"@" + missing}, context));
+    ASSERT_TRUE(compiled.try_parse_args(std::vector<std::string>{"@" + good}, context));
+    EXPECT_EQ(context.values().get<std::string>("name"), "value");
+}
+
+// argv版でも展開されることのテスト
+TEST_F(ResponseFileTest, ArgvExpansion) {
+    std::string path = write_file("argv.rsp", "--count 7");
+    ArgumentParser parser("test");
+    parser.fromfile_prefix_chars("@");
+    parser.add_argument("--count").type<int>();
+    
+    std::string arg = "@" + path;
+    char* argv[] = {const_cast<char*>("test"), &arg[0]};
+    Namespace result = parser.parse_args(2, argv);
+    EXPECT_EQ(result.get<int>("count"), 7);
+}
+
+// 大量の引数を持つファイルのテスト
+TEST_F(ResponseFileTest, LargeFile) {
+    std::string content;
+    for (int i = 0; i < 100000; ++i) {
+        content += "/src/module" + std::to_string(i) + ".cpp\n";
+    }
+    std::string path = write_file("large.rsp", content);
+    ArgumentParser parser("test");
+    parser.fromfile_prefix_chars("@");
+    parser.add_argument("sources").nargs("+");
+    
+    Namespace result = parser.parse_args(std::vector<std::string>{"@" + path});
+    const auto& sources = result.get<std::vector<std::string>>("sources");
+    ASSERT_EQ(sources.size(), 100000u);
+    EXPECT_EQ(sources.front(), "/src/module0.cpp");
+    EXPECT_EQ(sources.back(), "/src/module99999.cpp");
+}
+
+// 応答ファイルの読み取りで引数がファイル内容へのビューとして返ることのテスト
+TEST_F(ResponseFileTest, ReaderReturnsViewsIntoFile) {
+    std::string path = write_file("reader.rsp", "one \"t w o\" three");
+    detail::ResponseFileReader reader;
+    reader.push(detail::StringView(path));
+    
+    detail::StringView first;
+    detail::StringView second;
+    detail::StringView third;
+    detail::StringView none;
+    ASSERT_TRUE(reader.next(first));
+    ASSERT_TRUE(reader.next(second));
+    ASSERT_TRUE(reader.next(third));
+    EXPECT_FALSE(reader.next(none));
+    EXPECT_EQ(first.str(), "one");
+    EXPECT_EQ(second.str(), "t w o");
+    EXPECT_EQ(third.str(), "three");
+    
+    // 同じ領域上に並んでいる（引用符は前に詰めて取り除かれる）
+    EXPECT_EQ(second.data(), first.data() + 4);
+    EXPECT_EQ(third.data(), first.data() + 12);
+    reader.close_all();
+}
+
+#if ARGPARSE_HAS_MMAP
+// パイプ（標準入力など）の応答ファイルを一定の大きさずつ読み込むことのテスト
+TEST_F(ResponseFileTest, PipeReadInChunks) {
+    int fds[2];
+    ASSERT_EQ(::pipe(fds), 0);
+    
+    // 読み込み領域の境界をまたぐ長い引数や引用符付きの引数を含める
+    const int count = 50000;
+    std::thread writer([&]() {
+        std::string text;
+        for (int i = 0; i < count; ++i) {
+            text += (i % 1000 == 0) ? "'path " + std::string(300, 'x') + "' " : "p" + std::to_string(i) + " ";
+            if (text.size() > 8192) {
+                ssize_t ignored = ::write(fds[1], text.data(), text.size());
+                (void)ignored;
+                text.clear();
+            }
+        }
+        text += "--level 3 --sizes 1 2 3";
+        ssize_t ignored = ::write(fds[1], text.data(), text.size());
+        (void)ignored;
+        ::close(fds[1]);
+    });
+    
+    ArgumentParser parser("test");
+    parser.fromfile_prefix_chars("@");
+    parser.add_argument("--level").type<int>();
+    parser.add_argument("--sizes").type<int>().nargs("+");
+    parser.add_argument("paths").nargs("*");
+    ParseResult result = parser.compile().try_parse_args(
+        std::vector<std::string>{"@/dev/fd/" + std::to_string(fds[0])});
+    writer.join();
+    ::close(fds[0]);
+    
+    ASSERT_TRUE(result.ok()) << result.message();
+    const auto& paths = result.values().get<std::vector<std::string>>("paths");
+    ASSERT_EQ(paths.size(), static_cast<size_t>(count));
+    EXPECT_EQ(paths[0], "path " + std::string(300, 'x'));
+    EXPECT_EQ(paths[1], "p1");
+    EXPECT_EQ(paths[count - 1], "p" + std::to_string(count - 1));
+    EXPECT_EQ(result.values().get<int>("level"), 3);
+    EXPECT_EQ(result.values().get<std::vector<int>>("sizes"), (std::vector<int>{1, 2, 3}));
+}
+
+// パイプから読んだオプション名は、多数の値を読み進めた後のエラーでも正しく報告されることのテスト
+TEST_F(ResponseFileTest, PipeOptionNameSurvivesManyValues) {
+    int fds[2];
+    ASSERT_EQ(::pipe(fds), 0);
+    std::string text = "--modes r w r w r w r w x";
+    ssize_t written = ::write(fds[1], text.data(), text.size());
+    ASSERT_EQ(written, static_cast<ssize_t>(text.size()));
+    ::close(fds[1]);
+    
+    ArgumentParser parser("test");
+    parser.fromfile_prefix_chars("@");
+    parser.add_argument("--modes").nargs("+").action("extend").choices(std::vector<std::string>{"r", "w"});
+    ParseResult result = parser.compile().try_parse_args(
+        std::vector<std::string>{"@/dev/fd/" + std::to_string(fds[0])});
+    ::close(fds[0]);
+    
+    EXPECT_EQ(result.status(), ParseStatus::INVALID_CHOICE);
+    EXPECT_NE(result.message().find("argument --modes:"), std::string::npos) << result.message();
+}
+#endif
@@ -0,0 +1,183 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include "../../include/argparse/argparse.hpp"
+#include "test_util.hpp"
+
+using namespace argparse;
+
+class StreamPositionalTest : public test_util::TempFileTest {
+protected:
+    StreamPositionalTest() : TempFileTest("argparse_stream_") {}
+};
+
+// 値が変換されて順に渡され、Namespaceには個数だけが格納されることのテスト
+TEST_F(StreamPositionalTest, DeliversConvertedValuesInOrder) {
+    std::vector<int> received;
+    ArgumentParser parser("test");
+    parser.add_argument("--scale").type<int>().default_value(1);
+    parser.add_argument("numbers").nargs("+").stream<int>([&](int value) { received.push_back(value); });
+    
+    Namespace result = parser.parse_args(std::vector<std::string>{"--scale", "2", "5", "3", "7"});
+    EXPECT_EQ(received, (std::vector<int>{5, 3, 7}));
+    EXPECT_EQ(result.get<size_t>("numbers"), 3u);
+    EXPECT_EQ(result.get<int>("scale"), 2);
+}
+
+// "*" はオプションで止まり、"remainder" はオプションも含めて受け取ることのテスト
+TEST_F(StreamPositionalTest, StarStopsAtOptionRemainderDoesNot) {
+    std::vector<std::string> files;
+    ArgumentParser star("test");
+    star.add_argument("--verbose").action("store_true");
+    star.add_argument("files").nargs("*").stream<std::string>([&](const std::string& file) {
+        files.push_back(file);
+    });
+    
+    Namespace result = star.parse_args(std::vector<std::string>{"a", "b", "--verbose"});
+    EXPECT_EQ(files, (std::vector<std::string>{"a", "b"}));
+    EXPECT_TRUE(result.get<bool>("verbose"));
+    
+    std::vector<std::string> rest;
+    ArgumentParser remainder("test");
+    remainder.add_argument("--verbose").action("store_true");
+    remainder.add_argument("command").nargs("remainder").stream<std::string>([&](const std::string& arg) {
+        rest.push_back(arg);
+    });
+    
+    result = remainder.parse_args(std::vector<std::string>{"--verbose", "run", "--verbose", "x"});
+    EXPECT_EQ(rest, (std::vector<std::string>{"run", "--verbose", "x"}));
+    EXPECT_TRUE(result.get<bool>("verbose"));
+    EXPECT_EQ(result.get<size_t>("command"), 3u);
+}
+
+// 不正な値で停止し、それまでの値は渡されていることのテスト
+TEST_F(StreamPositionalTest, InvalidValueStopsStream) {
+    std::vector<int> received;
+    ArgumentParser parser("test");
+    parser.add_argument("numbers").nargs("*").stream<int>([&](int value) { received.push_back(value); });
+    
+    ParseResult result = parser.compile().try_parse_args(std::vector<std::string>{"1", "2", "three", "4"});
+    EXPECT_EQ(result.status(), ParseStatus::INVALID_VALUE);
+    EXPECT_EQ(result.argument_index(), 2u);
+    EXPECT_EQ(received, (std::vector<int>{1, 2}));
+    
+    // 選択肢も値ごとに検証される
+    std::vector<std::string> modes;
+    ArgumentParser choices("test");
+    choices.add_argument("modes").nargs("+").choices(std::vector<std::string>{"r", "w"})
+        .stream<std::string>([&](const std::string& mode) { modes.push_back(mode); });
+    ParseResult invalid = choices.compile().try_parse_args(std::vector<std::string>{"r", "x"});
+    EXPECT_EQ(invalid.status(), ParseStatus::INVALID_CHOICE);
+    EXPECT_EQ(modes, (std::vector<std::string>{"r"}));
+}
+
+// 受け取り側の例外は ACTION_FAILED として報告されることのテスト
+TEST_F(StreamPositionalTest, SinkExceptionReported) {
+    ArgumentParser parser("test");
+    parser.add_argument("paths").nargs("+").stream<std::string>([](const std::string& path) {
+        if (path == "bad") {
+            throw std::runtime_error("cannot open bad");
+        }
+    });
+    
+    ParseResult result = parser.compile().try_parse_args(std::vector<std::string>{"good", "bad"});
+    EXPECT_EQ(result.status(), ParseStatus::ACTION_FAILED);
+    EXPECT_EQ(result.argument_index(), 1u);
+    EXPECT_NE(result.message().find("cannot open bad"), std::string::npos);
+}
+
+// 位置引数の残りを読み進めるもの以外には使えないことのテスト
+TEST_F(StreamPositionalTest, RequiresUnboundedPositional) {
+    ArgumentParser option("test");
+    option.add_argument("--items").nargs("*").stream<std::string>([](const std::string&) {});
+    EXPECT_THROW(option.compile(), std::invalid_argument);
+    
+    ArgumentParser single("test");
+    single.add_argument("item").stream<std::string>([](const std::string&) {});
+    EXPECT_THROW(single.compile(), std::invalid_argument);
+}
+
+// 応答ファイルの値を確保なしに受け渡すことのテスト
+TEST_F(StreamPositionalTest, ResponseFileStreamsWithoutAllocation) {
+    std::string content;
+    long long expected = 0;
+    for (int i = 0; i < 100000; ++i) {
+        content += std::to_string(i) + "\n";
+        expected += i;
+    }
+    std::string path = write_file("numbers.rsp", content);
+    
+    long long sum = 0;
+    ArgumentParser parser("test");
+    parser.fromfile_prefix_chars("@");
+    parser.add_argument("numbers").nargs("*").stream<long long>([&](long long value) { sum += value; });
+    CompiledParser compiled = parser.compile();
+    std::vector<std::string> args = {"@" + path};
+    
+    ParseContext context;
+    ASSERT_TRUE(compiled.try_parse_args(args, context)) << context.message();
+    EXPECT_EQ(sum, expected);
+    
+    // 2回目以降の確保はファイルを開く分だけで、値の数によらない
+    sum = 0;
+    bool ok = false;
+    size_t allocations = test_util::count_allocations([&]() { ok = compiled.try_parse_args(args, context); });
+    ASSERT_TRUE(ok);
+    EXPECT_EQ(sum, expected);
+    EXPECT_EQ(context.values().get<size_t>("numbers"), 100000u);
+    EXPECT_LT(allocations, 16u);
+}
+
+#if ARGPARSE_HAS_MMAP
+// パイプ（標準入力など）の応答ファイルを少しずつ読みながら受け渡すことのテスト
+TEST_F(StreamPositionalTest, PipeResponseFile) {
+    int fds[2];
+    ASSERT_EQ(::pipe(fds), 0);
+    
+    // 読み込み領域の境界をまたぐ長い引数や引用符付きの引数を含める
+    const int count = 50000;
+    std::thread writer([&]() {
+        std::string text;
+        for (int i = 0; i < count; ++i) {
+            text += (i % 1000 == 0) ? "'path " + std::string(300, 'x') + "' " : "p" + std::to_string(i) + " ";
+            if (text.size() > 8192) {
+                ssize_t ignored = ::write(fds[1], text.data(), text.size());
+                (void)ignored;
+                text.clear();
+            }
+        }
+        text += "--level 3 --sizes 1 2 3 4 5 6 7 8 9 10";
+        ssize_t ignored = ::write(fds[1], text.data(), text.size());
+        (void)ignored;
+        ::close(fds[1]);
+    });
+    
+    size_t received = 0;
+    size_t long_values = 0;
+    std::string first;
+    ArgumentParser parser("test");
+    parser.fromfile_prefix_chars("@");
+    parser.add_argument("--level").type<int>();
+    parser.add_argument("--sizes").type<int>().nargs("+").action("extend");
+    parser.add_argument("paths").nargs("*").stream<std::string>([&](const std::string& path) {
+        if (received == 0) {
+            first = path;
+        }
+        if (path.size() > 300) {
+            ++long_values;
+        }
+        ++received;
+    });
+    
+    ParseResult result = parser.compile().try_parse_args(
+        std::vector<std::string>{"@/dev/fd/" + std::to_string(fds[0])});
+    writer.join();
+    ::close(fds[0]);
+    
+    ASSERT_TRUE(result.ok()) << result.message();
+    EXPECT_EQ(result.values().get<int>("level"), 3);
+    EXPECT_EQ(result.values().get<std::vector<int>>("sizes"), (std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10}));
+    EXPECT_EQ(received, static_cast<size_t>(count));
+    EXPECT_EQ(long_values, static_cast<size_t>(count / 1000));
+    EXPECT_EQ(first, "path " + std::string(300, 'x'));
+}
+#endif
@@ -0,0 +1,51 @@
+// ヒープ確保を数えるための operator new/delete の置き換え（inline にできないためヘッダーとは分ける）
+
+#include "test_util.hpp"
+#include <cstdlib>
+#include <new>
+
+namespace test_util {
+
+std::atomic<bool> counting(false);
+std::atomic<size_t> allocation_count(0);
+
+} // namespace test_util
+
+namespace {
+
+void* counted_allocate(std::size_t size) {
+    if (test_util::counting.load(std::memory_order_relaxed)) {
+        test_util::allocation_count.fetch_add(1, std::memory_order_relaxed);
+    }
+    void* memory = std::malloc(size == 0 ? 1 : size);
+    if (!memory) {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+} // namespace
+
+void* operator new(std::size_t size) {
+    return counted_allocate(size);
+}
+
+void* operator new[](std::size_t size) {
+    return counted_allocate(size);
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+// テスト共通ユーティリティ（ヒープ確保の計測と一時ファイル）
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace test_util {
+
+// 計測中のグローバルなヒープ確保の回数
+// 置き換えた operator new/delete は test_util.cpp にあり、これをリンクしたテストだけで数えられる
+extern std::atomic<bool> counting;
+extern std::atomic<size_t> allocation_count;
+
+// 計測区間の確保回数を返す
+template<typename Fn>
+inline size_t count_allocations(Fn fn) {
+    allocation_count.store(0);
+    counting.store(true);
+    fn();
+    counting.store(false);
+    return allocation_count.load();
+}
+
+// 一時ファイルを作り、テストの終了時に削除するフィクスチャ
+class TempFileTest : public ::testing::Test {
+protected:
+    std::string prefix_;
+    std::vector<std::string> created_;
+    
+    explicit TempFileTest(const std::string& prefix) : prefix_(prefix) {}
+    
+    void TearDown() override {
+        for (const auto& path : created_) {
+            std::remove(path.c_str());
+        }
+    }
+    
+    // 一時ディレクトリに内容を書き出し、そのパスを返す
+    std::string write_file(const std::string& name, const std::string& content) {
+        std::string path = ::testing::TempDir() + prefix_ + name;
+        std::ofstream out(path.c_str(), std::ios::binary);
+        out << content;
+        created_.push_back(path);
+        return path;
+    }
+};
+
+} // namespace test_util
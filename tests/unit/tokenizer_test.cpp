@@ -225,4 +225,122 @@ TEST_F(TokenizerTest, SeekFunctionality) {
     tokenizer.seek(10);
     EXPECT_EQ(tokenizer.position(), 3);  // サイズで制限される
     EXPECT_FALSE(tokenizer.has_next());
-}
\ No newline at end of file
+}
+// argvからのトークンは元のバッファを参照する（コピーしない）ことのテスト
+TEST_F(TokenizerTest, ArgvTokensAreViews) {
+    char prog[] = "prog";
+    char file[] = "input.txt";
+    char opt[] = "--name=value";
+    char* argv[] = {prog, file, opt};
+    tokenizer.tokenize(3, argv);
+    
+    ASSERT_EQ(tokenizer.size(), 3);
+    
+    Token positional = tokenizer.next();
+    EXPECT_EQ(positional.value, "input.txt");
+    EXPECT_EQ(positional.value.data(), file);
+    
+    Token option = tokenizer.next();
+    EXPECT_EQ(option.value, "--name");
+    EXPECT_EQ(option.value.data(), opt);
+    
+    Token value = tokenizer.next();
+    EXPECT_EQ(value.value, "value");
+    EXPECT_EQ(value.value.data(), opt + 7);
+    EXPECT_EQ(value.raw_value.data(), opt);
+    
+    EXPECT_EQ(tokenizer.owned_count(), 0);
+}
+
+// 内容が変わる場合のみ値を所有することのテスト
+TEST_F(TokenizerTest, OwnsOnlyRewrittenValues) {
+    std::vector<std::string> args = {"--a=\"plain\"", "--b='single'", "--c=\"esc\\tape\"", "-xyz"};
+    tokenizer.tokenize(args);
+    
+    // 引用符の除去だけならビューのまま
+    tokenizer.next();
+    Token plain = tokenizer.next();
+    EXPECT_EQ(plain.value, "plain");
+    EXPECT_EQ(plain.value.data(), args[0].data() + 5);
+    
+    tokenizer.next();
+    Token single = tokenizer.next();
+    EXPECT_EQ(single.value, "single");
+    
+    // エスケープ処理でバイトが変わる値のみ所有する
+    tokenizer.next();
+    Token escaped = tokenizer.next();
+    EXPECT_EQ(escaped.value, "esc\tape");
+    EXPECT_EQ(tokenizer.owned_count(), 1);
+    
+    // 短縮形オプションの展開では確保しない
+    EXPECT_EQ(tokenizer.next().value, "-x");
+    EXPECT_EQ(tokenizer.next().value, "-y");
+    EXPECT_EQ(tokenizer.next().value, "-z");
+    EXPECT_EQ(tokenizer.owned_count(), 1);
+}
+
+// 再トークン化で前回の状態が破棄されることのテスト
+TEST_F(TokenizerTest, RetokenizeResetsState) {
+    std::vector<std::string> first = {"--m=\"a\\nb\"", "--"};
+    tokenizer.tokenize(first);
+    EXPECT_EQ(tokenizer.owned_count(), 1);
+    
+    std::vector<std::string> second = {"--", "-v"};
+    tokenizer.tokenize(second);
+    EXPECT_EQ(tokenizer.owned_count(), 0);
+    EXPECT_EQ(tokenizer.next().type, Token::END_OPTIONS);
+    EXPECT_EQ(tokenizer.next().type, Token::POSITIONAL);
+}
+
+// TokenCursorが引数を必要な分だけ逐次分類することのテスト
+TEST_F(TokenizerTest, CursorStreamsTokens) {
+    std::vector<std::string> args = {"file", "--name=value", "-ab", "--", "-x"};
+    argparse::detail::TokenCursor cursor{argparse::detail::ArgumentSource(args)};
+    
+    ASSERT_TRUE(cursor.has_next());
+    const Token& peeked = cursor.peek();
+    EXPECT_EQ(peeked.type, Token::POSITIONAL);
+    EXPECT_EQ(&peeked, &cursor.peek());  // peekは同じトークンへの参照を返す
+    
+    EXPECT_EQ(cursor.next().value, "file");
+    EXPECT_EQ(cursor.argument_index(), 0);
+    
+    EXPECT_EQ(cursor.next().value, "--name");
+    const Token& value = cursor.next();
+    EXPECT_EQ(value.type, Token::OPTION_VALUE);
+    EXPECT_EQ(value.value, "value");
+    EXPECT_EQ(cursor.argument_index(), 1);
+    
+    EXPECT_EQ(cursor.next().value, "-a");
+    const Token& b = cursor.next();
+    EXPECT_EQ(b.value, "-b");
+    EXPECT_EQ(b.raw_value, "-ab");
+    EXPECT_EQ(cursor.argument_index(), 2);
+    
+    EXPECT_EQ(cursor.next().type, Token::END_OPTIONS);
+    const Token& after = cursor.next();
+    EXPECT_EQ(after.type, Token::POSITIONAL);
+    EXPECT_EQ(after.value, "-x");
+    
+    EXPECT_FALSE(cursor.has_next());
+    EXPECT_THROW(cursor.next(), std::runtime_error);
+}
+
+// エスケープ処理した値が直前のトークンを上書きしないことのテスト
+TEST_F(TokenizerTest, CursorScratchKeepsConsumedToken) {
+    std::vector<std::string> args = {"--a=\"1\\t\"", "--b=\"2\\n\""};
+    argparse::detail::TokenCursor cursor{argparse::detail::ArgumentSource(args)};
+    
+    cursor.next();
+    const Token& first = cursor.next();
+    EXPECT_EQ(first.value, "1\t");
+    EXPECT_TRUE(cursor.is_scratch(first.value));
+    
+    // 次の引数を先読みしても消費済みトークンの値は有効
+    std::string first_value = first.value.str();
+    cursor.peek();
+    cursor.next();
+    EXPECT_EQ(cursor.peek().value, "2\n");
+    EXPECT_EQ(first_value, "1\t");
+}
@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+#include "../../include/argparse/argparse.hpp"
+
+#if defined(__GNUC__) && defined(__linux__)
+#include <dlfcn.h>
+
+// 送出された例外の数を数える（Itanium C++ ABI の __cxa_throw を置き換えて本来の実装へ渡す）
+#define ARGPARSE_TEST_COUNTS_THROWS 1
+
+namespace {
+    int throw_count = 0;
+}
+
+extern "C" void __cxa_throw(void* object, void* type, void (*destructor)(void*)) {
+    typedef void (*ThrowFunction)(void*, void*, void (*)(void*));
+    static ThrowFunction real_throw = reinterpret_cast<ThrowFunction>(dlsym(RTLD_NEXT, "__cxa_throw"));
+    ++throw_count;
+    real_throw(object, type, destructor);
+    __builtin_unreachable();
+}
+#endif
+
+class TryParseArgsTest : public ::testing::Test {
+protected:
+    argparse::ArgumentParser parser;
+
+    void SetUp() override {
+        parser = argparse::ArgumentParser("test_prog", "Test program");
+        parser.add_argument("input");
+        parser.add_argument("--count", "-c").type<int>().default_value(1);
+        parser.add_argument("--mode").choices(std::vector<std::string>{"fast", "slow"});
+        parser.add_argument("--verbose", "-v").action("store_true");
+    }
+};
+
+// 成功時は解析結果を返すことのテスト
+TEST_F(TryParseArgsTest, Success) {
+    argparse::ParseResult result = parser.try_parse_args(std::vector<std::string>{"a.txt", "-c", "3"});
+
+    ASSERT_TRUE(result.ok());
+    EXPECT_TRUE(static_cast<bool>(result));
+    EXPECT_EQ(result.status(), argparse::ParseStatus::SUCCESS);
+    EXPECT_EQ(result.values().get<std::string>("input"), "a.txt");
+    EXPECT_EQ(result.values().get<int>("count"), 3);
+    EXPECT_FALSE(result.values().get<bool>("verbose"));
+    EXPECT_TRUE(result.message().empty());
+}
+
+// 未知のオプションの報告（種別・位置・メッセージ）のテスト
+TEST_F(TryParseArgsTest, UnrecognizedArgument) {
+    argparse::ParseResult result = parser.try_parse_args(std::vector<std::string>{"a.txt", "-v", "--unknown"});
+
+    ASSERT_FALSE(result.ok());
+    EXPECT_EQ(result.status(), argparse::ParseStatus::UNRECOGNIZED_ARGUMENTS);
+    EXPECT_EQ(result.argument_index(), 2);
+    EXPECT_EQ(result.argument_name(), "--unknown");
+    EXPECT_EQ(result.message(), "unrecognized arguments: --unknown");
+    EXPECT_NE(result.message_with_usage().find("usage: test_prog"), std::string::npos);
+
+    // 余分な位置引数
+    argparse::ParseResult extra = parser.try_parse_args(std::vector<std::string>{"a.txt", "b.txt"});
+    EXPECT_EQ(extra.status(), argparse::ParseStatus::UNRECOGNIZED_ARGUMENTS);
+    EXPECT_EQ(extra.argument_index(), 1);
+}
+
+// 値の不足・変換失敗・choices違反の報告のテスト
+TEST_F(TryParseArgsTest, ValueErrors) {
+    argparse::ParseResult missing = parser.try_parse_args(std::vector<std::string>{"a.txt", "--count"});
+    EXPECT_EQ(missing.status(), argparse::ParseStatus::MISSING_VALUE);
+    EXPECT_EQ(missing.argument_index(), 1);
+
+    argparse::ParseResult invalid = parser.try_parse_args(std::vector<std::string>{"a.txt", "--count", "abc"});
+    EXPECT_EQ(invalid.status(), argparse::ParseStatus::INVALID_VALUE);
+    EXPECT_EQ(invalid.argument_index(), 2);
+    EXPECT_EQ(invalid.argument_name(), "--count");
+    EXPECT_NE(invalid.message().find("invalid int value: 'abc'"), std::string::npos);
+
+    argparse::ParseResult choice = parser.try_parse_args(std::vector<std::string>{"a.txt", "--mode", "medium"});
+    EXPECT_EQ(choice.status(), argparse::ParseStatus::INVALID_CHOICE);
+    EXPECT_EQ(choice.message(), "argument --mode: invalid choice: 'medium' (choose from 'fast', 'slow')");
+}
+
+#ifdef ARGPARSE_TEST_COUNTS_THROWS
+// 組み込み型の変換失敗は例外を使わずに報告されることのテスト
+TEST_F(TryParseArgsTest, InvalidBuiltinValueDoesNotThrow) {
+    parser.add_argument("--ratio").type<double>();
+    parser.add_argument("--flag").type<bool>();
+    parser.add_argument("--limit").type<argparse::ByteSize>();
+    parser.add_argument("--values").type<int>().nargs("+");
+    argparse::CompiledParser compiled = parser.compile();
+    
+    std::vector<std::vector<std::string>> inputs = {
+        {"a.txt", "--count", "abc"},
+        {"--count", "99999999999", "a.txt"},
+        {"a.txt", "--ratio", "1e999"},
+        {"a.txt", "--flag", "maybe"},
+        {"a.txt", "--limit", "1.5B"},
+        {"a.txt", "--values", "1", "x"}
+    };
+    for (const auto& args : inputs) {
+        int before = throw_count;
+        argparse::ParseResult result = compiled.try_parse_args(args);
+        EXPECT_EQ(throw_count, before) << args[1] << " " << args[2];
+        EXPECT_EQ(result.status(), argparse::ParseStatus::INVALID_VALUE);
+    }
+    
+    argparse::ParseResult invalid = compiled.try_parse_args(std::vector<std::string>{"a.txt", "--count", "abc"});
+    EXPECT_EQ(invalid.message(), "invalid int value: 'abc'");
+    
+    // 例外APIは従来どおり送出する（送出回数が数えられていることの確認）
+    int before = throw_count;
+    EXPECT_THROW(compiled.parse_args(std::vector<std::string>{"a.txt", "--count", "abc"}), std::invalid_argument);
+    EXPECT_GT(throw_count, before);
+}
+#endif
+
+// 必須引数の不足の報告のテスト
+TEST_F(TryParseArgsTest, MissingRequired) {
+    argparse::ParseResult result = parser.try_parse_args(std::vector<std::string>{"-v"});
+
+    EXPECT_EQ(result.status(), argparse::ParseStatus::MISSING_REQUIRED);
+    EXPECT_EQ(result.argument_index(), argparse::ParseResult::npos);
+    EXPECT_EQ(result.message(), "the following arguments are required: input");
+}
+
+// ヘルプ要求は例外ではなく結果として返ることのテスト
+TEST_F(TryParseArgsTest, HelpRequested) {
+    argparse::ParseResult result = parser.try_parse_args(std::vector<std::string>{"--help"});
+
+    EXPECT_EQ(result.status(), argparse::ParseStatus::HELP_REQUESTED);
+    EXPECT_NE(result.message().find("usage: test_prog"), std::string::npos);
+    EXPECT_NE(result.message().find("--count"), std::string::npos);
+}
+
+// 例外APIと同じメッセージになることのテスト
+TEST_F(TryParseArgsTest, MatchesThrowingApi) {
+    std::vector<std::vector<std::string>> inputs = {
+        {"a.txt", "--unknown"},
+        {"a.txt", "--count", "x"},
+        {"a.txt", "--mode", "medium"},
+        {"a.txt", "--count"},
+        {}
+    };
+
+    for (const auto& args : inputs) {
+        argparse::ParseResult result = parser.try_parse_args(args);
+        ASSERT_FALSE(result.ok());
+        try {
+            parser.parse_args(args);
+            FAIL() << "parse_args did not throw";
+        } catch (const std::exception& e) {
+            EXPECT_EQ(result.message(), e.what());
+        }
+    }
+}
+
+// CompiledParserからの繰り返し利用のテスト
+TEST_F(TryParseArgsTest, CompiledParserReuse) {
+    argparse::CompiledParser compiled = parser.compile();
+
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_FALSE(compiled.try_parse_args(std::vector<std::string>{"--bad"}).ok());
+        argparse::ParseResult result = compiled.try_parse_args(std::vector<std::string>{"x"});
+        ASSERT_TRUE(result.ok());
+        EXPECT_EQ(result.values().get<int>("count"), 1);
+    }
+}
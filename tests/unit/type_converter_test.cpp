@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include <cmath>
+#include <cstdlib>
 #include "../../include/argparse/argparse.hpp"
 
 using namespace argparse::detail;
@@ -178,7 +179,7 @@ TEST_F(TypeConverterTest, GetConverterTemplate) {
     EXPECT_EQ(int_conv("42").get<int>(), 42);
     
     auto float_conv = TypeConverter::get_converter<float>();
-    EXPECT_DOUBLE_EQ(float_conv("3.14").get<double>(), 3.14);
+    EXPECT_FLOAT_EQ(float_conv("3.14").get<float>(), 3.14f);
     
     auto double_conv = TypeConverter::get_converter<double>();
     EXPECT_DOUBLE_EQ(double_conv("2.71").get<double>(), 2.71);
@@ -244,4 +245,274 @@ TEST_F(TypeConverterTest, EdgeCases) {
     // 特殊文字
     std::string special = "\t\n\r\"'\\";
     EXPECT_EQ(str_conv(special).get<std::string>(), special);
-}
\ No newline at end of file
+}
+
+// 整数解析（エラーコードを返す）のテスト
+TEST_F(TypeConverterTest, ParseIntegerErrorCodes) {
+    int value = -1;
+    EXPECT_EQ(parse_integer(StringView("42"), value), NumberError::NONE);
+    EXPECT_EQ(value, 42);
+    EXPECT_EQ(parse_integer(StringView("  +7\t"), value), NumberError::NONE);
+    EXPECT_EQ(value, 7);
+    
+    // 失敗時は値を変更しない
+    value = 5;
+    EXPECT_EQ(parse_integer(StringView(""), value), NumberError::EMPTY);
+    EXPECT_EQ(parse_integer(StringView("  "), value), NumberError::EMPTY);
+    EXPECT_EQ(parse_integer(StringView("-"), value), NumberError::INVALID);
+    EXPECT_EQ(parse_integer(StringView("12.5"), value), NumberError::INVALID);
+    EXPECT_EQ(parse_integer(StringView("1 2"), value), NumberError::INVALID);
+    EXPECT_EQ(parse_integer(StringView("2147483648"), value), NumberError::OUT_OF_RANGE);
+    EXPECT_EQ(parse_integer(StringView("99999999999999999999x"), value), NumberError::INVALID);
+    EXPECT_EQ(value, 5);
+}
+
+// 接頭辞と区切り文字のテスト
+TEST_F(TypeConverterTest, ParseIntegerPrefixesAndSeparators) {
+    long long value = 0;
+    EXPECT_EQ(parse_integer(StringView("0x1F"), value), NumberError::NONE);
+    EXPECT_EQ(value, 31);
+    EXPECT_EQ(parse_integer(StringView("-0XfF"), value), NumberError::NONE);
+    EXPECT_EQ(value, -255);
+    EXPECT_EQ(parse_integer(StringView("0o755"), value), NumberError::NONE);
+    EXPECT_EQ(value, 493);
+    EXPECT_EQ(parse_integer(StringView("0b1010"), value), NumberError::NONE);
+    EXPECT_EQ(value, 10);
+    EXPECT_EQ(parse_integer(StringView("1_000_000"), value), NumberError::NONE);
+    EXPECT_EQ(value, 1000000);
+    EXPECT_EQ(parse_integer(StringView("0xFFFF'FFFF"), value), NumberError::NONE);
+    EXPECT_EQ(value, 4294967295LL);
+    EXPECT_EQ(parse_integer(StringView("007"), value), NumberError::NONE);
+    EXPECT_EQ(value, 7);
+    
+    EXPECT_EQ(parse_integer(StringView("0x"), value), NumberError::INVALID);
+    EXPECT_EQ(parse_integer(StringView("0b102"), value), NumberError::INVALID);
+    EXPECT_EQ(parse_integer(StringView("0o8"), value), NumberError::INVALID);
+    EXPECT_EQ(parse_integer(StringView("_1"), value), NumberError::INVALID);
+    EXPECT_EQ(parse_integer(StringView("1_"), value), NumberError::INVALID);
+    EXPECT_EQ(parse_integer(StringView("1__0"), value), NumberError::INVALID);
+    EXPECT_EQ(parse_integer(StringView("0x_1"), value), NumberError::INVALID);
+}
+
+// 各整数幅の範囲境界のテスト
+TEST_F(TypeConverterTest, ParseIntegerWidths) {
+    int8_t i8 = 0;
+    EXPECT_EQ(parse_integer(StringView("-128"), i8), NumberError::NONE);
+    EXPECT_EQ(i8, -128);
+    EXPECT_EQ(parse_integer(StringView("128"), i8), NumberError::OUT_OF_RANGE);
+    
+    uint16_t u16 = 0;
+    EXPECT_EQ(parse_integer(StringView("65535"), u16), NumberError::NONE);
+    EXPECT_EQ(u16, 65535);
+    EXPECT_EQ(parse_integer(StringView("65536"), u16), NumberError::OUT_OF_RANGE);
+    
+    int64_t i64 = 0;
+    EXPECT_EQ(parse_integer(StringView("-9223372036854775808"), i64), NumberError::NONE);
+    EXPECT_EQ(i64, std::numeric_limits<int64_t>::min());
+    EXPECT_EQ(parse_integer(StringView("9223372036854775807"), i64), NumberError::NONE);
+    EXPECT_EQ(i64, std::numeric_limits<int64_t>::max());
+    EXPECT_EQ(parse_integer(StringView("9223372036854775808"), i64), NumberError::OUT_OF_RANGE);
+    
+    uint64_t u64 = 0;
+    EXPECT_EQ(parse_integer(StringView("18446744073709551615"), u64), NumberError::NONE);
+    EXPECT_EQ(u64, std::numeric_limits<uint64_t>::max());
+    EXPECT_EQ(parse_integer(StringView("18446744073709551616"), u64), NumberError::OUT_OF_RANGE);
+    EXPECT_EQ(parse_integer(StringView("-1"), u64), NumberError::OUT_OF_RANGE);
+    EXPECT_EQ(parse_integer(StringView("-0"), u64), NumberError::NONE);
+    EXPECT_EQ(u64, 0u);
+}
+
+// int以外の整数型の変換器のテスト
+TEST_F(TypeConverterTest, IntegralConverters) {
+    EXPECT_EQ(TypeConverter::get_converter<long>()("-5").get<long>(), -5L);
+    EXPECT_EQ(TypeConverter::get_converter<int64_t>()("0x7fffffffffffffff").get<int64_t>(),
+              std::numeric_limits<int64_t>::max());
+    EXPECT_EQ(TypeConverter::get_converter<uint64_t>()("18446744073709551615").get<uint64_t>(),
+              std::numeric_limits<uint64_t>::max());
+    EXPECT_EQ(TypeConverter::get_converter<unsigned short>()("0b11").get<unsigned short>(), 3);
+    
+    auto converter = TypeConverter::get_converter<uint64_t>();
+    EXPECT_THROW(converter("-1"), std::invalid_argument);
+    EXPECT_THROW(converter("abc"), std::invalid_argument);
+    
+    try {
+        TypeConverter::int_converter()("99999999999");
+        FAIL() << "out of range value was accepted";
+    } catch (const std::invalid_argument& e) {
+        EXPECT_EQ(std::string(e.what()), "int value out of range: '99999999999'");
+    }
+    
+    // 範囲外のメッセージは実際の型の幅を示す
+    try {
+        TypeConverter::get_converter<uint8_t>()("300");
+        FAIL() << "out of range value was accepted";
+    } catch (const std::invalid_argument& e) {
+        EXPECT_EQ(std::string(e.what()), "uint8 value out of range: '300'");
+    }
+    try {
+        TypeConverter::get_converter<int16_t>()("-40000");
+        FAIL() << "out of range value was accepted";
+    } catch (const std::invalid_argument& e) {
+        EXPECT_EQ(std::string(e.what()), "int16 value out of range: '-40000'");
+    }
+    try {
+        TypeConverter::get_converter<uint64_t>()("18446744073709551616");
+        FAIL() << "out of range value was accepted";
+    } catch (const std::invalid_argument& e) {
+        EXPECT_EQ(std::string(e.what()), "uint64 value out of range: '18446744073709551616'");
+    }
+}
+
+// パーサー経由で64ビット整数を扱うテスト
+TEST_F(TypeConverterTest, ParserWith64BitTypes) {
+    argparse::ArgumentParser parser("test_prog");
+    parser.add_argument("--offset").type<int64_t>();
+    parser.add_argument("--bytes").type<uint64_t>();
+    
+    auto ns = parser.parse_args(std::vector<std::string>{"--offset=-4294967296", "--bytes", "0x1_0000_0000"});
+    EXPECT_EQ(ns.get<int64_t>("offset"), -4294967296LL);
+    EXPECT_EQ(ns.get<uint64_t>("bytes"), 4294967296ULL);
+    EXPECT_EQ(parser.get_argument("--offset")->definition().type_name, "int64");
+    EXPECT_EQ(parser.get_argument("--bytes")->definition().type_name, "uint64");
+    
+    EXPECT_THROW(parser.parse_args(std::vector<std::string>{"--bytes=-1"}), std::invalid_argument);
+}
+
+// parse_floatが標準の変換と同じ値に丸めることのテスト
+TEST_F(TypeConverterTest, ParseFloatIsCorrectlyRounded) {
+    const char* inputs[] = {
+        "0.1", "3.14159", "-2.5", "1e23", "8.98846567431158e307", "1.7976931348623157e308",
+        "2.2250738585072011e-308", "4.9406564584124654e-324", "5e-324", "123456789012345678901234567890",
+        "9007199254740993", "0.000001", "1.00000000000000011102230246251565404236316680908203125",
+        "1.00000000000000011102230246251565404236316680908203124", "7.038531e-26", "3.4028235e38",
+        "1.17549435e-38", "1.4e-45", "16777217", "0.30000000000000004", ".5", "5.", "+12E-3"
+    };
+    for (const char* input : inputs) {
+        double d = 0;
+        float f = 0;
+        EXPECT_EQ(parse_float(StringView(input), d), NumberError::NONE) << input;
+        EXPECT_EQ(d, std::strtod(input, nullptr)) << input;
+        if (std::isinf(std::strtof(input, nullptr))) {
+            EXPECT_EQ(parse_float(StringView(input), f), NumberError::OUT_OF_RANGE) << input;
+        } else {
+            EXPECT_EQ(parse_float(StringView(input), f), NumberError::NONE) << input;
+            EXPECT_EQ(f, std::strtof(input, nullptr)) << input;
+        }
+    }
+}
+
+// parse_floatのエラーコードのテスト
+TEST_F(TypeConverterTest, ParseFloatErrorCodes) {
+    double d = 1.0;
+    EXPECT_EQ(parse_float(StringView(""), d), NumberError::EMPTY);
+    EXPECT_EQ(parse_float(StringView("."), d), NumberError::INVALID);
+    EXPECT_EQ(parse_float(StringView("1e"), d), NumberError::INVALID);
+    EXPECT_EQ(parse_float(StringView("1.2.3"), d), NumberError::INVALID);
+    EXPECT_EQ(parse_float(StringView("0x10"), d), NumberError::INVALID);
+    EXPECT_EQ(parse_float(StringView("1e309"), d), NumberError::OUT_OF_RANGE);
+    EXPECT_EQ(d, 1.0);
+    
+    // 下位桁の消失は0として受け付ける
+    EXPECT_EQ(parse_float(StringView("-1e-400"), d), NumberError::NONE);
+    EXPECT_EQ(d, 0.0);
+    EXPECT_TRUE(std::signbit(d));
+    
+    float f = 0;
+    EXPECT_EQ(parse_float(StringView("3.5e38"), f), NumberError::OUT_OF_RANGE);
+    EXPECT_EQ(parse_float(StringView(" 1e38 "), f), NumberError::NONE);
+    EXPECT_EQ(parse_float(StringView("Infinity"), f), NumberError::NONE);
+    EXPECT_TRUE(std::isinf(f));
+    EXPECT_EQ(parse_float(StringView("NaN"), f), NumberError::NONE);
+    EXPECT_TRUE(std::isnan(f));
+}
+
+// type<float>()がfloatのまま値を格納することのテスト
+TEST_F(TypeConverterTest, ParserWithFloatTypes) {
+    argparse::ArgumentParser parser("test_prog");
+    parser.add_argument("--ratio").type<float>();
+    parser.add_argument("--scale").type<double>();
+    
+    auto ns = parser.parse_args(std::vector<std::string>{"--ratio", "0.1", "--scale", "0.1"});
+    EXPECT_EQ(ns.get<float>("ratio"), 0.1f);
+    EXPECT_EQ(ns.get<double>("scale"), 0.1);
+    
+    try {
+        parser.parse_args(std::vector<std::string>{"--ratio", "1e39"});
+        FAIL() << "out of range value was accepted";
+    } catch (const std::invalid_argument& e) {
+        EXPECT_NE(std::string(e.what()).find("float value out of range: '1e39'"), std::string::npos);
+    }
+}
+
+// 組み込みの変換器が状態を持たず、型ごとに静的に選択されることのテスト
+TEST_F(TypeConverterTest, BuiltinConvertersAreStateless) {
+    Converter int_conv = TypeConverter::get_converter<int>();
+    EXPECT_TRUE(static_cast<bool>(int_conv));
+    EXPECT_FALSE(int_conv.has_state());
+    EXPECT_EQ(int_conv.invoker(), TypeConverter::int_converter().invoker());
+    EXPECT_NE(int_conv.invoker(), TypeConverter::get_converter<long>().invoker());
+    EXPECT_FALSE(TypeConverter::bool_converter().has_state());
+    
+    // 型付きの変換はAnyValueを経由しない
+    EXPECT_EQ(ValueParser<int16_t>::convert("-0x10"), -16);
+    EXPECT_EQ(ValueParser<double>::convert("2.5"), 2.5);
+    EXPECT_TRUE(ValueParser<bool>::convert(" Yes "));
+    EXPECT_THROW(ValueParser<bool>::convert("\x11"), std::invalid_argument);
+    
+    EXPECT_LT(sizeof(Converter), sizeof(std::function<AnyValue(const std::string&)>));
+}
+
+// 状態を持つ変換器のテスト
+TEST_F(TypeConverterTest, StatefulConverter) {
+    std::string suffix = "_x";
+    Converter converter([suffix](const std::string& value) { return AnyValue(value + suffix); });
+    EXPECT_TRUE(converter.has_state());
+    
+    Converter copy = converter;
+    EXPECT_EQ(copy("a").get<std::string>(), "a_x");
+    
+    Converter empty;
+    EXPECT_TRUE(empty == nullptr);
+    EXPECT_FALSE(copy == nullptr);
+    
+    Converter custom = TypeConverter::create_custom_converter<int>([](const std::string& value) -> int {
+        if (value.empty()) {
+            throw std::runtime_error("empty");
+        }
+        return static_cast<int>(value.size());
+    });
+    EXPECT_EQ(custom("abcd").get<int>(), 4);
+    try {
+        custom("");
+        FAIL() << "custom converter did not throw";
+    } catch (const std::invalid_argument& e) {
+        EXPECT_EQ(std::string(e.what()), "custom conversion failed for '': empty");
+    }
+}
+
+// 非 const な operator() を持つ関数オブジェクト（mutable ラムダ）のテスト
+TEST_F(TypeConverterTest, MutableFunctionObjects) {
+    argparse::ArgumentParser parser("test");
+    int calls = 0;
+    parser.add_argument("--id").converter<int>([calls](const std::string& value) mutable {
+        return std::stoi(value) * 100 + ++calls;
+    });
+    parser.add_argument("--tag").converter(Converter([calls](const std::string& value) mutable {
+        return AnyValue(value + std::to_string(++calls));
+    }));
+    int total = 0;
+    parser.add_argument("--sum").custom_action([total](const AnyValue&, const std::string& value) mutable {
+        total += static_cast<int>(value.size());
+        return AnyValue(total);
+    });
+    
+    auto ns = parser.parse_args(std::vector<std::string>{
+        "--id", "1", "--id", "2", "--tag", "a", "--tag", "b", "--sum", "ab", "--sum", "cde"});
+    EXPECT_EQ(ns.get<int>("id"), 202);
+    EXPECT_EQ(ns.get<std::string>("tag"), "b2");
+    EXPECT_EQ(ns.get<int>("sum"), 5);
+    
+    // 呼び出し側の変数はコピーされたまま変わらない
+    EXPECT_EQ(calls, 0);
+    EXPECT_EQ(total, 0);
+}
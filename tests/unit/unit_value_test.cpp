@@ -0,0 +1,208 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include "../../include/argparse/argparse.hpp"
+
+using namespace argparse;
+using namespace argparse::detail;
+
+class UnitValueTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+    }
+    
+    void TearDown() override {
+    }
+};
+
+// バイト数の解析のテスト（SI/IEC接頭辞）
+TEST_F(UnitValueTest, ByteSizeSuffixes) {
+    uint64_t bytes = 0;
+    EXPECT_EQ(parse_byte_size("4096", bytes), NumberError::NONE);
+    EXPECT_EQ(bytes, 4096u);
+    EXPECT_EQ(parse_byte_size("64MiB", bytes), NumberError::NONE);
+    EXPECT_EQ(bytes, 64u * 1024 * 1024);
+    EXPECT_EQ(parse_byte_size("1.5GB", bytes), NumberError::NONE);
+    EXPECT_EQ(bytes, 1500000000u);
+    EXPECT_EQ(parse_byte_size("10 kB", bytes), NumberError::NONE);
+    EXPECT_EQ(bytes, 10000u);
+    EXPECT_EQ(parse_byte_size("1.5KiB", bytes), NumberError::NONE);
+    EXPECT_EQ(bytes, 1536u);
+    EXPECT_EQ(parse_byte_size("2g", bytes), NumberError::NONE);
+    EXPECT_EQ(bytes, 2000000000u);
+    EXPECT_EQ(parse_byte_size("512B", bytes), NumberError::NONE);
+    EXPECT_EQ(bytes, 512u);
+}
+
+// バイト数の範囲外・端数・不正な入力のテスト
+TEST_F(UnitValueTest, ByteSizeErrors) {
+    uint64_t bytes = 7;
+    EXPECT_EQ(parse_byte_size("15EiB", bytes), NumberError::NONE);
+    EXPECT_EQ(bytes, 15ULL << 60);
+    EXPECT_EQ(parse_byte_size("18446744073709551615", bytes), NumberError::NONE);
+    EXPECT_EQ(bytes, std::numeric_limits<uint64_t>::max());
+    
+    bytes = 7;
+    EXPECT_EQ(parse_byte_size("16EiB", bytes), NumberError::OUT_OF_RANGE);
+    EXPECT_EQ(parse_byte_size("18446744073709551616", bytes), NumberError::OUT_OF_RANGE);
+    EXPECT_EQ(parse_byte_size("1.5B", bytes), NumberError::INEXACT);
+    EXPECT_EQ(parse_byte_size("0.0001KiB", bytes), NumberError::INEXACT);
+    // 整数部は収まり、小数部だけが仮数に収まらない場合は範囲外ではなく端数
+    EXPECT_EQ(parse_byte_size("2.0000000000000000001GiB", bytes), NumberError::INEXACT);
+    EXPECT_EQ(parse_byte_size("2.00000000000000000000000001GiB", bytes), NumberError::INEXACT);
+    EXPECT_EQ(parse_byte_size("2.0000000000000000000000GiB", bytes), NumberError::NONE);
+    EXPECT_EQ(bytes, 2ULL << 30);
+    bytes = 7;
+    EXPECT_EQ(parse_byte_size("18446744073709551616.5", bytes), NumberError::OUT_OF_RANGE);
+    EXPECT_EQ(parse_byte_size("", bytes), NumberError::EMPTY);
+    EXPECT_EQ(parse_byte_size("MiB", bytes), NumberError::INVALID);
+    EXPECT_EQ(parse_byte_size("-1KiB", bytes), NumberError::INVALID);
+    EXPECT_EQ(parse_byte_size("1XB", bytes), NumberError::INVALID);
+    EXPECT_EQ(parse_byte_size("1KiBs", bytes), NumberError::INVALID);
+    EXPECT_EQ(bytes, 7u);
+    
+    try {
+        ValueParser<ByteSize>::convert("16EiB");
+        FAIL() << "Should have thrown";
+    } catch (const std::invalid_argument& e) {
+        EXPECT_STREQ(e.what(), "byte size value out of range: '16EiB' (maximum is 18446744073709551615 bytes)");
+    }
+}
+
+// 時間の解析のテスト（単位の換算と連結）
+TEST_F(UnitValueTest, DurationUnits) {
+    std::chrono::milliseconds ms(0);
+    EXPECT_EQ(parse_duration("250ms", ms), NumberError::NONE);
+    EXPECT_EQ(ms.count(), 250);
+    EXPECT_EQ(parse_duration("1.5s", ms), NumberError::NONE);
+    EXPECT_EQ(ms.count(), 1500);
+    EXPECT_EQ(parse_duration("1h30m", ms), NumberError::NONE);
+    EXPECT_EQ(ms.count(), 5400000);
+    EXPECT_EQ(parse_duration("1h 30min", ms), NumberError::NONE);
+    EXPECT_EQ(ms.count(), 5400000);
+    EXPECT_EQ(parse_duration("2000us", ms), NumberError::NONE);
+    EXPECT_EQ(ms.count(), 2);
+    EXPECT_EQ(parse_duration("-2s", ms), NumberError::NONE);
+    EXPECT_EQ(ms.count(), -2000);
+    
+    // 単位のない数値は目標型の単位
+    EXPECT_EQ(parse_duration("30", ms), NumberError::NONE);
+    EXPECT_EQ(ms.count(), 30);
+    
+    std::chrono::seconds seconds(0);
+    EXPECT_EQ(parse_duration("1d", seconds), NumberError::NONE);
+    EXPECT_EQ(seconds.count(), 86400);
+    
+    std::chrono::duration<double> real(0);
+    EXPECT_EQ(parse_duration("250ms", real), NumberError::NONE);
+    EXPECT_DOUBLE_EQ(real.count(), 0.25);
+}
+
+// 時間の範囲外・端数・不正な入力のテスト
+TEST_F(UnitValueTest, DurationErrors) {
+    std::chrono::nanoseconds ns(0);
+    EXPECT_EQ(parse_duration("106751d", ns), NumberError::NONE);
+    EXPECT_EQ(parse_duration("106752d", ns), NumberError::OUT_OF_RANGE);
+    EXPECT_EQ(parse_duration("9223372036854775807", ns), NumberError::NONE);
+    EXPECT_EQ(parse_duration("9223372036854775808", ns), NumberError::OUT_OF_RANGE);
+    EXPECT_EQ(parse_duration("-9223372036854775808ns", ns), NumberError::NONE);
+    EXPECT_EQ(ns.count(), std::numeric_limits<int64_t>::min());
+    
+    std::chrono::milliseconds ms(0);
+    EXPECT_EQ(parse_duration("1ns", ms), NumberError::INEXACT);
+    EXPECT_EQ(parse_duration("1.0005s", ms), NumberError::INEXACT);
+    EXPECT_EQ(parse_duration("1h30", ms), NumberError::INVALID);
+    EXPECT_EQ(parse_duration("5 parsecs", ms), NumberError::INVALID);
+    EXPECT_EQ(parse_duration("ms", ms), NumberError::INVALID);
+    EXPECT_EQ(parse_duration(" ", ms), NumberError::EMPTY);
+    
+    std::chrono::hours hours(0);
+    EXPECT_EQ(parse_duration("90m", hours), NumberError::INEXACT);
+    EXPECT_EQ(parse_duration("120m", hours), NumberError::NONE);
+    EXPECT_EQ(hours.count(), 2);
+    
+    try {
+        ValueParser<std::chrono::milliseconds>::convert("1ns");
+        FAIL() << "Should have thrown";
+    } catch (const std::invalid_argument& e) {
+        EXPECT_STREQ(e.what(), "invalid duration value: '1ns' (not a whole number of ms)");
+    }
+    
+    std::string huge = std::string(400, '9') + "s";
+    try {
+        ValueParser<std::chrono::duration<double>>::convert(huge);
+        FAIL() << "out of range duration was accepted";
+    } catch (const std::invalid_argument& e) {
+        EXPECT_EQ(std::string(e.what()), "duration value out of range: '" + huge + "' (maximum is 1.79769e+308 s)");
+    }
+    
+    // float の Rep は double で計算した合計を変換前に上限と比べる
+    std::chrono::duration<float> narrow(0);
+    std::string fits = "1" + std::string(38, '0') + "s";
+    std::string too_big = "1" + std::string(39, '0') + "s";
+    EXPECT_EQ(parse_duration(fits, narrow), NumberError::NONE);
+    EXPECT_FLOAT_EQ(narrow.count(), 1e38f);
+    EXPECT_EQ(parse_duration(too_big, narrow), NumberError::OUT_OF_RANGE);
+    EXPECT_EQ(parse_duration("-" + too_big, narrow), NumberError::OUT_OF_RANGE);
+    EXPECT_EQ(parse_duration("1" + std::string(36, '0') + "h", narrow), NumberError::OUT_OF_RANGE);
+    EXPECT_FLOAT_EQ(narrow.count(), 1e38f);
+}
+
+// レートの解析のテスト
+TEST_F(UnitValueTest, RateSuffixes) {
+    double rate = 0;
+    EXPECT_EQ(parse_rate("250", rate), NumberError::NONE);
+    EXPECT_DOUBLE_EQ(rate, 250.0);
+    EXPECT_EQ(parse_rate("1.5k", rate), NumberError::NONE);
+    EXPECT_DOUBLE_EQ(rate, 1500.0);
+    EXPECT_EQ(parse_rate("10M/s", rate), NumberError::NONE);
+    EXPECT_DOUBLE_EQ(rate, 1e7);
+    EXPECT_EQ(parse_rate("120/min", rate), NumberError::NONE);
+    EXPECT_DOUBLE_EQ(rate, 2.0);
+    EXPECT_EQ(parse_rate("2kHz", rate), NumberError::NONE);
+    EXPECT_DOUBLE_EQ(rate, 2000.0);
+    
+    EXPECT_EQ(parse_rate("1e400", rate), NumberError::OUT_OF_RANGE);
+    EXPECT_EQ(parse_rate("-1", rate), NumberError::INVALID);
+    EXPECT_EQ(parse_rate("inf", rate), NumberError::INVALID);
+    EXPECT_EQ(parse_rate("5/week", rate), NumberError::INVALID);
+    
+    try {
+        ValueParser<Rate>::convert("1e400");
+        FAIL() << "out of range rate was accepted";
+    } catch (const std::invalid_argument& e) {
+        EXPECT_STREQ(e.what(), "rate value out of range: '1e400' (maximum is 1.79769e+308 /s)");
+    }
+}
+
+// type<T>() による解析と複数値のテスト
+TEST_F(UnitValueTest, ParserWithUnitTypes) {
+    ArgumentParser parser("test");
+    parser.add_argument("--buffer").type<ByteSize>().default_value(ByteSize(4096));
+    parser.add_argument("--timeout").type<std::chrono::milliseconds>();
+    parser.add_argument("--rate").type<Rate>();
+    parser.add_argument("--delays").type<std::chrono::microseconds>().nargs("+");
+    
+    auto args = parser.parse_args(std::vector<std::string>{
+        "--buffer", "64MiB", "--timeout", "250ms", "--rate", "1.5k", "--delays", "1ms", "250us"});
+    EXPECT_EQ(args.get<ByteSize>("buffer").bytes, 64u * 1024 * 1024);
+    EXPECT_EQ(args.get<std::chrono::milliseconds>("timeout"), std::chrono::milliseconds(250));
+    EXPECT_DOUBLE_EQ(args.get<Rate>("rate").per_second, 1500.0);
+    EXPECT_EQ(args.get<std::vector<std::chrono::microseconds>>("delays"),
+              (std::vector<std::chrono::microseconds>{std::chrono::microseconds(1000), std::chrono::microseconds(250)}));
+    
+    auto defaults = parser.parse_args(std::vector<std::string>{});
+    EXPECT_EQ(defaults.get<ByteSize>("buffer").bytes, 4096u);
+    
+    ParseResult result = parser.try_parse_args(std::vector<std::string>{"--buffer", "16EiB"});
+    ASSERT_FALSE(result.ok());
+    EXPECT_EQ(result.status(), ParseStatus::INVALID_VALUE);
+    EXPECT_NE(result.message().find("maximum is 18446744073709551615 bytes"), std::string::npos);
+}
+
+// 組み込みの変換器は状態を持たないことのテスト
+TEST_F(UnitValueTest, ConvertersAreStateless) {
+    EXPECT_FALSE(TypeConverter::byte_size_converter().has_state());
+    EXPECT_FALSE(TypeConverter::rate_converter().has_state());
+    EXPECT_FALSE(TypeConverter::duration_converter<std::chrono::seconds>().has_state());
+    EXPECT_EQ(TypeConverter::duration_converter<std::chrono::seconds>()("2m").get<std::chrono::seconds>().count(), 120);
+}